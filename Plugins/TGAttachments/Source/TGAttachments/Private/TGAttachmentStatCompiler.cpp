@@ -0,0 +1,95 @@
+#include "TGAttachmentStatCompiler.h"
+#include "TGAttachmentDef.h"
+#include "TGAttachments.h"
+#include "Misc/ScopeLock.h"
+
+FCriticalSection FTGAttachmentStatCompiler::CacheMutex;
+TMultiMap<uint32, FTGAttachmentStatCompiler::FCacheEntry>
+    FTGAttachmentStatCompiler::Cache;
+
+void FTGAttachmentStatCompiler::BuildKey(
+    TArrayView<const UTGAttachmentDef *const> Attachments,
+    TArray<FObjectKey> &OutKey) {
+  OutKey.Reset(Attachments.Num());
+  for (const UTGAttachmentDef *Def : Attachments) {
+    if (Def) {
+      OutKey.Add(FObjectKey(Def));
+    }
+  }
+  OutKey.Sort();
+}
+
+uint32 FTGAttachmentStatCompiler::HashKey(const TArray<FObjectKey> &Key) {
+  uint32 Hash = GetTypeHash(Key.Num());
+  for (const FObjectKey &Entry : Key) {
+    Hash = HashCombine(Hash, GetTypeHash(Entry));
+  }
+  return Hash;
+}
+
+uint32 FTGAttachmentStatCompiler::HashLoadout(
+    TArrayView<const UTGAttachmentDef *const> Attachments) {
+  TArray<FObjectKey> Key;
+  BuildKey(Attachments, Key);
+  return HashKey(Key);
+}
+
+TSharedRef<const FTGWeaponStatBlock> FTGAttachmentStatCompiler::Compile(
+    TArrayView<const UTGAttachmentDef *const> Attachments) {
+  TArray<FObjectKey> Key;
+  BuildKey(Attachments, Key);
+  const uint32 Hash = HashKey(Key);
+
+  FScopeLock Lock(&CacheMutex);
+
+  TArray<FCacheEntry *, TInlineAllocator<2>> Candidates;
+  Cache.MultiFindPointer(Hash, Candidates);
+  for (FCacheEntry *Entry : Candidates) {
+    if (Entry->Key == Key) {
+      if (TSharedPtr<const FTGWeaponStatBlock> Existing = Entry->Block.Pin()) {
+        return Existing.ToSharedRef();
+      }
+    }
+  }
+
+  // Multipliers compound, flat additions sum
+  TSharedRef<FTGWeaponStatBlock> Block = MakeShared<FTGWeaponStatBlock>();
+  for (const UTGAttachmentDef *Def : Attachments) {
+    if (!Def) {
+      continue;
+    }
+    Block->RecoilMultiplier *= Def->RecoilMultiplier;
+    Block->ADS_ms_Add += Def->ADS_ms_Add;
+    Block->MoveSpeedMultiplier *= Def->MoveSpeedMultiplier;
+    Block->Velocity_Add += Def->Velocity_Add;
+    Block->IRVisibility *= Def->IRVisibility;
+  }
+  Block->LoadoutHash = static_cast<int32>(Hash);
+
+  // Drop entries whose last owner has gone so the map stays bounded by live builds
+  for (auto It = Cache.CreateIterator(); It; ++It) {
+    if (!It.Value().Block.IsValid()) {
+      It.RemoveCurrent();
+    }
+  }
+
+  FCacheEntry &NewEntry = Cache.Add(Hash, FCacheEntry());
+  NewEntry.Key = MoveTemp(Key);
+  NewEntry.Block = Block;
+
+  UE_LOG(LogTGAttachments, Verbose,
+         TEXT("Compiled attachment loadout %08x (%d attachments, %d cached)"),
+         Hash, NewEntry.Key.Num(), Cache.Num());
+
+  return Block;
+}
+
+int32 FTGAttachmentStatCompiler::GetCachedLoadoutCount() {
+  FScopeLock Lock(&CacheMutex);
+  return Cache.Num();
+}
+
+void FTGAttachmentStatCompiler::ResetCache() {
+  FScopeLock Lock(&CacheMutex);
+  Cache.Reset();
+}
@@ -0,0 +1,55 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "TGAttachmentStatCompiler.h"
+#include "TGAttachmentDef.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTGAttachmentStatCompilerTest, "TerminalGrounds.Attachments.StatCompiler.SharedLoadoutBlocks", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTGAttachmentStatCompilerTest::RunTest(const FString& Parameters)
+{
+    auto MakeAttachment = [](FName Slot, float Recoil, int32 ADSms, float MoveSpeed, int32 Velocity, float IR)
+    {
+        UTGAttachmentDef* Def = NewObject<UTGAttachmentDef>(GetTransientPackage());
+        Def->Slot = Slot;
+        Def->RecoilMultiplier = Recoil;
+        Def->ADS_ms_Add = ADSms;
+        Def->MoveSpeedMultiplier = MoveSpeed;
+        Def->Velocity_Add = Velocity;
+        Def->IRVisibility = IR;
+        return Def;
+    };
+
+    UTGAttachmentDef* Suppressor = MakeAttachment(TEXT("Muzzle"), 0.8f, 20, 1.0f, -30, 0.5f);
+    UTGAttachmentDef* Grip = MakeAttachment(TEXT("Grip"), 0.9f, 10, 0.95f, 0, 1.0f);
+    UTGAttachmentDef* Stock = MakeAttachment(TEXT("Stock"), 0.75f, 40, 0.9f, 15, 1.0f);
+
+    // Same attachments equipped in a different order by another player
+    const TArray<const UTGAttachmentDef*> LoadoutA = { Suppressor, Grip, Stock };
+    const TArray<const UTGAttachmentDef*> LoadoutB = { Stock, Suppressor, Grip };
+    const TArray<const UTGAttachmentDef*> LoadoutC = { Suppressor, Grip };
+
+    const TSharedRef<const FTGWeaponStatBlock> BlockA = FTGAttachmentStatCompiler::Compile(LoadoutA);
+    const TSharedRef<const FTGWeaponStatBlock> BlockB = FTGAttachmentStatCompiler::Compile(LoadoutB);
+    const TSharedRef<const FTGWeaponStatBlock> BlockC = FTGAttachmentStatCompiler::Compile(LoadoutC);
+
+    TestTrue(TEXT("Identical loadouts share one compiled block"), &BlockA.Get() == &BlockB.Get());
+    TestFalse(TEXT("A different loadout compiles its own block"), &BlockA.Get() == &BlockC.Get());
+    TestEqual(TEXT("Shared blocks carry the same loadout hash"), BlockA->LoadoutHash, BlockB->LoadoutHash);
+
+    // Multipliers compound, flat additions sum
+    TestTrue(TEXT("Recoil multipliers compound"), FMath::IsNearlyEqual(BlockA->RecoilMultiplier, 0.8f * 0.9f * 0.75f));
+    TestTrue(TEXT("Move speed multipliers compound"), FMath::IsNearlyEqual(BlockA->MoveSpeedMultiplier, 0.95f * 0.9f));
+    TestTrue(TEXT("IR visibility multipliers compound"), FMath::IsNearlyEqual(BlockA->IRVisibility, 0.5f));
+    TestEqual(TEXT("ADS time additions sum"), BlockA->ADS_ms_Add, 70);
+    TestEqual(TEXT("Velocity additions sum"), BlockA->Velocity_Add, -15);
+
+    // The identity block for an empty loadout
+    const TSharedRef<const FTGWeaponStatBlock> Empty = FTGAttachmentStatCompiler::Compile(TArray<const UTGAttachmentDef*>());
+    TestTrue(TEXT("An empty loadout leaves multipliers at 1"), FMath::IsNearlyEqual(Empty->RecoilMultiplier, 1.0f) && FMath::IsNearlyEqual(Empty->MoveSpeedMultiplier, 1.0f));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
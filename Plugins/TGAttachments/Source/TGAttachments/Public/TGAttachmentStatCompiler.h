@@ -0,0 +1,54 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "TGAttachmentStatCompiler.generated.h"
+
+class UTGAttachmentDef;
+
+// Attachment modifiers folded into a single block at equip time.
+// Blocks are immutable once compiled and shared by every weapon with the same loadout.
+USTRUCT(BlueprintType)
+struct TGATTACHMENTS_API FTGWeaponStatBlock {
+  GENERATED_BODY()
+
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+  float RecoilMultiplier = 1.f;
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+  int32 ADS_ms_Add = 0;
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+  float MoveSpeedMultiplier = 1.f;
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+  int32 Velocity_Add = 0;
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+  float IRVisibility = 1.f;
+
+  // Order-independent hash of the attachments this block was compiled from
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+  int32 LoadoutHash = 0;
+};
+
+// Compiles attachment loadouts into shared stat blocks, cached by loadout hash.
+// Entries are held weakly so a build no one has equipped is released.
+class TGATTACHMENTS_API FTGAttachmentStatCompiler {
+public:
+  static TSharedRef<const FTGWeaponStatBlock>
+  Compile(TArrayView<const UTGAttachmentDef *const> Attachments);
+
+  static uint32 HashLoadout(TArrayView<const UTGAttachmentDef *const> Attachments);
+
+  static int32 GetCachedLoadoutCount();
+  static void ResetCache();
+
+private:
+  struct FCacheEntry {
+    TArray<FObjectKey> Key; // Sorted attachment keys, guards against hash collisions
+    TWeakPtr<const FTGWeaponStatBlock> Block;
+  };
+
+  static void BuildKey(TArrayView<const UTGAttachmentDef *const> Attachments,
+                       TArray<FObjectKey> &OutKey);
+  static uint32 HashKey(const TArray<FObjectKey> &Key);
+
+  static FCriticalSection CacheMutex;
+  static TMultiMap<uint32, FCacheEntry> Cache;
+};
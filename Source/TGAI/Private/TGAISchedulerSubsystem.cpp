@@ -0,0 +1,284 @@
+#include "TGAISchedulerSubsystem.h"
+#include "TGAI.h"
+#include "TGEnemyGrunt.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarTGAIUpdateBudgetMs(
+	TEXT("tg.AI.UpdateBudgetMs"),
+	1.0f,
+	TEXT("Game thread milliseconds per frame the AI scheduler may spend on grunt decision updates"),
+	ECVF_Default);
+
+DECLARE_CYCLE_STAT(TEXT("TG AI Scheduler"), STAT_TGAIScheduler, STATGROUP_Game);
+
+// On-screen grunts count as rendered if drawn within this window
+static constexpr float OnScreenTolerance = 0.25f;
+
+void UTGAISchedulerSubsystem::Deinitialize()
+{
+	Agents.Empty();
+	AgentIndices.Empty();
+	Super::Deinitialize();
+}
+
+bool UTGAISchedulerSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTGAISchedulerSubsystem::RegisterGrunt(ATGEnemyGrunt* Grunt)
+{
+	if (!Grunt || AgentIndices.Contains(Grunt))
+	{
+		return;
+	}
+
+	FScheduledAgent& Agent = Agents.AddDefaulted_GetRef();
+	Agent.Grunt = Grunt;
+
+	// Stagger first updates so a wave spawned together does not update in lockstep
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	Agent.LastUpdateTime = Now;
+	GatherPlayerLocations();
+	UpdateSignificance(Agent, Now);
+	Agent.NextUpdateTime = Now + FMath::FRandRange(0.0f, GetUpdateInterval(Agent.Significance));
+
+	AgentIndices.Add(Grunt, Agents.Num() - 1);
+}
+
+void UTGAISchedulerSubsystem::UnregisterGrunt(ATGEnemyGrunt* Grunt)
+{
+	if (const int32* Index = AgentIndices.Find(Grunt))
+	{
+		if (bIsUpdating)
+		{
+			// Indices are live in the update loop; leave a stale entry for the next sweep
+			Agents[*Index].Grunt.Reset();
+			AgentIndices.Remove(Grunt);
+			return;
+		}
+		RemoveAgentAt(*Index);
+	}
+}
+
+void UTGAISchedulerSubsystem::RemoveAgentAt(int32 Index)
+{
+	if (const ATGEnemyGrunt* Removed = Agents[Index].Grunt.Get())
+	{
+		AgentIndices.Remove(Removed);
+	}
+	else
+	{
+		// Stale entry; find it by value since the weak pointer can no longer name it
+		for (auto It = AgentIndices.CreateIterator(); It; ++It)
+		{
+			if (It.Value() == Index)
+			{
+				It.RemoveCurrent();
+				break;
+			}
+		}
+	}
+
+	const int32 LastIndex = Agents.Num() - 1;
+	if (Index != LastIndex)
+	{
+		Agents[Index] = MoveTemp(Agents[LastIndex]);
+		if (const ATGEnemyGrunt* Moved = Agents[Index].Grunt.Get())
+		{
+			AgentIndices.Add(Moved, Index);
+		}
+	}
+	Agents.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+}
+
+void UTGAISchedulerSubsystem::RefreshSignificance(ATGEnemyGrunt* Grunt)
+{
+	if (const int32* Index = AgentIndices.Find(Grunt))
+	{
+		FScheduledAgent& Agent = Agents[*Index];
+		const ETGAISignificance OldSignificance = Agent.Significance;
+		const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+		UpdateSignificance(Agent, Now);
+
+		// Promoted agents should not wait out the interval of their old tier
+		if (Agent.Significance > OldSignificance)
+		{
+			Agent.NextUpdateTime = FMath::Min(Agent.NextUpdateTime, Agent.LastUpdateTime + GetUpdateInterval(Agent.Significance));
+		}
+	}
+}
+
+ETGAISignificance UTGAISchedulerSubsystem::GetSignificance(const ATGEnemyGrunt* Grunt) const
+{
+	const int32* Index = AgentIndices.Find(Grunt);
+	return Index ? Agents[*Index].Significance : ETGAISignificance::Low;
+}
+
+void UTGAISchedulerSubsystem::GatherPlayerLocations()
+{
+	PlayerLocations.Reset();
+	if (UWorld* World = GetWorld())
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (const APlayerController* PC = It->Get())
+			{
+				if (const APawn* Pawn = PC->GetPawn())
+				{
+					PlayerLocations.Add(Pawn->GetActorLocation());
+				}
+			}
+		}
+	}
+}
+
+void UTGAISchedulerSubsystem::UpdateSignificance(FScheduledAgent& Agent, double Now) const
+{
+	const ATGEnemyGrunt* Grunt = Agent.Grunt.Get();
+	if (!Grunt)
+	{
+		Agent.Significance = ETGAISignificance::Low;
+		return;
+	}
+
+	if (Grunt->IsInCombat())
+	{
+		Agent.Significance = ETGAISignificance::High;
+		return;
+	}
+
+	const FVector Location = Grunt->GetActorLocation();
+	float NearestDistSq = TNumericLimits<float>::Max();
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		NearestDistSq = FMath::Min(NearestDistSq, static_cast<float>(FVector::DistSquared(Location, PlayerLocation)));
+	}
+
+	ETGAISignificance Significance = ETGAISignificance::Low;
+	if (NearestDistSq <= FMath::Square(NearDistance))
+	{
+		Significance = ETGAISignificance::High;
+	}
+	else if (NearestDistSq <= FMath::Square(FarDistance))
+	{
+		Significance = ETGAISignificance::Medium;
+	}
+
+	// Anything a player can see is bumped one tier so reactions do not visibly lag
+	if (Significance != ETGAISignificance::High && Grunt->WasRecentlyRendered(OnScreenTolerance))
+	{
+		Significance = static_cast<ETGAISignificance>(static_cast<uint8>(Significance) + 1);
+	}
+
+	Agent.Significance = Significance;
+}
+
+float UTGAISchedulerSubsystem::GetUpdateInterval(ETGAISignificance Significance) const
+{
+	switch (Significance)
+	{
+		case ETGAISignificance::High:
+			return 0.0f;
+		case ETGAISignificance::Medium:
+			return MediumUpdateInterval;
+		default:
+			return LowUpdateInterval;
+	}
+}
+
+void UTGAISchedulerSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TGAIScheduler);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = FMath::Max(0.0f, CVarTGAIUpdateBudgetMs.GetValueOnGameThread()) * 0.001;
+	const double Now = World->GetTimeSeconds();
+
+	// Drop grunts destroyed without unregistering
+	for (int32 i = Agents.Num() - 1; i >= 0; i--)
+	{
+		if (!Agents[i].Grunt.IsValid())
+		{
+			RemoveAgentAt(i);
+		}
+	}
+	if (Agents.Num() == 0)
+	{
+		return;
+	}
+
+	// Re-rank a rolling slice per frame so ranking cost stays flat as the population grows
+	GatherPlayerLocations();
+	const int32 RefreshCount = FMath::Min(SignificanceRefreshPerFrame, Agents.Num());
+	for (int32 i = 0; i < RefreshCount; i++)
+	{
+		SignificanceCursor = (SignificanceCursor + 1) % Agents.Num();
+		UpdateSignificance(Agents[SignificanceCursor], Now);
+	}
+
+	DueScratch.Reset();
+	for (int32 i = 0; i < Agents.Num(); i++)
+	{
+		if (Agents[i].Significance == ETGAISignificance::High || Now >= Agents[i].NextUpdateTime)
+		{
+			DueScratch.Add(i);
+		}
+	}
+
+	// High significance first, then whoever has waited longest within a tier
+	DueScratch.Sort([this](int32 A, int32 B)
+	{
+		const FScheduledAgent& AgentA = Agents[A];
+		const FScheduledAgent& AgentB = Agents[B];
+		if (AgentA.Significance != AgentB.Significance)
+		{
+			return AgentA.Significance > AgentB.Significance;
+		}
+		return AgentA.LastUpdateTime < AgentB.LastUpdateTime;
+	});
+
+	int32 Updated = 0;
+	int32 BackgroundUpdated = 0;
+	bIsUpdating = true;
+	for (int32 AgentIndex : DueScratch)
+	{
+		const bool bBackground = Agents[AgentIndex].Significance != ETGAISignificance::High;
+		const bool bOverBudget = (FPlatformTime::Seconds() - StartTime) >= BudgetSeconds;
+		if (bOverBudget && (!bBackground || BackgroundUpdated >= MinBackgroundUpdatesPerFrame))
+		{
+			if (bBackground)
+			{
+				break;
+			}
+			// Skip the rest of the high tier; the background floor still gets its share
+			continue;
+		}
+
+		if (ATGEnemyGrunt* Grunt = Agents[AgentIndex].Grunt.Get())
+		{
+			Grunt->RunScheduledAIUpdate();
+		}
+
+		// Re-fetch: the update may have spawned and registered new grunts
+		FScheduledAgent& Agent = Agents[AgentIndex];
+		Agent.LastUpdateTime = Now;
+		Agent.NextUpdateTime = Now + GetUpdateInterval(Agent.Significance);
+		Updated++;
+		BackgroundUpdated += bBackground ? 1 : 0;
+	}
+	bIsUpdating = false;
+
+	LastUpdateCount = Updated;
+	LastDeferredCount = DueScratch.Num() - Updated;
+	LastUpdateTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
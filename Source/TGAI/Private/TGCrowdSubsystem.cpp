@@ -0,0 +1,533 @@
+#include "TGCrowdSubsystem.h"
+#include "TGAI.h"
+#include "TGEnemyGrunt.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "NavigationSystem.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("TG Crowd - Simulate"), STAT_TGCrowdSimulate, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("TG Crowd - Promotion"), STAT_TGCrowdPromotion, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TG Crowd - Agents"), STAT_TGCrowdAgents, STATGROUP_Game);
+
+// Distance at which a patrol target counts as reached
+static constexpr float PatrolArrivalDistance = 100.0f;
+
+void UTGCrowdSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	constexpr int32 InitialCapacity = 512;
+	Positions.Reserve(InitialCapacity);
+	Velocities.Reserve(InitialCapacity);
+	HomeLocations.Reserve(InitialCapacity);
+	PatrolTargets.Reserve(InitialCapacity);
+	States.Reserve(InitialCapacity);
+	GruntClasses.Reserve(InitialCapacity);
+}
+
+void UTGCrowdSubsystem::Deinitialize()
+{
+	// The world tears promoted grunts down itself
+	PromotedGrunts.Empty();
+	ClearCrowd();
+
+	if (VisualActor)
+	{
+		VisualActor->Destroy();
+		VisualActor = nullptr;
+	}
+	VisualComponent = nullptr;
+	VisualInstanceCount = 0;
+	VisualTransforms.Empty();
+	NewVisualInstances.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UTGCrowdSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTGCrowdSubsystem::SpawnCrowdAgent(const FVector& Location, TSubclassOf<ATGEnemyGrunt> GruntClass, UObject* Owner)
+{
+	FVector GroundLocation = Location;
+	ProjectToGround(GroundLocation);
+
+	Positions.Add(GroundLocation);
+	Velocities.Add(FVector::ZeroVector);
+	HomeLocations.Add(GroundLocation);
+	PatrolTargets.Add(PickPatrolTarget(GroundLocation));
+	States.Add(ETGCrowdAgentState::Patrolling);
+	GruntClasses.Add(GruntClass ? GruntClass : TSubclassOf<ATGEnemyGrunt>(ATGEnemyGrunt::StaticClass()));
+	Owners.Add(Owner);
+}
+
+ATGEnemyGrunt* UTGCrowdSubsystem::SpawnEnemy(const FVector& Location, const FRotator& Rotation, TSubclassOf<ATGEnemyGrunt> GruntClass, UObject* Owner)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// Without a known player there is no distance to judge by, so spawn the full actor
+	GatherPlayers();
+	const float PromotionDistSq = FMath::Square(PromotionDistance);
+	bool bDistant = PlayerLocations.Num() > 0;
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		if (FVector::DistSquared2D(Location, PlayerLocation) <= PromotionDistSq)
+		{
+			bDistant = false;
+			break;
+		}
+	}
+
+	if (bDistant)
+	{
+		SpawnCrowdAgent(Location, GruntClass, Owner);
+		return nullptr;
+	}
+
+	return World->SpawnActor<ATGEnemyGrunt>(GruntClass ? GruntClass : TSubclassOf<ATGEnemyGrunt>(ATGEnemyGrunt::StaticClass()), Location, Rotation);
+}
+
+void UTGCrowdSubsystem::ClearCrowd(UObject* Owner)
+{
+	// Descending so swap-removal does not disturb indices still to be visited
+	for (int32 i = Positions.Num() - 1; i >= 0; i--)
+	{
+		if (!Owner || Owners[i].Get() == Owner)
+		{
+			RemoveAgentAt(i);
+		}
+	}
+
+	for (int32 i = PromotedGrunts.Num() - 1; i >= 0; i--)
+	{
+		const FPromotedGrunt& Entry = PromotedGrunts[i];
+		if (Owner && Entry.Owner.Get() != Owner)
+		{
+			continue;
+		}
+
+		if (ATGEnemyGrunt* Grunt = Entry.Grunt.Get())
+		{
+			if (AController* Controller = Grunt->GetController())
+			{
+				Controller->Destroy();
+			}
+			Grunt->Destroy();
+		}
+		PromotedGrunts.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	}
+
+	// Scratch is indexed by the pre-removal layout
+	NearestPlayerDistSq.Reset();
+	NearestPlayerIndex.Reset();
+
+	UpdateVisuals();
+}
+
+void UTGCrowdSubsystem::Tick(float DeltaTime)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	GatherPlayers();
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TGCrowdSimulate);
+		if (Positions.Num() > 0)
+		{
+			RebuildGrid();
+			ComputeSteering(DeltaTime);
+			Integrate(DeltaTime);
+		}
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TGCrowdPromotion);
+		// Promote first: it reads this frame's nearest-player scratch, which demotion invalidates by appending agents
+		PromoteNearbyAgents();
+		DemoteDistantGrunts();
+	}
+
+	UpdateVisuals();
+
+	SET_DWORD_STAT(STAT_TGCrowdAgents, Positions.Num());
+	LastSimulationTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+void UTGCrowdSubsystem::GatherPlayers()
+{
+	PlayerLocations.Reset();
+	if (UWorld* World = GetWorld())
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (const APlayerController* PC = It->Get())
+			{
+				if (const APawn* Pawn = PC->GetPawn())
+				{
+					PlayerLocations.Add(Pawn->GetActorLocation());
+				}
+			}
+		}
+	}
+}
+
+FIntPoint UTGCrowdSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / AvoidanceRadius), FMath::FloorToInt(Location.Y / AvoidanceRadius));
+}
+
+void UTGCrowdSubsystem::RebuildGrid()
+{
+	CellHeads.Reset();
+	NextInCell.SetNumUninitialized(Positions.Num());
+
+	for (int32 i = 0; i < Positions.Num(); i++)
+	{
+		int32& Head = CellHeads.FindOrAdd(GetCell(Positions[i]), INDEX_NONE);
+		NextInCell[i] = Head;
+		Head = i;
+	}
+}
+
+void UTGCrowdSubsystem::ComputeSteering(float DeltaTime)
+{
+	const int32 Count = Positions.Num();
+	SteeredVelocities.SetNumUninitialized(Count);
+	NearestPlayerDistSq.SetNumUninitialized(Count);
+	NearestPlayerIndex.SetNumUninitialized(Count);
+
+	const float ChaseRangeSq = FMath::Square(ChaseRange);
+	const float AvoidanceRadiusSq = FMath::Square(AvoidanceRadius);
+	const int32 NumBatches = FMath::DivideAndRoundUp(Count, SteeringBatchSize);
+
+	// Read-only over shared state; each batch writes only its own agents' scratch entries
+	ParallelFor(NumBatches, [this, Count, ChaseRangeSq, AvoidanceRadiusSq](int32 BatchIndex)
+	{
+		const int32 First = BatchIndex * SteeringBatchSize;
+		const int32 Last = FMath::Min(First + SteeringBatchSize, Count);
+
+		for (int32 i = First; i < Last; i++)
+		{
+			const FVector& Position = Positions[i];
+
+			float BestDistSq = TNumericLimits<float>::Max();
+			int32 BestPlayer = INDEX_NONE;
+			for (int32 p = 0; p < PlayerLocations.Num(); p++)
+			{
+				const float DistSq = static_cast<float>(FVector::DistSquared2D(Position, PlayerLocations[p]));
+				if (DistSq < BestDistSq)
+				{
+					BestDistSq = DistSq;
+					BestPlayer = p;
+				}
+			}
+			NearestPlayerDistSq[i] = BestDistSq;
+			NearestPlayerIndex[i] = BestPlayer;
+
+			const bool bChasing = BestPlayer != INDEX_NONE && BestDistSq <= ChaseRangeSq;
+			const FVector Goal = bChasing ? PlayerLocations[BestPlayer] : PatrolTargets[i];
+			FVector Desired = (Goal - Position).GetSafeNormal2D() * MoveSpeed;
+
+			// Separation from neighbours in the surrounding 3x3 cells
+			FVector Separation = FVector::ZeroVector;
+			const FIntPoint Cell = GetCell(Position);
+			for (int32 dx = -1; dx <= 1; dx++)
+			{
+				for (int32 dy = -1; dy <= 1; dy++)
+				{
+					const int32* Head = CellHeads.Find(FIntPoint(Cell.X + dx, Cell.Y + dy));
+					for (int32 Other = Head ? *Head : INDEX_NONE; Other != INDEX_NONE; Other = NextInCell[Other])
+					{
+						if (Other == i)
+						{
+							continue;
+						}
+						const FVector Away = Position - Positions[Other];
+						const float DistSq = static_cast<float>(Away.SizeSquared2D());
+						if (DistSq < AvoidanceRadiusSq && DistSq > KINDA_SMALL_NUMBER)
+						{
+							// Stronger push the closer the neighbour
+							const float Dist = FMath::Sqrt(DistSq);
+							Separation += FVector(Away.X, Away.Y, 0.0f) / Dist * (1.0f - Dist / AvoidanceRadius);
+						}
+					}
+				}
+			}
+
+			Desired += Separation * MoveSpeed * AvoidanceWeight;
+			SteeredVelocities[i] = Desired.GetClampedToMaxSize2D(MoveSpeed);
+		}
+	});
+}
+
+void UTGCrowdSubsystem::Integrate(float DeltaTime)
+{
+	const float ChaseRangeSq = FMath::Square(ChaseRange);
+	const float ArrivalSq = FMath::Square(PatrolArrivalDistance);
+
+	// A window of agents is put back on the ground each frame; the rest keep their last height
+	const int32 Count = Positions.Num();
+	const int32 NumProjections = FMath::Min(GroundProjectionsPerFrame, Count);
+	const int32 ProjectionStart = NextGroundProjection % FMath::Max(Count, 1);
+	NextGroundProjection = ProjectionStart + NumProjections;
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		const FVector Previous = Positions[i];
+		Velocities[i] = SteeredVelocities[i];
+		Positions[i] += Velocities[i] * DeltaTime;
+
+		const int32 Offset = (i - ProjectionStart + Count) % Count;
+		if (Offset < NumProjections && !ProjectToGround(Positions[i]))
+		{
+			// Stepped off the navmesh or ground; stay put and head somewhere else
+			Positions[i] = Previous;
+			Velocities[i] = FVector::ZeroVector;
+			PatrolTargets[i] = PickPatrolTarget(HomeLocations[i]);
+		}
+
+		States[i] = (NearestPlayerIndex[i] != INDEX_NONE && NearestPlayerDistSq[i] <= ChaseRangeSq)
+			? ETGCrowdAgentState::Chasing
+			: ETGCrowdAgentState::Patrolling;
+
+		// Random picks stay on the game thread
+		if (States[i] == ETGCrowdAgentState::Patrolling && FVector::DistSquared2D(Positions[i], PatrolTargets[i]) <= ArrivalSq)
+		{
+			PatrolTargets[i] = PickPatrolTarget(HomeLocations[i]);
+		}
+	}
+}
+
+FVector UTGCrowdSubsystem::PickPatrolTarget(const FVector& Home) const
+{
+	const FVector RandomDirection = FVector(FMath::RandRange(-1.0f, 1.0f), FMath::RandRange(-1.0f, 1.0f), 0.0f).GetSafeNormal();
+	return Home + RandomDirection * FMath::RandRange(PatrolRadius * 0.3f, PatrolRadius);
+}
+
+bool UTGCrowdSubsystem::ProjectToGround(FVector& InOutLocation) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	if (NavSys && NavSys->GetDefaultNavDataInstance())
+	{
+		FNavLocation NavLocation;
+		if (!NavSys->ProjectPointToNavigation(InOutLocation, NavLocation, FVector(PatrolArrivalDistance, PatrolArrivalDistance, GroundProjectionHeight)))
+		{
+			return false;
+		}
+		InOutLocation = NavLocation.Location;
+		return true;
+	}
+
+	// No navmesh: follow the static ground under the agent
+	FHitResult Hit;
+	const FVector Up(0.0f, 0.0f, GroundProjectionHeight);
+	if (!World->LineTraceSingleByObjectType(Hit, InOutLocation + Up, InOutLocation - Up, FCollisionObjectQueryParams(ECC_WorldStatic)))
+	{
+		return false;
+	}
+	InOutLocation.Z = Hit.ImpactPoint.Z;
+	return true;
+}
+
+void UTGCrowdSubsystem::PromoteNearbyAgents()
+{
+	UWorld* World = GetWorld();
+	if (!World || Positions.Num() == 0 || NearestPlayerDistSq.Num() != Positions.Num())
+	{
+		return;
+	}
+
+	const float PromotionDistSq = FMath::Square(PromotionDistance);
+	int32 Promoted = 0;
+	TArray<ATGEnemyGrunt*, TInlineAllocator<8>> PromotedThisFrame;
+
+	// Descending so swap-removal does not disturb indices still to be visited
+	for (int32 i = Positions.Num() - 1; i >= 0; i--)
+	{
+		if (Promoted >= MaxPromotionsPerFrame || PromotedGrunts.Num() >= MaxPromotedGrunts)
+		{
+			break;
+		}
+		if (NearestPlayerDistSq[i] > PromotionDistSq)
+		{
+			continue;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		const FRotator Facing = Velocities[i].IsNearlyZero() ? FRotator::ZeroRotator : Velocities[i].Rotation();
+
+		ATGEnemyGrunt* Grunt = World->SpawnActor<ATGEnemyGrunt>(GruntClasses[i], Positions[i], Facing, SpawnParams);
+		if (!Grunt)
+		{
+			UE_LOG(LogTGAI, Warning, TEXT("Crowd agent promotion failed at %s"), *Positions[i].ToString());
+			continue;
+		}
+		if (!Grunt->GetController())
+		{
+			Grunt->SpawnDefaultController();
+		}
+
+		FPromotedGrunt& Entry = PromotedGrunts.AddDefaulted_GetRef();
+		Entry.Grunt = Grunt;
+		Entry.GruntClass = GruntClasses[i];
+		Entry.HomeLocation = HomeLocations[i];
+		Entry.Owner = Owners[i];
+
+		RemoveAgentAt(i);
+		Promoted++;
+
+		PromotedThisFrame.Add(Grunt);
+	}
+
+	// Scratch is indexed by the pre-removal layout
+	if (Promoted > 0)
+	{
+		NearestPlayerDistSq.Reset();
+		NearestPlayerIndex.Reset();
+	}
+
+	// Broadcast after the sweep, so handlers may spawn or clear agents
+	for (ATGEnemyGrunt* Grunt : PromotedThisFrame)
+	{
+		if (IsValid(Grunt))
+		{
+			OnGruntPromoted.Broadcast(Grunt);
+		}
+	}
+}
+
+void UTGCrowdSubsystem::DemoteDistantGrunts()
+{
+	const float DemotionDistSq = FMath::Square(DemotionDistance);
+
+	for (int32 i = PromotedGrunts.Num() - 1; i >= 0; i--)
+	{
+		ATGEnemyGrunt* Grunt = PromotedGrunts[i].Grunt.Get();
+		if (!Grunt || Grunt->IsDead())
+		{
+			// Killed grunts leave the crowd for good
+			PromotedGrunts.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+		// Agents carry no health or target, so engaged or wounded grunts stay actors rather than
+		// come back fresh
+		if (Grunt->IsInCombat() || Grunt->GetHealth() < Grunt->GetMaxHealth())
+		{
+			continue;
+		}
+
+		const FVector Location = Grunt->GetActorLocation();
+		bool bNearPlayer = false;
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			if (FVector::DistSquared2D(Location, PlayerLocation) <= DemotionDistSq)
+			{
+				bNearPlayer = true;
+				break;
+			}
+		}
+		if (bNearPlayer)
+		{
+			continue;
+		}
+
+		const FPromotedGrunt Entry = PromotedGrunts[i];
+		PromotedGrunts.RemoveAtSwap(i, 1, EAllowShrinking::No);
+
+		SpawnCrowdAgent(Location, Entry.GruntClass, Entry.Owner.Get());
+		HomeLocations.Last() = Entry.HomeLocation;
+		PatrolTargets.Last() = PickPatrolTarget(Entry.HomeLocation);
+
+		if (AController* Controller = Grunt->GetController())
+		{
+			Controller->Destroy();
+		}
+		Grunt->Destroy();
+	}
+}
+
+void UTGCrowdSubsystem::UpdateVisuals()
+{
+	if (!CrowdMesh)
+	{
+		return;
+	}
+
+	if (!VisualComponent)
+	{
+		UWorld* World = GetWorld();
+		if (!World)
+		{
+			return;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		VisualActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!VisualActor)
+		{
+			return;
+		}
+
+		VisualComponent = NewObject<UInstancedStaticMeshComponent>(VisualActor);
+		VisualComponent->SetStaticMesh(CrowdMesh);
+		VisualComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		VisualComponent->SetMobility(EComponentMobility::Movable);
+		VisualActor->SetRootComponent(VisualComponent);
+		VisualComponent->RegisterComponent();
+	}
+
+	VisualTransforms.Reset();
+	VisualTransforms.Reserve(FMath::Max(Positions.Num(), VisualInstanceCount));
+	for (int32 i = 0; i < Positions.Num(); i++)
+	{
+		const FRotator Facing = Velocities[i].IsNearlyZero() ? FRotator::ZeroRotator : Velocities[i].Rotation();
+		VisualTransforms.Emplace(Facing, Positions[i]);
+	}
+
+	// Grow the pool only; surplus instances are collapsed to zero scale instead of removed
+	if (VisualTransforms.Num() > VisualInstanceCount)
+	{
+		NewVisualInstances.Reset();
+		NewVisualInstances.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), VisualTransforms.Num() - VisualInstanceCount);
+		VisualComponent->AddInstances(NewVisualInstances, false, true);
+		VisualInstanceCount = VisualTransforms.Num();
+	}
+	while (VisualTransforms.Num() < VisualInstanceCount)
+	{
+		VisualTransforms.Emplace(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+	}
+
+	if (VisualTransforms.Num() > 0)
+	{
+		VisualComponent->BatchUpdateInstancesTransforms(0, VisualTransforms, true, true, false);
+	}
+}
+
+void UTGCrowdSubsystem::RemoveAgentAt(int32 Index)
+{
+	Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HomeLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PatrolTargets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	States.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GruntClasses.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Owners.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
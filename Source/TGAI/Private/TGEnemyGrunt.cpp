@@ -7,12 +7,17 @@
 #include "TimerManager.h"
 #include "TGCore/Public/TGPlayPawn.h"
 #include "TGCore/Public/TGPlaytestGameMode.h"
+#include "TGCombat/Public/TGShotQueueSubsystem.h"
+#include "TGCombat/Public/TGWeapon.h"
+#include "TGAISchedulerSubsystem.h"
+#include "TGPerceptionSubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "Kismet/GameplayStatics.h"
 
 ATGEnemyGrunt::ATGEnemyGrunt()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Decisions are driven by UTGAISchedulerSubsystem, not per-actor tick
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Set up AI controller
 	AIControllerClass = AAIController::StaticClass();
@@ -49,19 +54,33 @@ void ATGEnemyGrunt::BeginPlay()
 	// Set detection radius
 	DetectionRadius->SetSphereRadius(DetectionRange);
 
-	// Start AI logic timer
-	GetWorld()->GetTimerManager().SetTimer(PatrolTimerHandle, this, &ATGEnemyGrunt::UpdateAILogic, 0.5f, true);
+	// Significance-ranked, budgeted decision updates; fall back to a fixed timer without the scheduler
+	if (UTGAISchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UTGAISchedulerSubsystem>())
+	{
+		Scheduler->RegisterGrunt(this);
+	}
+	else
+	{
+		GetWorld()->GetTimerManager().SetTimer(PatrolTimerHandle, this, &ATGEnemyGrunt::UpdateAILogic, 0.5f, true);
+	}
 
 	// Start patrolling
 	StartPatrol();
 }
 
-void ATGEnemyGrunt::Tick(float DeltaTime)
+void ATGEnemyGrunt::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	if (UWorld* World = GetWorld())
+	{
+		if (UTGAISchedulerSubsystem* Scheduler = World->GetSubsystem<UTGAISchedulerSubsystem>())
+		{
+			Scheduler->UnregisterGrunt(this);
+		}
+		World->GetTimerManager().ClearTimer(AttackTimerHandle);
+		World->GetTimerManager().ClearTimer(PatrolTimerHandle);
+	}
 
-	// Update AI logic continuously for responsiveness
-	UpdateAILogic();
+	Super::EndPlay(EndPlayReason);
 }
 
 void ATGEnemyGrunt::OnDetectionRadiusBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -73,7 +92,7 @@ void ATGEnemyGrunt::OnDetectionRadiusBeginOverlap(UPrimitiveComponent* Overlappe
 
 	if (ATGPlayPawn* Player = Cast<ATGPlayPawn>(OtherActor))
 	{
-		if (CanSeeTarget(Player))
+		if (IsTargetInRange(Player, GetDetectionRangeFor(Player)) && CanSeeTarget(Player))
 		{
 			CurrentTarget = Player;
 			StartChase();
@@ -111,10 +130,18 @@ void ATGEnemyGrunt::UpdateAILogic()
 	{
 		case EEnemyState::Patrolling:
 		{
-			// Look for nearby targets
-			if (CurrentTarget && IsValid(CurrentTarget) && CanSeeTarget(CurrentTarget))
+			// Look for nearby targets; players that were hidden or out of range when they entered
+			// the detection radius are picked up here once they are seen within their range
+			TArray<AActor*> OverlappingPlayers;
+			DetectionRadius->GetOverlappingActors(OverlappingPlayers, ATGPlayPawn::StaticClass());
+			for (AActor* Player : OverlappingPlayers)
 			{
-				StartChase();
+				if (IsTargetInRange(Player, GetDetectionRangeFor(Player)) && CanSeeTarget(Player))
+				{
+					CurrentTarget = Player;
+					StartChase();
+					break;
+				}
 			}
 			break;
 		}
@@ -130,7 +157,7 @@ void ATGEnemyGrunt::UpdateAILogic()
 			{
 				StartAttack();
 			}
-			else if (IsTargetInRange(CurrentTarget, DetectionRange) && CanSeeTarget(CurrentTarget))
+			else if (IsTargetInRange(CurrentTarget, GetDetectionRangeFor(CurrentTarget)) && CanSeeTarget(CurrentTarget))
 			{
 				// Continue chasing
 				MoveTo(CurrentTarget->GetActorLocation());
@@ -169,24 +196,56 @@ void ATGEnemyGrunt::AttackTarget()
 
 	if (IsTargetInRange(CurrentTarget, AttackRange))
 	{
-		// Perform hitscan attack
+		// Perform hitscan attack, batched with every other shot this frame
 		if (ATGPlayPawn* PlayerTarget = Cast<ATGPlayPawn>(CurrentTarget))
 		{
-			PlayerTarget->TakeDamage(Damage);
+			FTGShotRequest Shot;
+			Shot.Start = GetActorLocation() + FVector(0, 0, 60); // Eye height
+			Shot.End = PlayerTarget->GetActorLocation() + FVector(0, 0, 60);
+			Shot.Channel = ECC_Visibility;
+			Shot.QueryParams.AddIgnoredActor(this);
+			Shot.OnResolved.BindUObject(this, &ATGEnemyGrunt::OnAttackTraceResolved, TWeakObjectPtr<ATGPlayPawn>(PlayerTarget));
+
+			UTGShotQueueSubsystem::SubmitShot(GetWorld(), MoveTemp(Shot));
 			OnAttack();
-			
-			UE_LOG(LogTemp, Log, TEXT("Enemy %s attacked player %s for %f damage"), 
-				*GetName(), *PlayerTarget->GetName(), Damage);
 		}
 	}
 }
 
+void ATGEnemyGrunt::OnAttackTraceResolved(bool bHit, const FHitResult& HitResult, TWeakObjectPtr<ATGPlayPawn> PlayerTarget)
+{
+	ATGPlayPawn* Player = PlayerTarget.Get();
+	if (!Player || IsDead())
+	{
+		return;
+	}
+
+	// Nothing in the way, or the first blocking hit is the player
+	if (!bHit || HitResult.GetActor() == Player)
+	{
+		Player->TakeDamage(Damage);
+
+		UE_LOG(LogTemp, Log, TEXT("Enemy %s attacked player %s for %f damage"), 
+			*GetName(), *Player->GetName(), Damage);
+	}
+}
+
 void ATGEnemyGrunt::SetEnemyState(EEnemyState NewState)
 {
 	if (CurrentState != NewState)
 	{
+		const bool bWasInCombat = IsInCombat();
 		CurrentState = NewState;
 		OnStateChanged(CurrentState);
+
+		// Entering or leaving combat changes how often this grunt should think
+		if (bWasInCombat != IsInCombat())
+		{
+			if (UTGAISchedulerSubsystem* Scheduler = GetWorld() ? GetWorld()->GetSubsystem<UTGAISchedulerSubsystem>() : nullptr)
+			{
+				Scheduler->RefreshSignificance(this);
+			}
+		}
 		
 		UE_LOG(LogTemp, Log, TEXT("Enemy %s state changed to %s"), 
 			*GetName(), *UEnum::GetValueAsString(CurrentState));
@@ -240,9 +299,25 @@ bool ATGEnemyGrunt::CanSeeTarget(AActor* Target) const
 		return false;
 	}
 
+	const FVector StartTrace = GetActorLocation() + FVector(0, 0, 60); // Eye height
+
+	// Shared, cached visibility; traces are deduplicated across nearby grunts and run async
+	if (UTGPerceptionSubsystem* Perception = GetWorld()->GetSubsystem<UTGPerceptionSubsystem>())
+	{
+		switch (Perception->QueryVisibility(this, StartTrace, Target))
+		{
+			case ETGVisibility::Visible:
+				return true;
+			case ETGVisibility::Occluded:
+				return false;
+			default:
+				// First query for this cell and target: keep pursuing a current target until the result lands
+				return Target == CurrentTarget && IsInCombat();
+		}
+	}
+
 	// Simple line trace to check if target is visible
 	FHitResult HitResult;
-	FVector StartTrace = GetActorLocation() + FVector(0, 0, 60); // Eye height
 	FVector EndTrace = Target->GetActorLocation() + FVector(0, 0, 60);
 
 	FCollisionQueryParams QueryParams;
@@ -265,6 +340,13 @@ bool ATGEnemyGrunt::IsTargetInRange(AActor* Target, float Range) const
 	return Distance <= Range;
 }
 
+float ATGEnemyGrunt::GetDetectionRangeFor(const AActor* Target) const
+{
+	const ATGPlayPawn* Player = Cast<ATGPlayPawn>(Target);
+	const ATGWeapon* Weapon = Player ? Player->GetEquippedWeapon() : nullptr;
+	return Weapon ? DetectionRange * Weapon->GetLoadoutStats().IRVisibility : DetectionRange;
+}
+
 void ATGEnemyGrunt::TakeDamage(float DamageAmount)
 {
 	if (IsDead())
@@ -289,9 +371,13 @@ void ATGEnemyGrunt::TakeDamage(float DamageAmount)
 			}
 		}
 
-		// Clear all timers
+		// Clear all timers and stop scheduled decisions
 		GetWorld()->GetTimerManager().ClearTimer(AttackTimerHandle);
 		GetWorld()->GetTimerManager().ClearTimer(PatrolTimerHandle);
+		if (UTGAISchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UTGAISchedulerSubsystem>())
+		{
+			Scheduler->UnregisterGrunt(this);
+		}
 
 		// Disable collision
 		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -0,0 +1,238 @@
+#include "TGPerceptionSubsystem.h"
+#include "TGAI.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarTGLogPerceptionStats(
+	TEXT("tg.AI.LogPerceptionStats"),
+	0,
+	TEXT("1 = log AI visibility requests/s against traces/s actually issued, once per second"),
+	ECVF_Default);
+
+// Entries not queried for this many TTLs are dropped
+static constexpr float CacheIdleTTLMultiplier = 10.0f;
+
+void UTGPerceptionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TraceDelegate.BindUObject(this, &UTGPerceptionSubsystem::OnTraceCompleted);
+	Cache.Reserve(256);
+	PendingTraces.Reserve(64);
+}
+
+void UTGPerceptionSubsystem::Deinitialize()
+{
+	// Outstanding async traces are dropped with the world; their callbacks never fire
+	Cache.Empty();
+	PendingTraces.Empty();
+	InFlightTraces.Empty();
+	FreeSlots.Empty();
+	TraceDelegate.Unbind();
+
+	Super::Deinitialize();
+}
+
+bool UTGPerceptionSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+ETGVisibility UTGPerceptionSubsystem::QueryVisibility(const AActor* Observer, const FVector& EyeLocation, const AActor* Target, const FVector& TargetOffset)
+{
+	if (!Target)
+	{
+		return ETGVisibility::Unknown;
+	}
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	WindowRequests++;
+
+	FPerceptionKey Key;
+	Key.Cell = FIntVector(
+		FMath::FloorToInt(EyeLocation.X / ObserverCellSize),
+		FMath::FloorToInt(EyeLocation.Y / ObserverCellSize),
+		FMath::FloorToInt(EyeLocation.Z / ObserverCellSize));
+	Key.Target = FObjectKey(Target);
+
+	FPerceptionEntry& Entry = Cache.FindOrAdd(Key);
+	Entry.LastQueryTime = Now;
+
+	// A trace whose result never arrived must not pin the entry at its old value
+	const bool bStale = Entry.ResolvedTime < 0.0 || (Now - Entry.ResolvedTime) >= ResultTTL;
+	const bool bPendingLost = Entry.bPending && (Now - Entry.IssuedTime) >= PendingTimeout;
+	if (bStale && (!Entry.bPending || bPendingLost))
+	{
+		// The first observer in the cell supplies the eye point for everyone sharing it
+		FPendingTrace& Pending = PendingTraces.AddDefaulted_GetRef();
+		Pending.Key = Key;
+		Pending.Start = EyeLocation;
+		Pending.End = Target->GetActorLocation() + TargetOffset;
+		Pending.Observer = Observer;
+		Pending.Target = Target;
+		Entry.bPending = true;
+		Entry.IssuedTime = Now;
+	}
+
+	return Entry.Visibility;
+}
+
+void UTGPerceptionSubsystem::Tick(float DeltaTime)
+{
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+	FlushPendingTraces();
+	ExpireInFlightTraces(Now);
+	UpdateStats(Now);
+}
+
+void UTGPerceptionSubsystem::FlushPendingTraces()
+{
+	UWorld* World = GetWorld();
+	if (!World || PendingTraces.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	FCollisionObjectQueryParams ObjectParams;
+	for (const TEnumAsByte<ECollisionChannel> ObjectType : OccluderObjectTypes)
+	{
+		ObjectParams.AddObjectTypesToQuery(ObjectType);
+	}
+
+	for (const FPendingTrace& Pending : PendingTraces)
+	{
+		// Pawns are not queried at all; this only keeps a non-pawn observer from occluding itself
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TGPerceptionTrace), false);
+		if (const AActor* Observer = Pending.Observer.Get())
+		{
+			QueryParams.AddIgnoredActor(Observer);
+		}
+
+		int32 Slot;
+		if (FreeSlots.Num() > 0)
+		{
+			Slot = FreeSlots.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			Slot = InFlightTraces.AddDefaulted();
+		}
+		FInFlightTrace& InFlight = InFlightTraces[Slot];
+		InFlight.Key = Pending.Key;
+		InFlight.Target = Pending.Target;
+		InFlight.IssuedTime = Now;
+		InFlight.Handle = World->AsyncLineTraceByObjectType(
+			EAsyncTraceType::Single,
+			Pending.Start,
+			Pending.End,
+			ObjectParams,
+			QueryParams,
+			&TraceDelegate,
+			static_cast<uint32>(Slot));
+	}
+
+	WindowTraces += PendingTraces.Num();
+	PendingTraces.Reset();
+}
+
+void UTGPerceptionSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const int32 Slot = static_cast<int32>(Datum.UserData);
+	if (!InFlightTraces.IsValidIndex(Slot))
+	{
+		// The entry it was for stays pending only until PendingTimeout queues it again
+		UE_LOG(LogTGAI, Warning, TEXT("Perception received trace result for unknown slot %d"), Slot);
+		return;
+	}
+
+	// A late result for a slot that expired and was reused belongs to an older request
+	if (!(InFlightTraces[Slot].Handle == Handle))
+	{
+		return;
+	}
+
+	const FInFlightTrace InFlight = InFlightTraces[Slot];
+	InFlightTraces[Slot] = FInFlightTrace();
+	FreeSlots.Add(Slot);
+
+	FPerceptionEntry* Entry = Cache.Find(InFlight.Key);
+	if (!Entry)
+	{
+		return;
+	}
+
+	const FHitResult* BlockingHit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	const bool bVisible = !BlockingHit || BlockingHit->GetActor() == InFlight.Target.Get();
+
+	Entry->Visibility = bVisible ? ETGVisibility::Visible : ETGVisibility::Occluded;
+	Entry->bPending = false;
+	if (const UWorld* World = GetWorld())
+	{
+		Entry->ResolvedTime = World->GetTimeSeconds();
+	}
+}
+
+void UTGPerceptionSubsystem::ExpireInFlightTraces(double Now)
+{
+	// Free the slots of traces whose results were dropped, so they do not leak
+	for (int32 Slot = 0; Slot < InFlightTraces.Num(); ++Slot)
+	{
+		FInFlightTrace& InFlight = InFlightTraces[Slot];
+		if (!InFlight.Handle.IsValid() || (Now - InFlight.IssuedTime) < PendingTimeout)
+		{
+			continue;
+		}
+
+		// A newer trace may already be pending for the entry; only clear the one this slot issued
+		FPerceptionEntry* Entry = Cache.Find(InFlight.Key);
+		if (Entry && Entry->bPending && Entry->IssuedTime <= InFlight.IssuedTime)
+		{
+			Entry->bPending = false;
+		}
+
+		InFlight = FInFlightTrace();
+		FreeSlots.Add(Slot);
+	}
+}
+
+void UTGPerceptionSubsystem::PruneCache(double Now)
+{
+	const double IdleLimit = FMath::Max(ResultTTL, 0.05f) * CacheIdleTTLMultiplier;
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		const FPerceptionEntry& Entry = It.Value();
+		if (!Entry.bPending && (Now - Entry.LastQueryTime) > IdleLimit)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UTGPerceptionSubsystem::UpdateStats(double Now)
+{
+	const double Elapsed = Now - WindowStartTime;
+	if (Elapsed < 1.0)
+	{
+		return;
+	}
+
+	RequestsPerSecond = static_cast<float>(WindowRequests / Elapsed);
+	TracesPerSecond = static_cast<float>(WindowTraces / Elapsed);
+
+	if (CVarTGLogPerceptionStats.GetValueOnGameThread() != 0)
+	{
+		UE_LOG(LogTGAI, Log, TEXT("Perception: %.0f requests/s (synchronous traces before), %.0f traces/s issued, %d cached"),
+			RequestsPerSecond, TracesPerSecond, Cache.Num());
+	}
+
+	WindowRequests = 0;
+	WindowTraces = 0;
+	WindowStartTime = Now;
+
+	// Piggyback on the once-per-second window to keep the cache bounded
+	PruneCache(Now);
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "TGAISchedulerSubsystem.generated.h"
+
+class ATGEnemyGrunt;
+
+UENUM(BlueprintType)
+enum class ETGAISignificance : uint8
+{
+	Low		UMETA(DisplayName = "Low"),
+	Medium	UMETA(DisplayName = "Medium"),
+	High	UMETA(DisplayName = "High")
+};
+
+/**
+ * AI Scheduler Subsystem
+ * Ranks registered grunts by significance (distance to the nearest player, on screen, in combat)
+ * and runs their decision logic from one place: high significance every frame, lower tiers at
+ * reduced rates, all inside a global per-frame budget with oldest-first round-robin fairness.
+ */
+UCLASS()
+class TGAI_API UTGAISchedulerSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGAISchedulerSubsystem, STATGROUP_Tickables); }
+	virtual bool IsTickable() const override { return !IsTemplate() && Agents.Num() > 0; }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+	void RegisterGrunt(ATGEnemyGrunt* Grunt);
+	void UnregisterGrunt(ATGEnemyGrunt* Grunt);
+
+	/** Re-rank a grunt immediately (e.g. it entered or left combat) instead of waiting for its refresh slot */
+	void RefreshSignificance(ATGEnemyGrunt* Grunt);
+
+	UFUNCTION(BlueprintPure, Category = "AI|Scheduler")
+	int32 GetRegisteredCount() const { return Agents.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "AI|Scheduler")
+	ETGAISignificance GetSignificance(const ATGEnemyGrunt* Grunt) const;
+
+	// Configuration
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Scheduler")
+	float NearDistance = 2500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Scheduler")
+	float FarDistance = 8000.0f;
+
+	/** Seconds between updates for medium significance grunts */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Scheduler")
+	float MediumUpdateInterval = 0.25f;
+
+	/** Seconds between updates for low significance grunts */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Scheduler")
+	float LowUpdateInterval = 1.0f;
+
+	/** Grunts re-ranked per frame; the rest keep their previous significance */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Scheduler", meta = (ClampMin = "1"))
+	int32 SignificanceRefreshPerFrame = 64;
+
+	/** Lower-tier updates guaranteed each frame even when high significance grunts use the whole budget */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Scheduler", meta = (ClampMin = "0"))
+	int32 MinBackgroundUpdatesPerFrame = 2;
+
+	// Stats
+	int32 GetLastUpdateCount() const { return LastUpdateCount; }
+	int32 GetLastDeferredCount() const { return LastDeferredCount; }
+	double GetLastUpdateTimeMs() const { return LastUpdateTimeMs; }
+
+private:
+	struct FScheduledAgent
+	{
+		TWeakObjectPtr<ATGEnemyGrunt> Grunt;
+		ETGAISignificance Significance = ETGAISignificance::High;
+		double LastUpdateTime = 0.0;
+		double NextUpdateTime = 0.0;
+	};
+
+	TArray<FScheduledAgent> Agents;
+	TMap<const ATGEnemyGrunt*, int32> AgentIndices;
+
+	// Player viewpoints gathered once per frame for ranking
+	TArray<FVector> PlayerLocations;
+
+	int32 SignificanceCursor = 0;
+	bool bIsUpdating = false;
+	TArray<int32> DueScratch;
+
+	int32 LastUpdateCount = 0;
+	int32 LastDeferredCount = 0;
+	double LastUpdateTimeMs = 0.0;
+
+	void GatherPlayerLocations();
+	void UpdateSignificance(FScheduledAgent& Agent, double Now) const;
+	float GetUpdateInterval(ETGAISignificance Significance) const;
+	void RemoveAgentAt(int32 Index);
+};
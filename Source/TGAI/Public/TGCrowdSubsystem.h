@@ -0,0 +1,185 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "TGCrowdSubsystem.generated.h"
+
+class ATGEnemyGrunt;
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+
+UENUM(BlueprintType)
+enum class ETGCrowdAgentState : uint8
+{
+	Patrolling	UMETA(DisplayName = "Patrolling"),
+	Chasing		UMETA(DisplayName = "Chasing")
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FTGOnCrowdGruntPromoted, ATGEnemyGrunt*, Grunt);
+
+/**
+ * Crowd Subsystem
+ * Lightweight simulation for distant and background enemies. Agents live in parallel arrays and
+ * run patrol, chase and separation steering without actors, components or timers, and are kept on
+ * the navmesh (or the ground, without one) by a few round-robin projections per frame; they are
+ * drawn through one pooled instanced mesh. Agents near a player are promoted to full
+ * ATGEnemyGrunt actors, and idle grunts far from every player are demoted back into the crowd.
+ */
+UCLASS()
+class TGAI_API UTGCrowdSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGCrowdSubsystem, STATGROUP_Tickables); }
+	virtual bool IsTickable() const override { return !IsTemplate() && (Positions.Num() > 0 || PromotedGrunts.Num() > 0); }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+	/**
+	 * Adds a background enemy; it becomes a GruntClass actor when a player comes close. Owner
+	 * scopes the agent, and the grunt it becomes, for ClearCrowd.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI|Crowd")
+	void SpawnCrowdAgent(const FVector& Location, TSubclassOf<ATGEnemyGrunt> GruntClass, UObject* Owner = nullptr);
+
+	/**
+	 * Spawns an enemy where it belongs: a GruntClass actor within PromotionDistance of a player
+	 * (or while no player is known), otherwise a crowd agent owned by Owner. Returns the actor,
+	 * or null if the enemy joined the crowd.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI|Crowd")
+	ATGEnemyGrunt* SpawnEnemy(const FVector& Location, const FRotator& Rotation, TSubclassOf<ATGEnemyGrunt> GruntClass, UObject* Owner = nullptr);
+
+	/**
+	 * Removes Owner's crowd agents and destroys the grunts promoted from them; other spawners'
+	 * enemies are left alone. A null Owner clears the whole crowd of this world.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI|Crowd")
+	void ClearCrowd(UObject* Owner = nullptr);
+
+	/** Enemies that exist only as crowd agents; add these to any count of live enemy actors */
+	UFUNCTION(BlueprintPure, Category = "AI|Crowd")
+	int32 GetCrowdAgentCount() const { return Positions.Num(); }
+
+	/** Fires for each grunt actor spawned from a crowd agent, so spawners can track it */
+	UPROPERTY(BlueprintAssignable, Category = "AI|Crowd")
+	FTGOnCrowdGruntPromoted OnGruntPromoted;
+
+	UFUNCTION(BlueprintPure, Category = "AI|Crowd")
+	int32 GetPromotedGruntCount() const { return PromotedGrunts.Num(); }
+
+	// Configuration
+	/** Mesh drawn for crowd agents; null = agents are simulated but invisible */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd")
+	UStaticMesh* CrowdMesh = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd")
+	float MoveSpeed = 300.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd")
+	float PatrolRadius = 1000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd")
+	float ChaseRange = 6000.0f;
+
+	/** Agents closer than this to each other steer apart */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd", meta = (ClampMin = "1.0"))
+	float AvoidanceRadius = 150.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd")
+	float AvoidanceWeight = 1.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd")
+	float PromotionDistance = 3000.0f;
+
+	/** Must exceed PromotionDistance so agents do not flip back and forth at the boundary */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd")
+	float DemotionDistance = 4500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd", meta = (ClampMin = "0"))
+	int32 MaxPromotedGrunts = 48;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd", meta = (ClampMin = "1"))
+	int32 MaxPromotionsPerFrame = 4;
+
+	/** Agents snapped onto the navmesh (or traced to the ground) per frame, round robin */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd", meta = (ClampMin = "0"))
+	int32 GroundProjectionsPerFrame = 64;
+
+	/** Vertical reach of a navmesh projection or ground trace */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd", meta = (ClampMin = "1.0"))
+	float GroundProjectionHeight = 500.0f;
+
+	/** Agents per parallel steering batch */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Crowd", meta = (ClampMin = "1"))
+	int32 SteeringBatchSize = 128;
+
+	// Stats
+	double GetLastSimulationTimeMs() const { return LastSimulationTimeMs; }
+
+private:
+	// Structure-of-arrays agent state (all arrays share one index space)
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<FVector> HomeLocations;
+	TArray<FVector> PatrolTargets;
+	TArray<ETGCrowdAgentState> States;
+	TArray<TSubclassOf<ATGEnemyGrunt>> GruntClasses;
+	TArray<TWeakObjectPtr<UObject>> Owners;
+
+	// Per-frame scratch
+	TArray<FVector> SteeredVelocities;
+	TArray<float> NearestPlayerDistSq;
+	TArray<int32> NearestPlayerIndex;
+	TArray<FVector> PlayerLocations;
+
+	// Uniform grid for separation, rebuilt each frame as per-cell linked lists
+	TMap<FIntPoint, int32> CellHeads;
+	TArray<int32> NextInCell;
+
+	struct FPromotedGrunt
+	{
+		TWeakObjectPtr<ATGEnemyGrunt> Grunt;
+		TSubclassOf<ATGEnemyGrunt> GruntClass;
+		FVector HomeLocation;
+		TWeakObjectPtr<UObject> Owner;
+	};
+	TArray<FPromotedGrunt> PromotedGrunts;
+
+	// Pooled visuals
+	UPROPERTY()
+	AActor* VisualActor = nullptr;
+
+	UPROPERTY()
+	UInstancedStaticMeshComponent* VisualComponent = nullptr;
+
+	int32 VisualInstanceCount = 0;
+
+	// Instance transforms, reused across frames
+	TArray<FTransform> VisualTransforms;
+	TArray<FTransform> NewVisualInstances;
+
+	int32 NextGroundProjection = 0;
+
+	double LastSimulationTimeMs = 0.0;
+
+	void GatherPlayers();
+	void RebuildGrid();
+	void ComputeSteering(float DeltaTime);
+	void Integrate(float DeltaTime);
+	void PromoteNearbyAgents();
+	void DemoteDistantGrunts();
+	void UpdateVisuals();
+	void RemoveAgentAt(int32 Index);
+	FVector PickPatrolTarget(const FVector& Home) const;
+	bool ProjectToGround(FVector& InOutLocation) const;
+	FIntPoint GetCell(const FVector& Location) const;
+};
@@ -26,6 +26,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI")
@@ -76,7 +77,7 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "AI")
 	FVector StartLocation;
 
-	// Timers
+	// Timers (attack cadence; PatrolTimerHandle only drives decisions when no AI scheduler exists)
 	FTimerHandle AttackTimerHandle;
 	FTimerHandle PatrolTimerHandle;
 
@@ -93,6 +94,8 @@ protected:
 	UFUNCTION()
 	void AttackTarget();
 
+	void OnAttackTraceResolved(bool bHit, const FHitResult& HitResult, TWeakObjectPtr<class ATGPlayPawn> PlayerTarget);
+
 	void SetEnemyState(EEnemyState NewState);
 
 	void StartPatrol();
@@ -107,9 +110,10 @@ protected:
 
 	bool IsTargetInRange(AActor* Target, float Range) const;
 
-public:
-	virtual void Tick(float DeltaTime) override;
+	// DetectionRange scaled by the IR visibility of the target's weapon loadout
+	float GetDetectionRangeFor(const AActor* Target) const;
 
+public:
 	// Public Interface
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void TakeDamage(float DamageAmount);
@@ -120,9 +124,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AI")
 	EEnemyState GetCurrentState() const { return CurrentState; }
 
+	UFUNCTION(BlueprintPure, Category = "AI")
+	bool IsInCombat() const { return CurrentState == EEnemyState::Chasing || CurrentState == EEnemyState::Attacking; }
+
+	// Decision update, called by UTGAISchedulerSubsystem at the rate this grunt's significance allows
+	void RunScheduledAIUpdate() { UpdateAILogic(); }
+
 	UFUNCTION(BlueprintPure, Category = "Combat")
 	float GetHealth() const { return Health; }
 
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	float GetMaxHealth() const { return MaxHealth; }
+
 	UFUNCTION(BlueprintPure, Category = "Combat")
 	bool IsDead() const { return CurrentState == EEnemyState::Dead || Health <= 0.0f; }
 
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+#include "TGPerceptionSubsystem.generated.h"
+
+UENUM(BlueprintType)
+enum class ETGVisibility : uint8
+{
+	Unknown		UMETA(DisplayName = "Unknown"),
+	Visible		UMETA(DisplayName = "Visible"),
+	Occluded	UMETA(DisplayName = "Occluded")
+};
+
+/**
+ * Perception Subsystem
+ * Shared line-of-sight service for AI. Requests are deduplicated by (observer cell, target),
+ * resolved as batched async traces at the end of the frame, and cached for a short TTL.
+ * Readers get the cached bit immediately; stale entries keep their last value until refreshed.
+ */
+UCLASS()
+class TGAI_API UTGPerceptionSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGPerceptionSubsystem, STATGROUP_Tickables); }
+	virtual bool IsTickable() const override { return !IsTemplate(); }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+	/**
+	 * Cached visibility of Target from EyeLocation. Queues a refresh when the entry is missing or
+	 * older than the TTL; returns Unknown only until the first trace for this cell and target lands.
+	 */
+	ETGVisibility QueryVisibility(const AActor* Observer, const FVector& EyeLocation, const AActor* Target, const FVector& TargetOffset = FVector(0, 0, 60));
+
+	// Configuration
+	/** Observers within the same cell share one trace per target */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Perception", meta = (ClampMin = "1.0"))
+	float ObserverCellSize = 200.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Perception", meta = (ClampMin = "0.0"))
+	float ResultTTL = 0.2f;
+
+	/**
+	 * Object types that block line of sight. Pawns are left out: one result is shared by every
+	 * observer in a cell, so no observer's own body may occlude it for the others.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Perception")
+	TArray<TEnumAsByte<ECollisionChannel>> OccluderObjectTypes = { ECC_WorldStatic, ECC_WorldDynamic };
+
+	/** A trace with no result after this long is treated as lost and queued again */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Perception", meta = (ClampMin = "0.0"))
+	float PendingTimeout = 0.5f;
+
+	// Stats (per second over the last full window)
+	/** Visibility requests; each was one synchronous trace before this service */
+	float GetRequestsPerSecond() const { return RequestsPerSecond; }
+	/** Traces actually issued after dedupe and caching */
+	float GetTracesPerSecond() const { return TracesPerSecond; }
+	int32 GetCachedEntryCount() const { return Cache.Num(); }
+
+private:
+	struct FPerceptionKey
+	{
+		FIntVector Cell;
+		FObjectKey Target;
+
+		bool operator==(const FPerceptionKey& Other) const { return Cell == Other.Cell && Target == Other.Target; }
+		friend uint32 GetTypeHash(const FPerceptionKey& Key) { return HashCombine(GetTypeHash(Key.Cell), GetTypeHash(Key.Target)); }
+	};
+
+	struct FPerceptionEntry
+	{
+		ETGVisibility Visibility = ETGVisibility::Unknown;
+		double ResolvedTime = -1.0;
+		double LastQueryTime = 0.0;
+		double IssuedTime = 0.0;
+		bool bPending = false;
+	};
+
+	struct FPendingTrace
+	{
+		FPerceptionKey Key;
+		FVector Start;
+		FVector End;
+		TWeakObjectPtr<const AActor> Observer;
+		TWeakObjectPtr<const AActor> Target;
+	};
+
+	struct FInFlightTrace
+	{
+		FPerceptionKey Key;
+		TWeakObjectPtr<const AActor> Target;
+		FTraceHandle Handle;
+		double IssuedTime = 0.0;
+	};
+
+	TMap<FPerceptionKey, FPerceptionEntry> Cache;
+	TArray<FPendingTrace> PendingTraces;
+
+	/** Submitted traces awaiting results, indexed by the trace UserData */
+	TArray<FInFlightTrace> InFlightTraces;
+	TArray<int32> FreeSlots;
+
+	FTraceDelegate TraceDelegate;
+
+	// Rolling stats window
+	int32 WindowRequests = 0;
+	int32 WindowTraces = 0;
+	double WindowStartTime = 0.0;
+	float RequestsPerSecond = 0.0f;
+	float TracesPerSecond = 0.0f;
+
+	void FlushPendingTraces();
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+	void PruneCache(double Now);
+	void ExpireInFlightTraces(double Now);
+	void UpdateStats(double Now);
+};
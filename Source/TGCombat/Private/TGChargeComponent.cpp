@@ -1,8 +1,15 @@
 #include "TGChargeComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+// Timers fire on frame boundaries; this margin guarantees the resampled charge is past the threshold
+static constexpr float ChargeCrossingMargin = 0.001f;
 
 UTGChargeComponent::UTGChargeComponent() {
-  PrimaryComponentTick.bCanEverTick = true;
+  // Charge is evaluated analytically and threshold crossings are timer driven
+  PrimaryComponentTick.bCanEverTick = false;
   CurrentCharge = 0.0f;
+  ChargeTimestamp = 0.0f;
   CurrentChargeState = EChargeState::Discharged;
   bIsCharging = false;
   bIsEMPDisrupted = false;
@@ -11,62 +18,74 @@ UTGChargeComponent::UTGChargeComponent() {
 
 void UTGChargeComponent::BeginPlay() {
   Super::BeginPlay();
+  ChargeTimestamp = GetWorldTime();
   UpdateChargeState();
+  ScheduleNextThresholdCrossing();
 }
 
-void UTGChargeComponent::TickComponent(
-    float DeltaTime, ELevelTick TickType,
-    FActorComponentTickFunction *ThisTickFunction) {
-  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-  ProcessEMPDisruption(DeltaTime);
-
-  if (bIsCharging && !bIsEMPDisrupted) {
-    CurrentCharge =
-        FMath::Clamp(CurrentCharge + (ChargeRate * DeltaTime), 0.0f, MaxCharge);
-    UpdateChargeState();
-  } else if (!bIsCharging && CurrentCharge > 0.f) {
-    CurrentCharge =
-        FMath::Max(0.0f, CurrentCharge - (DischargeRate * DeltaTime));
-    UpdateChargeState();
+void UTGChargeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  if (UWorld *World = GetWorld()) {
+    World->GetTimerManager().ClearTimer(ChargeTimerHandle);
+    World->GetTimerManager().ClearTimer(EMPTimerHandle);
   }
+  Super::EndPlay(EndPlayReason);
 }
 
-void UTGChargeComponent::StartCharging() { bIsCharging = true; }
+void UTGChargeComponent::StartCharging() {
+  ResampleCharge();
+  bIsCharging = true;
+  UpdateChargeState();
+  ScheduleNextThresholdCrossing();
+}
 
-void UTGChargeComponent::StopCharging() { bIsCharging = false; }
+void UTGChargeComponent::StopCharging() {
+  ResampleCharge();
+  bIsCharging = false;
+  UpdateChargeState();
+  ScheduleNextThresholdCrossing();
+}
 
 void UTGChargeComponent::DischargeWeapon() {
   CurrentCharge = 0.0f;
+  ChargeTimestamp = GetWorldTime();
   UpdateChargeState();
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGChargeComponent::DrainCharge(float ChargeAmount) {
+  ResampleCharge();
   CurrentCharge = FMath::Clamp(CurrentCharge - FMath::Max(0.0f, ChargeAmount),
                                0.0f, MaxCharge);
   UpdateChargeState();
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGChargeComponent::ForceOvercharge() {
   CurrentCharge = MaxCharge;
+  ChargeTimestamp = GetWorldTime();
   EChargeState OldState = CurrentChargeState;
   CurrentChargeState = EChargeState::Overcharged;
   OnOverchargeTriggered.Broadcast();
   OnChargeStateChanged.Broadcast(OldState, CurrentChargeState);
+  ScheduleNextThresholdCrossing();
+}
+
+float UTGChargeComponent::GetCurrentCharge() const {
+  return EvaluateChargeAt(GetWorldTime());
 }
 
 float UTGChargeComponent::GetChargePercentage() const {
-  return (MaxCharge > 0.0f) ? (CurrentCharge / MaxCharge) : 0.0f;
+  return (MaxCharge > 0.0f) ? (GetCurrentCharge() / MaxCharge) : 0.0f;
 }
 
 bool UTGChargeComponent::IsCharging() const { return bIsCharging; }
 
 bool UTGChargeComponent::IsFullyCharged() const {
-  return CurrentCharge >= ChargedThreshold;
+  return GetCurrentCharge() >= ChargedThreshold;
 }
 
 bool UTGChargeComponent::CanFire() const {
-  return !bIsEMPDisrupted && CurrentCharge >= MinChargeToFire &&
+  return !bIsEMPDisrupted && GetCurrentCharge() >= MinChargeToFire &&
          CurrentChargeState != EChargeState::Overcharged;
 }
 
@@ -78,22 +97,39 @@ void UTGChargeComponent::ApplyEMPDisruption(float DisruptionStrength,
                                             float Duration) {
   const float ClampedStrength =
       FMath::Clamp(DisruptionStrength * EMPVulnerability, 0.0f, 1.0f);
-  bIsEMPDisrupted = ClampedStrength > 0.0f;
-  if (bIsEMPDisrupted) {
-    OnChargeDisrupted.Broadcast();
-    EMPDisruptionEndTime =
-        GetWorld() ? (GetWorld()->GetTimeSeconds() + Duration) : 0.0f;
+  if (ClampedStrength <= 0.0f) {
+    return;
   }
+
+  // Freeze charge growth from now until the disruption expires
+  ResampleCharge();
+  bIsEMPDisrupted = true;
+  OnChargeDisrupted.Broadcast();
+
+  if (UWorld *World = GetWorld()) {
+    EMPDisruptionEndTime = World->GetTimeSeconds() + Duration;
+    World->GetTimerManager().SetTimer(
+        EMPTimerHandle, this, &UTGChargeComponent::OnEMPDisruptionExpired,
+        FMath::Max(Duration, KINDA_SMALL_NUMBER), false);
+  } else {
+    EMPDisruptionEndTime = 0.0f;
+  }
+
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGChargeComponent::SetChargeRate(float NewChargeRate) {
+  ResampleCharge();
   ChargeRate = FMath::Max(0.0f, NewChargeRate);
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGChargeComponent::SetMaxCharge(float NewMaxCharge) {
+  ResampleCharge();
   MaxCharge = FMath::Max(0.0f, NewMaxCharge);
   CurrentCharge = FMath::Clamp(CurrentCharge, 0.0f, MaxCharge);
   UpdateChargeState();
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGChargeComponent::UpdateChargeState() {
@@ -110,7 +146,9 @@ void UTGChargeComponent::UpdateChargeState() {
 }
 
 EChargeState UTGChargeComponent::CalculateChargeState() const {
-  const float Pct = GetChargePercentage() * 100.0f;
+  // Evaluated against the anchored value; callers resample first
+  const float Pct =
+      (MaxCharge > 0.0f) ? (CurrentCharge / MaxCharge) * 100.0f : 0.0f;
   if (Pct >= UnstableThreshold) {
     return EChargeState::Unstable;
   }
@@ -126,10 +164,90 @@ EChargeState UTGChargeComponent::CalculateChargeState() const {
   return EChargeState::Discharged;
 }
 
-void UTGChargeComponent::ProcessEMPDisruption(float DeltaTime) {
-  if (bIsEMPDisrupted && GetWorld()) {
-    if (GetWorld()->GetTimeSeconds() >= EMPDisruptionEndTime) {
-      bIsEMPDisrupted = false;
+void UTGChargeComponent::OnEMPDisruptionExpired() {
+  ResampleCharge();
+  bIsEMPDisrupted = false;
+  ScheduleNextThresholdCrossing();
+}
+
+float UTGChargeComponent::GetWorldTime() const {
+  const UWorld *World = GetWorld();
+  return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+float UTGChargeComponent::GetChargeRatePerSecond() const {
+  if (bIsCharging) {
+    return bIsEMPDisrupted ? 0.0f : ChargeRate;
+  }
+  return -DischargeRate;
+}
+
+float UTGChargeComponent::EvaluateChargeAt(float Time) const {
+  const float Elapsed = FMath::Max(0.0f, Time - ChargeTimestamp);
+  return FMath::Clamp(CurrentCharge + GetChargeRatePerSecond() * Elapsed, 0.0f,
+                      MaxCharge);
+}
+
+void UTGChargeComponent::ResampleCharge() {
+  const float Now = GetWorldTime();
+  CurrentCharge = EvaluateChargeAt(Now);
+  ChargeTimestamp = Now;
+}
+
+void UTGChargeComponent::ScheduleNextThresholdCrossing() {
+  UWorld *World = GetWorld();
+  if (!World) {
+    return;
+  }
+
+  FTimerManager &TimerManager = World->GetTimerManager();
+  TimerManager.ClearTimer(ChargeTimerHandle);
+
+  const float Rate = GetChargeRatePerSecond();
+  if (Rate == 0.0f || MaxCharge <= 0.0f) {
+    return;
+  }
+
+  const float ThresholdsPct[] = {ChargedThreshold, OverchargeThreshold,
+                                 UnstableThreshold};
+
+  float Target = 0.0f;
+  bool bHasTarget = false;
+  if (Rate > 0.0f) {
+    // Rising: next threshold strictly above the current charge
+    for (const float ThresholdPct : ThresholdsPct) {
+      const float ThresholdCharge =
+          FMath::Min(ThresholdPct * 0.01f * MaxCharge, MaxCharge);
+      if (ThresholdCharge > CurrentCharge &&
+          (!bHasTarget || ThresholdCharge < Target)) {
+        Target = ThresholdCharge;
+        bHasTarget = true;
+      }
+    }
+  } else {
+    // Falling: highest threshold at or below the current charge
+    for (const float ThresholdPct : ThresholdsPct) {
+      const float ThresholdCharge = ThresholdPct * 0.01f * MaxCharge;
+      if (ThresholdCharge > 0.0f && ThresholdCharge <= CurrentCharge &&
+          (!bHasTarget || ThresholdCharge > Target)) {
+        Target = ThresholdCharge;
+        bHasTarget = true;
+      }
     }
   }
+
+  if (!bHasTarget) {
+    return;
+  }
+
+  const float Delay =
+      FMath::Abs(Target - CurrentCharge) / FMath::Abs(Rate) + ChargeCrossingMargin;
+  TimerManager.SetTimer(ChargeTimerHandle, this,
+                        &UTGChargeComponent::OnThresholdTimer, Delay, false);
+}
+
+void UTGChargeComponent::OnThresholdTimer() {
+  ResampleCharge();
+  UpdateChargeState();
+  ScheduleNextThresholdCrossing();
 }
@@ -2,6 +2,7 @@
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "TGAI/Public/TGEnemyGrunt.h"
+#include "TGAI/Public/TGCrowdSubsystem.h"
 #include "TGWeapon.h"
 #include "TGCore/Public/TGPlayPawn.h"
 #include "Engine/StaticMeshActor.h"
@@ -54,22 +55,31 @@ void ATGDemoManager::SpawnEnemies()
     
     SpawnedEnemies.Empty();
     
+    // Enemies away from the player start out as crowd agents and are tracked once promoted
+    UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>();
+    if (Crowd)
+    {
+        Crowd->OnGruntPromoted.AddUniqueDynamic(this, &ATGDemoManager::HandleGruntPromoted);
+    }
+    
     for (int32 i = 0; i < NumberOfEnemies; i++)
     {
         FVector SpawnLocation = GetRandomSpawnLocation();
         FRotator SpawnRotation = FRotator(0, FMath::RandRange(0, 360), 0);
         
-        ATGEnemyGrunt* NewEnemy = GetWorld()->SpawnActor<ATGEnemyGrunt>(
-            EnemyClass, 
-            SpawnLocation, 
-            SpawnRotation
-        );
+        ATGEnemyGrunt* NewEnemy = Crowd
+            ? Crowd->SpawnEnemy(SpawnLocation, SpawnRotation, EnemyClass, this)
+            : GetWorld()->SpawnActor<ATGEnemyGrunt>(EnemyClass, SpawnLocation, SpawnRotation);
         
         if (NewEnemy)
         {
             SpawnedEnemies.Add(NewEnemy);
             UE_LOG(LogTemp, Log, TEXT("Spawned enemy %d at location %s"), i, *SpawnLocation.ToString());
         }
+        else if (Crowd)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Added crowd enemy %d at location %s"), i, *SpawnLocation.ToString());
+        }
     }
 }
 
@@ -115,9 +125,9 @@ void ATGDemoManager::SpawnWeapon()
     
     if (PlayerWeapon)
     {
-        // Attach weapon to player
-        PlayerWeapon->AttachToActor(PlayerPawn, FAttachmentTransformRules::KeepWorldTransform);
-        UE_LOG(LogTemp, Log, TEXT("Spawned weapon and attached to player"));
+        // Attach weapon to player and compile its loadout
+        PlayerPawn->EquipWeapon(PlayerWeapon);
+        UE_LOG(LogTemp, Log, TEXT("Spawned weapon and equipped it on the player"));
     }
 }
 
@@ -143,9 +153,31 @@ FVector ATGDemoManager::GetRandomSpawnLocation() const
     return Center + RandomOffset;
 }
 
+void ATGDemoManager::HandleGruntPromoted(ATGEnemyGrunt* Grunt)
+{
+    SpawnedEnemies.AddUnique(Grunt);
+}
+
+int32 ATGDemoManager::GetEnemyCount() const
+{
+    int32 Count = 0;
+    for (const ATGEnemyGrunt* Enemy : SpawnedEnemies)
+    {
+        if (IsValid(Enemy) && !Enemy->IsDead())
+        {
+            Count++;
+        }
+    }
+    if (const UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>())
+    {
+        Count += Crowd->GetCrowdAgentCount();
+    }
+    return Count;
+}
+
 void ATGDemoManager::ResetDemo()
 {
-    // Clear existing enemies
+    // Clear existing enemies; clearing the crowd also destroys grunts promoted from it
     for (ATGEnemyGrunt* Enemy : SpawnedEnemies)
     {
         if (IsValid(Enemy))
@@ -154,6 +186,10 @@ void ATGDemoManager::ResetDemo()
         }
     }
     SpawnedEnemies.Empty();
+    if (UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>())
+    {
+        Crowd->ClearCrowd(this);
+    }
     
     // Reset player
     if (IsValid(PlayerPawn))
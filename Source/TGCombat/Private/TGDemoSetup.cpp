@@ -2,6 +2,7 @@
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "TGAI/Public/TGEnemyGrunt.h"
+#include "TGAI/Public/TGCrowdSubsystem.h"
 #include "TGWeapon.h"
 #include "TGCore/Public/TGPlayPawn.h"
 #include "Engine/StaticMeshActor.h"
@@ -88,22 +89,31 @@ void ATGDemoSetup::SpawnEnemies()
         FVector(-800, 0, 100)      // West
     };
 
+    // Enemies away from the player start out as crowd agents and are tracked once promoted
+    UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>();
+    if (Crowd)
+    {
+        Crowd->OnGruntPromoted.AddUniqueDynamic(this, &ATGDemoSetup::HandleGruntPromoted);
+    }
+
     for (int32 i = 0; i < FMath::Min(NumberOfEnemies, EnemySpawnLocations.Num()); i++)
     {
         FVector SpawnLocation = EnemySpawnLocations[i];
         FRotator SpawnRotation = FRotator(0, FMath::RandRange(0, 360), 0);
 
-        ATGEnemyGrunt* NewEnemy = GetWorld()->SpawnActor<ATGEnemyGrunt>(
-            EnemyClass,
-            SpawnLocation,
-            SpawnRotation
-        );
+        ATGEnemyGrunt* NewEnemy = Crowd
+            ? Crowd->SpawnEnemy(SpawnLocation, SpawnRotation, EnemyClass, this)
+            : GetWorld()->SpawnActor<ATGEnemyGrunt>(EnemyClass, SpawnLocation, SpawnRotation);
 
         if (NewEnemy)
         {
             SpawnedEnemies.Add(NewEnemy);
             UE_LOG(LogTemp, Log, TEXT("Spawned enemy %d at location %s"), i+1, *SpawnLocation.ToString());
         }
+        else if (Crowd)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Added crowd enemy %d at location %s"), i+1, *SpawnLocation.ToString());
+        }
     }
 }
 
@@ -149,9 +159,9 @@ void ATGDemoSetup::SpawnWeapon()
 
     if (PlayerWeapon)
     {
-        // Attach weapon to player
-        PlayerWeapon->AttachToActor(PlayerPawn, FAttachmentTransformRules::KeepWorldTransform);
-        UE_LOG(LogTemp, Log, TEXT("Spawned weapon and attached to player"));
+        // Attach weapon to player and compile its loadout
+        PlayerPawn->EquipWeapon(PlayerWeapon);
+        UE_LOG(LogTemp, Log, TEXT("Spawned weapon and equipped it on the player"));
     }
 }
 
@@ -172,7 +182,7 @@ void ATGDemoSetup::SetupLighting()
 
 void ATGDemoSetup::ResetDemo()
 {
-    // Clear existing enemies
+    // Clear existing enemies; clearing the crowd also destroys grunts promoted from it
     for (ATGEnemyGrunt* Enemy : SpawnedEnemies)
     {
         if (IsValid(Enemy))
@@ -181,6 +191,10 @@ void ATGDemoSetup::ResetDemo()
         }
     }
     SpawnedEnemies.Empty();
+    if (UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>())
+    {
+        Crowd->ClearCrowd(this);
+    }
 
     // Clear cover objects
     for (AActor* Cover : CoverObjects)
@@ -215,6 +229,28 @@ void ATGDemoSetup::ResetDemo()
     }
 }
 
+void ATGDemoSetup::HandleGruntPromoted(ATGEnemyGrunt* Grunt)
+{
+    SpawnedEnemies.AddUnique(Grunt);
+}
+
+int32 ATGDemoSetup::GetEnemyCount() const
+{
+    int32 Count = 0;
+    for (const ATGEnemyGrunt* Enemy : SpawnedEnemies)
+    {
+        if (IsValid(Enemy) && !Enemy->IsDead())
+        {
+            Count++;
+        }
+    }
+    if (const UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>())
+    {
+        Count += Crowd->GetCrowdAgentCount();
+    }
+    return Count;
+}
+
 FVector ATGDemoSetup::GetRandomSpawnLocation() const
 {
     FVector Center = GetActorLocation();
@@ -230,7 +266,7 @@ FVector ATGDemoSetup::GetRandomSpawnLocation() const
 void ATGDemoSetup::LogDemoStatus() const
 {
     UE_LOG(LogTemp, Log, TEXT("=== DEMO STATUS ==="));
-    UE_LOG(LogTemp, Log, TEXT("Enemies spawned: %d"), SpawnedEnemies.Num());
+    UE_LOG(LogTemp, Log, TEXT("Enemies alive: %d"), GetEnemyCount());
     UE_LOG(LogTemp, Log, TEXT("Cover objects: %d"), CoverObjects.Num());
     UE_LOG(LogTemp, Log, TEXT("Patrol points: %d"), PatrolPoints.Num());
     UE_LOG(LogTemp, Log, TEXT("Player pawn: %s"), PlayerPawn ? TEXT("Yes") : TEXT("No"));
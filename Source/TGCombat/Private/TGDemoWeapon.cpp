@@ -1,4 +1,5 @@
 #include "TGDemoWeapon.h"
+#include "TGShotQueueSubsystem.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "Particles/ParticleSystem.h"
@@ -97,19 +98,20 @@ void ATGDemoWeapon::PerformLineTrace()
     FVector Forward = MuzzleLocation->GetForwardVector();
     FVector End = Start + (Forward * Range);
 
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(this);
-    QueryParams.AddIgnoredActor(GetOwner());
+    FTGShotRequest Shot;
+    Shot.Start = Start;
+    Shot.End = End;
+    Shot.Channel = ECollisionChannel::ECC_Visibility;
+    Shot.QueryParams.AddIgnoredActor(this);
+    Shot.QueryParams.AddIgnoredActor(GetOwner());
+    Shot.OnResolved.BindUObject(this, &ATGDemoWeapon::OnLineTraceResolved, Start, End);
 
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        HitResult,
-        Start,
-        End,
-        ECollisionChannel::ECC_Visibility,
-        QueryParams
-    );
+    // Batched with every other shot this frame, resolves next frame
+    UTGShotQueueSubsystem::SubmitShot(GetWorld(), MoveTemp(Shot));
+}
 
+void ATGDemoWeapon::OnLineTraceResolved(bool bHit, const FHitResult& HitResult, FVector Start, FVector End)
+{
     // Draw debug line
     FColor LineColor = bHit ? FColor::Red : FColor::Green;
     DrawDebugLine(GetWorld(), Start, End, LineColor, false, 1.0f, 0, 1.0f);
@@ -2,7 +2,8 @@
 #include "TGAugmentData.h"
 
 UTGExosuitComponent::UTGExosuitComponent() {
-  PrimaryComponentTick.bCanEverTick = true;
+  // Stats are recompiled on data, augment and damage-stage changes, never per frame
+  PrimaryComponentTick.bCanEverTick = false;
   CurrentExosuitData = nullptr;
   CurrentDamageStage = EExosuitDamageStage::Pristine;
   CurrentHealth = 100.0f;
@@ -12,16 +13,12 @@ UTGExosuitComponent::UTGExosuitComponent() {
 void UTGExosuitComponent::BeginPlay() {
   Super::BeginPlay();
   UpdateDamageStage();
-}
-
-void UTGExosuitComponent::TickComponent(
-    float DeltaTime, ELevelTick TickType,
-    FActorComponentTickFunction *ThisTickFunction) {
-  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  RebuildCompiledStats();
 }
 
 void UTGExosuitComponent::SetExosuitData(UTGExosuitData *NewExosuitData) {
   CurrentExosuitData = NewExosuitData;
+  RebuildCompiledStats();
 }
 
 void UTGExosuitComponent::TakeDamage(float DamageAmount) {
@@ -45,6 +42,7 @@ bool UTGExosuitComponent::InstallAugment(UTGAugmentData *AugmentData,
     InstalledAugments.SetNum(SlotIndex + 1);
   }
   InstalledAugments[SlotIndex] = AugmentData;
+  RebuildCompiledStats();
   OnAugmentInstalled.Broadcast(AugmentData);
   return true;
 }
@@ -55,6 +53,7 @@ bool UTGExosuitComponent::RemoveAugment(int32 SlotIndex) {
   }
   UTGAugmentData *Removed = InstalledAugments[SlotIndex];
   InstalledAugments[SlotIndex] = nullptr;
+  RebuildCompiledStats();
   OnAugmentRemoved.Broadcast(Removed);
   return true;
 }
@@ -80,25 +79,6 @@ int32 UTGExosuitComponent::GetAvailableAugmentSlots() const {
                             : InstalledAugments.Num();
 }
 
-FExosuitStats UTGExosuitComponent::GetEffectiveStats() const {
-  FExosuitStats Stats =
-      CurrentExosuitData ? CurrentExosuitData->BaseStats : FExosuitStats();
-  // Minimal example: could apply modifiers based on damage stage and augments
-  return Stats;
-}
-
-float UTGExosuitComponent::GetMovementSpeedMultiplier() const {
-  return GetEffectiveStats().MovementSpeedMultiplier;
-}
-
-float UTGExosuitComponent::GetRecoilReduction() const {
-  return GetEffectiveStats().RecoilReductionPercentage;
-}
-
-float UTGExosuitComponent::GetArmorRating() const {
-  return GetEffectiveStats().ArmorRating;
-}
-
 void UTGExosuitComponent::UpdateDamageStage() {
   EExosuitDamageStage OldStage = CurrentDamageStage;
   float HealthPct = MaxHealth > 0.0f ? (CurrentHealth / MaxHealth) : 0.0f;
@@ -116,11 +96,64 @@ void UTGExosuitComponent::UpdateDamageStage() {
   }
 
   if (OldStage != CurrentDamageStage) {
+    RebuildCompiledStats();
     OnExosuitDamageChanged.Broadcast(OldStage, CurrentDamageStage);
     UpdateVisualDamage();
   }
 }
 
+void UTGExosuitComponent::RebuildCompiledStats() {
+  FExosuitStats Stats =
+      CurrentExosuitData ? CurrentExosuitData->BaseStats : FExosuitStats();
+
+  // Stage modifiers scale the multipliers and add to the flat ratings
+  if (CurrentExosuitData) {
+    if (const FExosuitStats *StageMod =
+            CurrentExosuitData->DamageStageModifiers.Find(CurrentDamageStage)) {
+      Stats.MovementSpeedMultiplier *= StageMod->MovementSpeedMultiplier;
+      Stats.SprintSpeedMultiplier *= StageMod->SprintSpeedMultiplier;
+      Stats.ADSStabilityBonus += StageMod->ADSStabilityBonus;
+      Stats.RecoilReductionPercentage += StageMod->RecoilReductionPercentage;
+      Stats.ArmorRating += StageMod->ArmorRating;
+      Stats.ExplosiveResistance += StageMod->ExplosiveResistance;
+    }
+  }
+
+  for (const UTGAugmentData *Aug : InstalledAugments) {
+    if (!Aug) {
+      continue;
+    }
+    const FAugmentEffects &Effects = Aug->PositiveEffects;
+    Stats.MovementSpeedMultiplier += Effects.MovementSpeedBonus;
+    Stats.SprintSpeedMultiplier += Effects.MovementSpeedBonus;
+    Stats.ADSStabilityBonus += Effects.AccuracyBonus;
+    Stats.RecoilReductionPercentage += Effects.RecoilReductionBonus;
+    Stats.ExplosiveResistance += Effects.ExplosiveResistanceBonus;
+  }
+
+  Stats.MovementSpeedMultiplier = FMath::Max(0.0f, Stats.MovementSpeedMultiplier);
+  Stats.SprintSpeedMultiplier = FMath::Max(0.0f, Stats.SprintSpeedMultiplier);
+  Stats.RecoilReductionPercentage =
+      FMath::Clamp(Stats.RecoilReductionPercentage, 0.0f, 100.0f);
+  Stats.ArmorRating = FMath::Max(0.0f, Stats.ArmorRating);
+
+  const bool bChanged =
+      Stats.MovementSpeedMultiplier != CompiledStats.MovementSpeedMultiplier ||
+      Stats.SprintSpeedMultiplier != CompiledStats.SprintSpeedMultiplier ||
+      Stats.ADSStabilityBonus != CompiledStats.ADSStabilityBonus ||
+      Stats.RecoilReductionPercentage !=
+          CompiledStats.RecoilReductionPercentage ||
+      Stats.ArmorRating != CompiledStats.ArmorRating ||
+      Stats.ExplosiveResistance != CompiledStats.ExplosiveResistance ||
+      Stats.AugmentSlots != CompiledStats.AugmentSlots ||
+      Stats.PowerConsumption != CompiledStats.PowerConsumption;
+
+  CompiledStats = Stats;
+  if (bChanged) {
+    OnExosuitStatsChanged.Broadcast(CompiledStats);
+  }
+}
+
 void UTGExosuitComponent::UpdateVisualDamage() {
   // Stub: could swap materials, play effects, etc.
 }
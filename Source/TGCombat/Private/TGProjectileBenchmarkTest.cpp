@@ -0,0 +1,162 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "TGProjectileSubsystem.h"
+#include "TGTestWorld.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTGProjectileBenchmarkTest, "TerminalGrounds.Combat.Projectiles.Benchmark4000Projectiles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTGProjectileBenchmarkTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumProjectiles = 4000;
+    constexpr int32 NumFrames = 180;
+    constexpr float FrameSeconds = 1.0f / 60.0f;
+    constexpr float ProjectileSpeed = 5000.0f;
+    constexpr float ProjectileLifetime = 2.0f;
+
+    FTGScopedTestWorld TestWorld(TEXT("TGProjectileBenchmark"));
+    UWorld* World = TestWorld.Get();
+    TestWorld.BeginPlay();
+
+    // A wall of blocking cubes downrange so roughly half the rounds hit something and the rest expire
+    if (UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")))
+    {
+        for (int32 i = 0; i < 16; i++)
+        {
+            const FVector Location(5000.0f, (i - 8) * 400.0f, 0.0f);
+            if (AStaticMeshActor* Wall = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator))
+            {
+                Wall->GetStaticMeshComponent()->SetStaticMesh(CubeMesh);
+                Wall->SetActorScale3D(FVector(1.0f, 2.0f, 4.0f));
+            }
+        }
+    }
+
+    // Shallow ballistic fan so rounds arc down onto the wall or past its ends
+    TArray<FVector> Origins;
+    TArray<FVector> Velocities;
+    for (int32 i = 0; i < NumProjectiles; i++)
+    {
+        const float Yaw = FMath::Lerp(-60.0f, 60.0f, (i % 200) / 199.0f);
+        const float Pitch = FMath::Lerp(0.0f, 8.0f, (i / 200) / float(NumProjectiles / 200));
+        Origins.Add(FVector(0.0f, (i % 7 - 3) * 50.0f, 50.0f));
+        Velocities.Add(FRotator(Pitch, Yaw, 0.0f).Vector() * ProjectileSpeed);
+    }
+
+    // Baseline: one actor with a projectile movement component per round
+    TArray<UProjectileMovementComponent*> Movements;
+    double ActorSpawnSeconds = 0.0;
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumProjectiles; i++)
+        {
+            AActor* Projectile = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Origins[i]));
+            if (!Projectile)
+            {
+                continue;
+            }
+
+            USphereComponent* Collision = NewObject<USphereComponent>(Projectile);
+            Collision->InitSphereRadius(1.0f);
+            Collision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+            Collision->SetCollisionObjectType(ECC_WorldDynamic);
+            Collision->SetCollisionResponseToAllChannels(ECR_Ignore);
+            Collision->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
+            Projectile->SetRootComponent(Collision);
+            Collision->RegisterComponent();
+            Collision->SetWorldLocation(Origins[i]);
+
+            UProjectileMovementComponent* Movement = NewObject<UProjectileMovementComponent>(Projectile);
+            Movement->SetUpdatedComponent(Collision);
+            Movement->Velocity = Velocities[i];
+            Movement->ProjectileGravityScale = 1.0f;
+            Movement->RegisterComponent();
+            Projectile->SetLifeSpan(ProjectileLifetime);
+            Movements.Add(Movement);
+        }
+        ActorSpawnSeconds = FPlatformTime::Seconds() - Start;
+    }
+
+    double ActorTickSeconds = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; Frame++)
+    {
+        const double Start = FPlatformTime::Seconds();
+        World->Tick(LEVELTICK_All, FrameSeconds);
+        ActorTickSeconds += FPlatformTime::Seconds() - Start;
+    }
+
+    // Rounds stopped by a blocking hit before their lifespan ran out
+    int32 ActorHits = 0;
+    for (UProjectileMovementComponent* Movement : Movements)
+    {
+        if (IsValid(Movement) && Movement->UpdatedComponent == nullptr)
+        {
+            ActorHits++;
+        }
+    }
+
+    // Drain the actor rounds that are still alive so they do not cost the next pass
+    for (int32 Frame = 0; Frame < 30; Frame++)
+    {
+        World->Tick(LEVELTICK_All, FrameSeconds);
+    }
+
+    UTGProjectileSubsystem* ProjectileSubsystem = World->GetSubsystem<UTGProjectileSubsystem>();
+    TestNotNull(TEXT("Projectile subsystem exists in game worlds"), ProjectileSubsystem);
+    if (!ProjectileSubsystem)
+    {
+        return false;
+    }
+
+    ProjectileSubsystem->MaxLiveProjectiles = FMath::Max(ProjectileSubsystem->MaxLiveProjectiles, NumProjectiles);
+
+    int32 SubsystemHits = 0;
+    const FDelegateHandle ImpactHandle = ProjectileSubsystem->OnProjectileImpact.AddLambda([&SubsystemHits](const FHitResult&, AActor*)
+    {
+        SubsystemHits++;
+    });
+
+    double LaunchSeconds = 0.0;
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumProjectiles; i++)
+        {
+            FTGProjectileLaunchParams Launch;
+            Launch.Origin = Origins[i];
+            Launch.Velocity = Velocities[i];
+            Launch.MaxLifetime = ProjectileLifetime;
+            ProjectileSubsystem->LaunchProjectile(Launch);
+        }
+        LaunchSeconds = FPlatformTime::Seconds() - Start;
+    }
+    TestEqual(TEXT("Every round is accepted under the live projectile cap"), ProjectileSubsystem->GetLiveProjectileCount(), NumProjectiles);
+
+    double SubsystemTickSeconds = 0.0;
+    double SimulationMs = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; Frame++)
+    {
+        const double Start = FPlatformTime::Seconds();
+        World->Tick(LEVELTICK_All, FrameSeconds);
+        SubsystemTickSeconds += FPlatformTime::Seconds() - Start;
+        SimulationMs += ProjectileSubsystem->GetLastSimulationTimeMs();
+    }
+    ProjectileSubsystem->OnProjectileImpact.Remove(ImpactHandle);
+
+    TestEqual(TEXT("Every round has hit or expired by the end of its lifetime"), ProjectileSubsystem->GetLiveProjectileCount(), 0);
+    TestTrue(TEXT("Rounds aimed at the wall hit it"), SubsystemHits > 0);
+
+    AddInfo(FString::Printf(TEXT("%d rounds x %d frames: actors %.3f ms spawn, %.3f ms/frame (%d hits); subsystem %.3f ms launch, %.3f ms/frame world tick, %.3f ms/frame simulation (%d hits)"),
+        NumProjectiles, NumFrames,
+        ActorSpawnSeconds * 1000.0, ActorTickSeconds * 1000.0 / NumFrames, ActorHits,
+        LaunchSeconds * 1000.0, SubsystemTickSeconds * 1000.0 / NumFrames, SimulationMs / NumFrames, SubsystemHits));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
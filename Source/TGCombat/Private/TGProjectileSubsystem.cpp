@@ -0,0 +1,395 @@
+#include "TGProjectileSubsystem.h"
+#include "TGCombat.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+
+DECLARE_STATS_GROUP(TEXT("TGCombat"), STATGROUP_TGCombat, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("TGProjectiles - Simulate"), STAT_TGProjectileSimulate, STATGROUP_TGCombat);
+DECLARE_CYCLE_STAT(TEXT("TGProjectiles - Sweep"), STAT_TGProjectileSweep, STATGROUP_TGCombat);
+DECLARE_CYCLE_STAT(TEXT("TGProjectiles - Visuals"), STAT_TGProjectileVisuals, STATGROUP_TGCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TGProjectiles - Live"), STAT_TGProjectileLive, STATGROUP_TGCombat);
+
+void UTGProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    constexpr int32 InitialCapacity = 1024;
+    Positions.Reserve(InitialCapacity);
+    Velocities.Reserve(InitialCapacity);
+    SweptFrom.Reserve(InitialCapacity);
+    GravityScales.Reserve(InitialCapacity);
+    Damages.Reserve(InitialCapacity);
+    RemainingLife.Reserve(InitialCapacity);
+    Owners.Reserve(InitialCapacity);
+    VisualIndices.Reserve(InitialCapacity);
+    VisualScales.Reserve(InitialCapacity);
+}
+
+void UTGProjectileSubsystem::Deinitialize()
+{
+    ClearAllProjectiles();
+
+    if (VisualActor)
+    {
+        VisualActor->Destroy();
+        VisualActor = nullptr;
+    }
+    VisualMeshes.Empty();
+    VisualComponents.Empty();
+    VisualInstanceCounts.Empty();
+    VisualTransforms.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UTGProjectileSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTGProjectileSubsystem::LaunchProjectile(const FTGProjectileLaunchParams& Params)
+{
+    // Launched from a damage or impact handler; joins once the sweep has finished with its indices
+    if (bResolvingImpacts)
+    {
+        PendingLaunches.Add(Params);
+        return;
+    }
+
+    if (Positions.Num() >= MaxLiveProjectiles)
+    {
+        UE_LOG(LogTGCombat, Verbose, TEXT("Projectile cap (%d) reached - launch dropped"), MaxLiveProjectiles);
+        return;
+    }
+
+    Positions.Add(Params.Origin);
+    Velocities.Add(Params.Velocity);
+    SweptFrom.Add(Params.Origin);
+    GravityScales.Add(Params.GravityScale);
+    Damages.Add(Params.Damage);
+    RemainingLife.Add(Params.MaxLifetime);
+    Owners.Add(Params.Owner);
+    VisualIndices.Add(Params.VisualMesh ? FindOrCreateVisual(Params.VisualMesh) : INDEX_NONE);
+    VisualScales.Add(Params.VisualScale);
+}
+
+void UTGProjectileSubsystem::ClearAllProjectiles()
+{
+    if (bResolvingImpacts)
+    {
+        bClearPending = true;
+        PendingLaunches.Reset();
+        return;
+    }
+
+    Positions.Reset();
+    Velocities.Reset();
+    SweptFrom.Reset();
+    GravityScales.Reset();
+    Damages.Reset();
+    RemainingLife.Reset();
+    Owners.Reset();
+    VisualIndices.Reset();
+    VisualScales.Reset();
+    SweepCursor = 0;
+
+    UpdateVisuals();
+}
+
+void UTGProjectileSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_TGProjectileSimulate);
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Fixed sub-stepping keeps ballistic arcs independent of frame rate
+    TimeAccumulator = FMath::Min(TimeAccumulator + DeltaTime, FixedSubStep * MaxSubStepsPerFrame);
+    while (TimeAccumulator >= FixedSubStep)
+    {
+        Integrate(FixedSubStep);
+        AgeProjectiles(FixedSubStep);
+        TimeAccumulator -= FixedSubStep;
+    }
+
+    SweepProjectiles();
+    UpdateVisuals();
+
+    SET_DWORD_STAT(STAT_TGProjectileLive, Positions.Num());
+    LastSimulationTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+void UTGProjectileSubsystem::Integrate(float StepSeconds)
+{
+    const UWorld* World = GetWorld();
+    const float GravityZ = World ? World->GetGravityZ() : -980.0f;
+    const int32 Count = Positions.Num();
+
+    FVector* RESTRICT Pos = Positions.GetData();
+    FVector* RESTRICT Vel = Velocities.GetData();
+    const float* RESTRICT Gravity = GravityScales.GetData();
+    const float* RESTRICT Life = RemainingLife.GetData();
+
+    // Semi-implicit Euler over contiguous arrays; expired projectiles hold at their end point until swept
+    for (int32 i = 0; i < Count; i++)
+    {
+        const float Step = Life[i] > 0.0f ? StepSeconds : 0.0f;
+        Vel[i].Z += GravityZ * Gravity[i] * Step;
+        Pos[i] += Vel[i] * Step;
+    }
+}
+
+void UTGProjectileSubsystem::AgeProjectiles(float DeltaSeconds)
+{
+    // Expired projectiles are removed by the sweep, after their last segment has been traced
+    for (float& Life : RemainingLife)
+    {
+        Life -= DeltaSeconds;
+    }
+}
+
+void UTGProjectileSubsystem::SweepProjectiles()
+{
+    SCOPE_CYCLE_COUNTER(STAT_TGProjectileSweep);
+
+    UWorld* World = GetWorld();
+    const int32 Count = Positions.Num();
+    if (!World || Count == 0)
+    {
+        LastSweepCount = 0;
+        return;
+    }
+
+    // Expired projectiles always get their final segment swept; they go first and bypass the budget
+    SweepOrder.Reset();
+    for (int32 i = 0; i < Count; i++)
+    {
+        if (RemainingLife[i] <= 0.0f)
+        {
+            SweepOrder.Add(i);
+        }
+    }
+    const int32 NumExpired = SweepOrder.Num();
+
+    // Then the rest, round-robin from the cursor so every projectile is eventually swept when over budget
+    SweepCursor = SweepCursor % Count;
+    for (int32 i = 0; i < Count; i++)
+    {
+        const int32 Index = (SweepCursor + i) % Count;
+        if (RemainingLife[Index] > 0.0f)
+        {
+            SweepOrder.Add(Index);
+        }
+    }
+
+    SweepHits.SetNum(Count, EAllowShrinking::No);
+    SweepHitFlags.SetNumUninitialized(Count, EAllowShrinking::No);
+
+    const ECollisionChannel Channel = SweepChannel.GetValue();
+    const int32 BatchSize = FMath::Max(1, SweepBatchSize);
+    const int32 RoundSize = BatchSize * FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+
+    // Scene queries are read-only, so batches run on worker threads; one round per budget check
+    const double Deadline = FPlatformTime::Seconds() + SweepBudgetMs / 1000.0;
+    int32 SweepCount = 0;
+    do
+    {
+        const int32 RoundFirst = SweepCount;
+        const int32 RoundLast = FMath::Min(Count, FMath::Max(RoundFirst + RoundSize, NumExpired));
+        ParallelFor(FMath::DivideAndRoundUp(RoundLast - RoundFirst, BatchSize), [&](int32 BatchIndex)
+        {
+            const int32 First = RoundFirst + BatchIndex * BatchSize;
+            const int32 Last = FMath::Min(First + BatchSize, RoundLast);
+            for (int32 j = First; j < Last; j++)
+            {
+                const int32 Index = SweepOrder[j];
+                FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TGProjectileSweep), false);
+                if (AActor* Owner = Owners[Index].Get())
+                {
+                    QueryParams.AddIgnoredActor(Owner);
+                }
+                SweepHitFlags[j] = World->LineTraceSingleByChannel(SweepHits[j], SweptFrom[Index], Positions[Index], Channel, QueryParams) ? 1 : 0;
+            }
+        });
+        SweepCount = RoundLast;
+    }
+    while (SweepCount < Count && FPlatformTime::Seconds() < Deadline);
+
+    // Resume after the last live projectile swept; expired ones are removed below
+    if (SweepCount > NumExpired)
+    {
+        SweepCursor = SweepOrder[SweepCount - 1] + 1;
+    }
+
+    LastSweepCount = SweepCount;
+
+    // Resolve impacts on the game thread; collect hits and expiries first, then remove highest index first.
+    // Handlers may launch or clear projectiles, so those are deferred until the indices are no longer in use.
+    TArray<int32, TInlineAllocator<64>> Finished;
+    bResolvingImpacts = true;
+    for (int32 j = 0; j < SweepCount; j++)
+    {
+        const int32 Index = SweepOrder[j];
+        if (!SweepHitFlags[j])
+        {
+            SweptFrom[Index] = Positions[Index];
+            if (j < NumExpired)
+            {
+                Finished.Add(Index);
+            }
+            continue;
+        }
+
+        const FHitResult& Hit = SweepHits[j];
+        AActor* Owner = Owners[Index].Get();
+        if (AActor* HitActor = Hit.GetActor())
+        {
+            const FVector ShotDirection = Velocities[Index].GetSafeNormal();
+            APawn* OwnerPawn = Cast<APawn>(Owner);
+            AController* InstigatorController = OwnerPawn ? OwnerPawn->GetController() : (Owner ? Owner->GetInstigatorController() : nullptr);
+            UGameplayStatics::ApplyPointDamage(HitActor, Damages[Index], ShotDirection, Hit, InstigatorController, Owner, UDamageType::StaticClass());
+        }
+        OnProjectileImpact.Broadcast(Hit, Owner);
+        Finished.Add(Index);
+    }
+
+    bResolvingImpacts = false;
+
+    if (bClearPending)
+    {
+        bClearPending = false;
+        ClearAllProjectiles();
+    }
+    else
+    {
+        Finished.Sort(TGreater<int32>());
+        for (int32 Index : Finished)
+        {
+            RemoveProjectileAt(Index);
+        }
+    }
+
+    for (const FTGProjectileLaunchParams& Launch : PendingLaunches)
+    {
+        LaunchProjectile(Launch);
+    }
+    PendingLaunches.Reset();
+}
+
+void UTGProjectileSubsystem::UpdateVisuals()
+{
+    SCOPE_CYCLE_COUNTER(STAT_TGProjectileVisuals);
+
+    if (VisualComponents.Num() == 0)
+    {
+        return;
+    }
+
+    // Per-visual transform arrays are reused frame to frame; Reset keeps their allocations
+    for (TArray<FTransform>& Transforms : VisualTransforms)
+    {
+        Transforms.Reset();
+    }
+
+    for (int32 i = 0; i < Positions.Num(); i++)
+    {
+        const int32 VisualIndex = VisualIndices[i];
+        if (VisualIndex != INDEX_NONE)
+        {
+            VisualTransforms[VisualIndex].Emplace(Velocities[i].Rotation(), Positions[i], VisualScales[i]);
+        }
+    }
+
+    for (int32 v = 0; v < VisualComponents.Num(); v++)
+    {
+        UInstancedStaticMeshComponent* Component = VisualComponents[v];
+        if (!Component)
+        {
+            continue;
+        }
+
+        TArray<FTransform>& Transforms = VisualTransforms[v];
+        const int32 Needed = Transforms.Num();
+
+        // Grow the pool only; surplus instances are collapsed to zero scale instead of removed
+        if (Needed > VisualInstanceCounts[v])
+        {
+            TArray<FTransform> NewInstances;
+            NewInstances.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), Needed - VisualInstanceCounts[v]);
+            Component->AddInstances(NewInstances, false, true);
+            VisualInstanceCounts[v] = Needed;
+        }
+
+        Transforms.Reserve(VisualInstanceCounts[v]);
+        while (Transforms.Num() < VisualInstanceCounts[v])
+        {
+            Transforms.Emplace(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+        }
+
+        if (Transforms.Num() > 0)
+        {
+            Component->BatchUpdateInstancesTransforms(0, Transforms, true, true, false);
+        }
+    }
+}
+
+void UTGProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+    Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    SweptFrom.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    GravityScales.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Damages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    RemainingLife.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Owners.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    VisualIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    VisualScales.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+int32 UTGProjectileSubsystem::FindOrCreateVisual(UStaticMesh* Mesh)
+{
+    const int32 Existing = VisualMeshes.IndexOfByKey(Mesh);
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return INDEX_NONE;
+    }
+
+    if (!VisualActor)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transient;
+        VisualActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!VisualActor)
+        {
+            return INDEX_NONE;
+        }
+    }
+
+    UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(VisualActor);
+    Component->SetStaticMesh(Mesh);
+    Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Component->SetCastShadow(false);
+    Component->SetMobility(EComponentMobility::Movable);
+    if (!VisualActor->GetRootComponent())
+    {
+        VisualActor->SetRootComponent(Component);
+    }
+    Component->RegisterComponent();
+
+    VisualMeshes.Add(Mesh);
+    VisualComponents.Add(Component);
+    VisualInstanceCounts.Add(0);
+    VisualTransforms.AddDefaulted();
+
+    return VisualMeshes.Num() - 1;
+}
@@ -0,0 +1,108 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "TGShotQueueSubsystem.h"
+#include "TGTestWorld.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTGShotQueueBenchmarkTest, "TerminalGrounds.Combat.ShotQueue.Benchmark64Shooters", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTGShotQueueBenchmarkTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumShooters = 64;
+    constexpr int32 NumFrames = 120;
+    constexpr float ShotRange = 10000.0f;
+
+    FTGScopedTestWorld TestWorld(TEXT("TGShotQueueBenchmark"));
+    UWorld* World = TestWorld.Get();
+    TestWorld.BeginPlay();
+
+    // A wall of blocking cubes downrange so roughly half the shots hit something
+    if (UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")))
+    {
+        for (int32 i = 0; i < 16; i++)
+        {
+            const FVector Location(5000.0f, (i - 8) * 400.0f, 0.0f);
+            if (AStaticMeshActor* Wall = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator))
+            {
+                Wall->GetStaticMeshComponent()->SetStaticMesh(CubeMesh);
+                Wall->SetActorScale3D(FVector(1.0f, 2.0f, 4.0f));
+            }
+        }
+    }
+
+    TArray<FVector> Origins;
+    TArray<FVector> Directions;
+    for (int32 i = 0; i < NumShooters; i++)
+    {
+        Origins.Add(FVector(0.0f, (i - NumShooters / 2) * 100.0f, 50.0f));
+        Directions.Add(FRotator(0.0f, FMath::Lerp(-10.0f, 10.0f, i / float(NumShooters - 1)), 0.0f).Vector());
+    }
+
+    // Baseline: one synchronous trace per shooter at fire time
+    double SyncSeconds = 0.0;
+    int32 SyncHits = 0;
+    for (int32 Frame = 0; Frame < NumFrames; Frame++)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumShooters; i++)
+        {
+            FHitResult Hit;
+            FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TGShotTrace), false);
+            if (World->LineTraceSingleByChannel(Hit, Origins[i], Origins[i] + Directions[i] * ShotRange, ECC_Visibility, QueryParams))
+            {
+                SyncHits++;
+            }
+        }
+        SyncSeconds += FPlatformTime::Seconds() - Start;
+    }
+
+    // Batched: game thread only pays for queueing and submission, traces run off-thread
+    UTGShotQueueSubsystem* ShotQueue = World->GetSubsystem<UTGShotQueueSubsystem>();
+    TestNotNull(TEXT("Shot queue subsystem exists in game worlds"), ShotQueue);
+    if (!ShotQueue)
+    {
+        return false;
+    }
+
+    double AsyncSeconds = 0.0;
+    int32 AsyncResolved = 0;
+    int32 AsyncHits = 0;
+    for (int32 Frame = 0; Frame < NumFrames; Frame++)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumShooters; i++)
+        {
+            FTGShotRequest Shot;
+            Shot.Start = Origins[i];
+            Shot.End = Origins[i] + Directions[i] * ShotRange;
+            Shot.OnResolved.BindLambda([&AsyncResolved, &AsyncHits](bool bHit, const FHitResult&)
+            {
+                AsyncResolved++;
+                AsyncHits += bHit ? 1 : 0;
+            });
+            ShotQueue->QueueShot(MoveTemp(Shot));
+        }
+        ShotQueue->FlushPendingShots();
+        AsyncSeconds += FPlatformTime::Seconds() - Start;
+
+        World->Tick(LEVELTICK_All, 1.0f / 60.0f);
+    }
+
+    // Drain the last frame's traces
+    World->Tick(LEVELTICK_All, 1.0f / 60.0f);
+    World->Tick(LEVELTICK_All, 1.0f / 60.0f);
+
+    TestEqual(TEXT("Every queued shot resolves"), AsyncResolved, NumShooters * NumFrames);
+    TestEqual(TEXT("Batched traces hit the same targets as synchronous traces"), AsyncHits, SyncHits);
+
+    AddInfo(FString::Printf(TEXT("%d shooters x %d frames: synchronous %.4f ms/frame, batched %.4f ms/frame on the game thread"),
+        NumShooters, NumFrames, SyncSeconds * 1000.0 / NumFrames, AsyncSeconds * 1000.0 / NumFrames));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
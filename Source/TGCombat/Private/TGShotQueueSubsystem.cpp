@@ -0,0 +1,141 @@
+#include "TGShotQueueSubsystem.h"
+#include "TGCombat.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarTGAsyncShotTraces(
+    TEXT("tg.Combat.AsyncShotTraces"),
+    1,
+    TEXT("1 = batch hitscan shots into async traces resolved next frame, 0 = trace synchronously at fire time"),
+    ECVF_Default);
+
+void UTGShotQueueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    TraceDelegate.BindUObject(this, &UTGShotQueueSubsystem::OnTraceCompleted);
+
+    PendingShots.Reserve(64);
+    InFlightShots.Reserve(128);
+}
+
+void UTGShotQueueSubsystem::Deinitialize()
+{
+    // Outstanding async traces are dropped with the world; their callbacks never fire
+    PendingShots.Empty();
+    InFlightShots.Empty();
+    FreeSlots.Empty();
+    TraceDelegate.Unbind();
+
+    Super::Deinitialize();
+}
+
+bool UTGShotQueueSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTGShotQueueSubsystem::Tick(float DeltaTime)
+{
+    FlushPendingShots();
+}
+
+void UTGShotQueueSubsystem::SubmitShot(UWorld* World, FTGShotRequest&& Request)
+{
+    if (!World)
+    {
+        return;
+    }
+
+    if (CVarTGAsyncShotTraces.GetValueOnGameThread() != 0)
+    {
+        if (UTGShotQueueSubsystem* ShotQueue = World->GetSubsystem<UTGShotQueueSubsystem>())
+        {
+            ShotQueue->QueueShot(MoveTemp(Request));
+            return;
+        }
+    }
+
+    ResolveShotNow(World, Request);
+}
+
+void UTGShotQueueSubsystem::QueueShot(FTGShotRequest&& Request)
+{
+    PendingShots.Add(MoveTemp(Request));
+}
+
+void UTGShotQueueSubsystem::FlushPendingShots()
+{
+    UWorld* World = GetWorld();
+    if (!World || PendingShots.Num() == 0)
+    {
+        ShotsSubmittedLastFlush = 0;
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    for (FTGShotRequest& Shot : PendingShots)
+    {
+        const int32 Slot = AcquireSlot(MoveTemp(Shot.OnResolved));
+
+        World->AsyncLineTraceByChannel(
+            EAsyncTraceType::Single,
+            Shot.Start,
+            Shot.End,
+            Shot.Channel,
+            Shot.QueryParams,
+            FCollisionResponseParams::DefaultResponseParam,
+            &TraceDelegate,
+            static_cast<uint32>(Slot));
+    }
+
+    ShotsSubmittedLastFlush = PendingShots.Num();
+    PendingShots.Reset();
+
+    LastFlushTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+int32 UTGShotQueueSubsystem::AcquireSlot(FTGShotResolved&& OnResolved)
+{
+    if (FreeSlots.Num() > 0)
+    {
+        const int32 Slot = FreeSlots.Pop(EAllowShrinking::No);
+        InFlightShots[Slot] = MoveTemp(OnResolved);
+        return Slot;
+    }
+
+    return InFlightShots.Add(MoveTemp(OnResolved));
+}
+
+void UTGShotQueueSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+    const int32 Slot = static_cast<int32>(Datum.UserData);
+    if (!InFlightShots.IsValidIndex(Slot))
+    {
+        UE_LOG(LogTGCombat, Warning, TEXT("Shot queue received trace result for unknown slot %d"), Slot);
+        return;
+    }
+
+    FTGShotResolved OnResolved = MoveTemp(InFlightShots[Slot]);
+    InFlightShots[Slot].Unbind();
+    FreeSlots.Add(Slot);
+
+    const FHitResult* BlockingHit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+    if (BlockingHit)
+    {
+        OnResolved.ExecuteIfBound(true, *BlockingHit);
+    }
+    else
+    {
+        FHitResult Miss(Datum.Start, Datum.End);
+        OnResolved.ExecuteIfBound(false, Miss);
+    }
+}
+
+void UTGShotQueueSubsystem::ResolveShotNow(UWorld* World, FTGShotRequest& Request)
+{
+    FHitResult HitResult;
+    const bool bHit = World->LineTraceSingleByChannel(HitResult, Request.Start, Request.End, Request.Channel, Request.QueryParams);
+    Request.OnResolved.ExecuteIfBound(bHit, HitResult);
+}
@@ -1,8 +1,15 @@
 #include "TGThermalComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+// Timers fire on frame boundaries; this margin guarantees the resampled heat is past the threshold
+static constexpr float ThermalCrossingMargin = 0.001f;
 
 UTGThermalComponent::UTGThermalComponent() {
-  PrimaryComponentTick.bCanEverTick = true;
+  // Heat is evaluated analytically and threshold crossings are timer driven
+  PrimaryComponentTick.bCanEverTick = false;
   CurrentHeat = 0.0f;
+  HeatTimestamp = 0.0f;
   CurrentThermalState = EThermalState::Cool;
   bIsCooling = false;
   CoolingStartTime = 0.0f;
@@ -10,49 +17,51 @@ UTGThermalComponent::UTGThermalComponent() {
 
 void UTGThermalComponent::BeginPlay() {
   Super::BeginPlay();
+  HeatTimestamp = GetWorldTime();
   UpdateThermalState();
+  ScheduleNextThresholdCrossing();
 }
 
-void UTGThermalComponent::TickComponent(
-    float DeltaTime, ELevelTick TickType,
-    FActorComponentTickFunction *ThisTickFunction) {
-  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-  float EffectiveCooling = PassiveCoolingRate;
-  if (bIsCooling) {
-    EffectiveCooling += CoolingRate;
-  }
-
-  if (CurrentHeat > 0.0f) {
-    CurrentHeat =
-        FMath::Clamp(CurrentHeat - EffectiveCooling * DeltaTime, 0.0f, MaxHeat);
-    UpdateThermalState();
+void UTGThermalComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  if (UWorld *World = GetWorld()) {
+    World->GetTimerManager().ClearTimer(ThermalTimerHandle);
   }
+  Super::EndPlay(EndPlayReason);
 }
 
 void UTGThermalComponent::AddHeat(float HeatAmount) {
+  ResampleHeat();
   CurrentHeat =
       FMath::Clamp(CurrentHeat + FMath::Max(0.0f, HeatAmount), 0.0f, MaxHeat);
   UpdateThermalState();
   if (CurrentHeat >= OverheatThreshold) {
     HandleOverheat();
   }
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGThermalComponent::StartCooling() {
+  ResampleHeat();
   bIsCooling = true;
-  CoolingStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+  CoolingStartTime = GetWorldTime();
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGThermalComponent::ForceCooldown() {
   bIsCooling = false;
   CurrentHeat = 0.0f;
+  HeatTimestamp = GetWorldTime();
   UpdateThermalState();
+  ScheduleNextThresholdCrossing();
   OnCoolingCompleted.Broadcast();
 }
 
+float UTGThermalComponent::GetCurrentHeat() const {
+  return EvaluateHeatAt(GetWorldTime());
+}
+
 float UTGThermalComponent::GetHeatPercentage() const {
-  return (MaxHeat > 0.0f) ? (CurrentHeat / MaxHeat) : 0.0f;
+  return (MaxHeat > 0.0f) ? (GetCurrentHeat() / MaxHeat) : 0.0f;
 }
 
 bool UTGThermalComponent::IsOverheated() const {
@@ -63,17 +72,25 @@ bool UTGThermalComponent::IsOverheated() const {
 bool UTGThermalComponent::CanFire() const { return !IsOverheated(); }
 
 void UTGThermalComponent::SetMaxHeat(float NewMaxHeat) {
+  ResampleHeat();
   MaxHeat = FMath::Max(0.0f, NewMaxHeat);
   CurrentHeat = FMath::Clamp(CurrentHeat, 0.0f, MaxHeat);
   UpdateThermalState();
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGThermalComponent::SetCoolingRate(float NewCoolingRate) {
+  ResampleHeat();
   CoolingRate = FMath::Max(0.0f, NewCoolingRate);
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGThermalComponent::SetOverheatThreshold(float NewThreshold) {
+  // The pending crossing may have been timed against the old threshold
+  ResampleHeat();
   OverheatThreshold = FMath::Clamp(NewThreshold, 0.0f, MaxHeat);
+  UpdateThermalState();
+  ScheduleNextThresholdCrossing();
 }
 
 void UTGThermalComponent::UpdateThermalState() {
@@ -88,7 +105,8 @@ void UTGThermalComponent::UpdateThermalState() {
 }
 
 EThermalState UTGThermalComponent::CalculateThermalState() const {
-  const float Pct = GetHeatPercentage() * 100.0f;
+  // Evaluated against the anchored value; callers resample first
+  const float Pct = (MaxHeat > 0.0f) ? (CurrentHeat / MaxHeat) * 100.0f : 0.0f;
 
   if (Pct >= CriticalThreshold) {
     return EThermalState::Critical;
@@ -106,3 +124,67 @@ EThermalState UTGThermalComponent::CalculateThermalState() const {
 }
 
 void UTGThermalComponent::HandleOverheat() { bIsCooling = true; }
+
+float UTGThermalComponent::GetWorldTime() const {
+  const UWorld *World = GetWorld();
+  return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+float UTGThermalComponent::GetEffectiveCoolingRate() const {
+  return PassiveCoolingRate + (bIsCooling ? CoolingRate : 0.0f);
+}
+
+float UTGThermalComponent::EvaluateHeatAt(float Time) const {
+  const float Elapsed = FMath::Max(0.0f, Time - HeatTimestamp);
+  return FMath::Clamp(CurrentHeat - GetEffectiveCoolingRate() * Elapsed, 0.0f,
+                      MaxHeat);
+}
+
+void UTGThermalComponent::ResampleHeat() {
+  const float Now = GetWorldTime();
+  CurrentHeat = EvaluateHeatAt(Now);
+  HeatTimestamp = Now;
+}
+
+void UTGThermalComponent::ScheduleNextThresholdCrossing() {
+  UWorld *World = GetWorld();
+  if (!World) {
+    return;
+  }
+
+  FTimerManager &TimerManager = World->GetTimerManager();
+  TimerManager.ClearTimer(ThermalTimerHandle);
+
+  const float Rate = GetEffectiveCoolingRate();
+  if (CurrentHeat <= 0.0f || Rate <= 0.0f) {
+    return;
+  }
+
+  // Heat only falls between events, so the next crossing is the highest
+  // threshold at or below the current heat, or zero
+  float Target = 0.0f;
+  const float ThresholdsPct[] = {CriticalThreshold, OverheatThreshold,
+                                 HotThreshold, WarmThreshold};
+  for (const float ThresholdPct : ThresholdsPct) {
+    const float ThresholdHeat = ThresholdPct * 0.01f * MaxHeat;
+    if (ThresholdHeat > 0.0f && ThresholdHeat <= CurrentHeat) {
+      Target = FMath::Max(Target, ThresholdHeat);
+    }
+  }
+
+  const float Delay = (CurrentHeat - Target) / Rate + ThermalCrossingMargin;
+  TimerManager.SetTimer(ThermalTimerHandle, this,
+                        &UTGThermalComponent::OnThresholdTimer, Delay, false);
+}
+
+void UTGThermalComponent::OnThresholdTimer() {
+  ResampleHeat();
+  UpdateThermalState();
+
+  if (CurrentHeat <= 0.0f && bIsCooling) {
+    bIsCooling = false;
+    OnCoolingCompleted.Broadcast();
+  }
+
+  ScheduleNextThresholdCrossing();
+}
@@ -1,9 +1,13 @@
 #include "TGWeapon.h"
 #include "Net/UnrealNetwork.h"
 #include "TGWeaponInstance.h"
+#include "TGShotQueueSubsystem.h"
+#include "TGProjectileSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 
+static constexpr float BaseShotDamage = 25.0f;
+
 ATGWeapon::ATGWeapon() {
   bReplicates = true;
   SetReplicateMovement(true);
@@ -21,6 +25,28 @@ void ATGWeapon::StopFire() { GetWorldTimerManager().ClearTimer(FireTimer); }
 
 void ATGWeapon::Reload() {}
 
+void ATGWeapon::SetWeaponData(UTGWeaponInstance *NewWeaponData) {
+  if (WeaponData) {
+    WeaponData->OnLoadoutCompiled.RemoveAll(this);
+  }
+  WeaponData = NewWeaponData;
+  if (WeaponData) {
+    WeaponData->OnLoadoutCompiled.AddUObject(this,
+                                             &ATGWeapon::RefreshLoadoutStats);
+    WeaponData->CompileLoadout();
+  } else {
+    RefreshLoadoutStats();
+  }
+}
+
+void ATGWeapon::RefreshLoadoutStats() {
+  if (!HasAuthority()) {
+    return;
+  }
+  LoadoutStats = WeaponData ? WeaponData->GetStatBlock() : FTGWeaponStatBlock();
+  OnLoadoutChanged.Broadcast(LoadoutStats);
+}
+
 void ATGWeapon::HandleFireTick() {
   FTGShotParams Params;
   Params.Origin = GetActorLocation();
@@ -40,32 +66,62 @@ void ATGWeapon::ServerFire_Implementation(const FTGShotParams &Params) {
   PerformWeaponTrace(Params);
 }
 
+float ATGWeapon::GetADSTimeSeconds() const {
+  const int32 BaseMs = WeaponData ? WeaponData->ADSTimeMs : 0;
+  return FMath::Max(BaseMs + LoadoutStats.ADS_ms_Add, 0) / 1000.0f;
+}
+
 void ATGWeapon::PerformWeaponTrace(const FTGShotParams& ShotParams) {
   if (!GetWorld()) return;
 
-  FVector Start = ShotParams.Origin;
-  FVector End = Start + (ShotParams.Direction * 10000.0f); // 100m range
+  // Spread only comes from authored weapon data
+  FVector Direction = ShotParams.Direction;
+  if (WeaponData && WeaponData->BaseSpreadDegrees > 0.0f) {
+    Direction = FMath::VRandCone(
+        Direction, FMath::DegreesToRadians(WeaponData->BaseSpreadDegrees));
+  }
+
+  // Charge and siege weapons fire travel-time rounds; the projectile subsystem sweeps and damages them
+  if (WeaponData && WeaponData->ProjectileSpeed > 0.0f) {
+    if (UTGProjectileSubsystem *Projectiles =
+            GetWorld()->GetSubsystem<UTGProjectileSubsystem>()) {
+      FTGProjectileLaunchParams Launch;
+      Launch.Origin = ShotParams.Origin;
+      // Velocity_Add is authored in m/s
+      const float Speed = FMath::Max(
+          WeaponData->ProjectileSpeed + LoadoutStats.Velocity_Add * 100.0f,
+          1.0f);
+      Launch.Velocity = Direction * Speed;
+      Launch.GravityScale = WeaponData->ProjectileGravityScale;
+      Launch.Damage = BaseShotDamage;
+      Launch.MaxLifetime = WeaponData->ProjectileLifetime;
+      Launch.Owner = GetOwner() ? GetOwner() : this;
+      Launch.VisualMesh = WeaponData->ProjectileMesh;
+      Projectiles->LaunchProjectile(Launch);
+      return;
+    }
+  }
 
-  FHitResult HitResult;
-  FCollisionQueryParams QueryParams;
-  QueryParams.AddIgnoredActor(this);
-  QueryParams.AddIgnoredActor(GetOwner());
+  FTGShotRequest Shot;
+  Shot.Start = ShotParams.Origin;
+  Shot.End = Shot.Start + (Direction * 10000.0f); // 100m range
+  Shot.Channel = ECollisionChannel::ECC_Visibility;
+  Shot.QueryParams.AddIgnoredActor(this);
+  Shot.QueryParams.AddIgnoredActor(GetOwner());
+  Shot.OnResolved.BindUObject(this, &ATGWeapon::OnShotResolved);
 
-  bool bHit = GetWorld()->LineTraceSingleByChannel(
-    HitResult,
-    Start,
-    End,
-    ECollisionChannel::ECC_Visibility,
-    QueryParams
-  );
+  // Batched with every other shot this frame, resolves next frame
+  UTGShotQueueSubsystem::SubmitShot(GetWorld(), MoveTemp(Shot));
+}
 
+void ATGWeapon::OnShotResolved(bool bHit, const FHitResult& HitResult) {
   if (bHit) {
     // Apply damage to hit actor
     AActor* HitActor = HitResult.GetActor();
     if (HitActor) {
       UGameplayStatics::ApplyDamage(
         HitActor,
-        25.0f, // Base damage
+        BaseShotDamage,
         GetInstigatorController(),
         this,
         UDamageType::StaticClass()
@@ -74,10 +130,13 @@ void ATGWeapon::PerformWeaponTrace(const FTGShotParams& ShotParams) {
   }
 }
 
-void ATGWeapon::OnRep_WeaponData() {}
+void ATGWeapon::OnRep_LoadoutStats() {
+  OnLoadoutChanged.Broadcast(LoadoutStats);
+}
 
 void ATGWeapon::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty> &OutLifetimeProps) const {
   Super::GetLifetimeReplicatedProps(OutLifetimeProps);
   DOREPLIFETIME(ATGWeapon, WeaponData);
+  DOREPLIFETIME(ATGWeapon, LoadoutStats);
 }
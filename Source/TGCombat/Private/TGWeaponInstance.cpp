@@ -1 +1,34 @@
 #include "TGWeaponInstance.h"
+#include "TGAttachmentDef.h"
+
+void UTGWeaponInstance::CompileLoadout() {
+  TArray<const UTGAttachmentDef *, TInlineAllocator<8>> Defs;
+  for (const UTGAttachmentDef *Def : Attachments) {
+    Defs.Add(Def);
+  }
+  CompiledStats = FTGAttachmentStatCompiler::Compile(Defs);
+  OnLoadoutCompiled.Broadcast();
+}
+
+bool UTGWeaponInstance::SetAttachment(UTGAttachmentDef *Attachment) {
+  if (!Attachment) {
+    return false;
+  }
+  // Replace whatever occupies the same slot
+  const int32 Existing = Attachments.IndexOfByPredicate(
+      [Attachment](const UTGAttachmentDef *Def) {
+        return Def && Def->Slot == Attachment->Slot;
+      });
+  if (Existing != INDEX_NONE) {
+    Attachments[Existing] = Attachment;
+  } else {
+    Attachments.Add(Attachment);
+  }
+  CompileLoadout();
+  return true;
+}
+
+const FTGWeaponStatBlock &UTGWeaponInstance::GetStatBlock() const {
+  static const FTGWeaponStatBlock Identity;
+  return CompiledStats.IsValid() ? *CompiledStats : Identity;
+}
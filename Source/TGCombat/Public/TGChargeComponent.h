@@ -21,6 +21,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnChargeDisrupted);
 
 /**
  * Component managing energy charge for Hybrid and Alien technology weapons
+ * Charge is stored as (value, timestamp) and moves linearly at the current charge/discharge rate,
+ * so the live value is evaluated on demand; the component never ticks and only schedules timers
+ * for threshold crossings and EMP expiry
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class TGCOMBAT_API UTGChargeComponent : public UActorComponent
@@ -32,7 +35,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     // Charge Management
@@ -52,7 +55,7 @@ public:
     void ForceOvercharge();
 
     UFUNCTION(BlueprintPure, Category = "Charge")
-    float GetCurrentCharge() const { return CurrentCharge; }
+    float GetCurrentCharge() const;
 
     UFUNCTION(BlueprintPure, Category = "Charge")
     float GetMaxCharge() const { return MaxCharge; }
@@ -116,10 +119,13 @@ public:
     FOnChargeDisrupted OnChargeDisrupted;
 
 protected:
-    // Current charge state
+    // Charge at ChargeTimestamp; use GetCurrentCharge() for the live value
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
     float CurrentCharge;
 
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
+    float ChargeTimestamp;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
     EChargeState CurrentChargeState;
 
@@ -168,8 +174,19 @@ protected:
     float SiegeModifierEndTime = 0.0f;
 
 private:
+    FTimerHandle ChargeTimerHandle;
+    FTimerHandle EMPTimerHandle;
+
     void UpdateChargeState();
     EChargeState CalculateChargeState() const;
     void HandleOvercharge();
-    void ProcessEMPDisruption(float DeltaTime);
+    void OnEMPDisruptionExpired();
+
+    // Closed-form evaluation
+    float GetWorldTime() const;
+    float GetChargeRatePerSecond() const;
+    float EvaluateChargeAt(float Time) const;
+    void ResampleCharge();
+    void ScheduleNextThresholdCrossing();
+    void OnThresholdTimer();
 };
\ No newline at end of file
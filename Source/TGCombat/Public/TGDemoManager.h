@@ -68,10 +68,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Demo")
     FVector GetRandomSpawnLocation() const;
 
+    // Live enemies: spawned and promoted grunts plus enemies still in the crowd
+    UFUNCTION(BlueprintPure, Category = "Demo")
+    int32 GetEnemyCount() const;
+
     UFUNCTION(BlueprintCallable, Category = "Demo")
     void ResetDemo();
 
 private:
+    UFUNCTION()
+    void HandleGruntPromoted(ATGEnemyGrunt* Grunt);
+
     void CreateBasicCover();
     void CreatePatrolWaypoints();
 };
@@ -96,7 +96,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Demo Setup")
     void LogDemoStatus() const;
 
+    // Live enemies: spawned and promoted grunts plus enemies still in the crowd
+    UFUNCTION(BlueprintPure, Category = "Demo Setup")
+    int32 GetEnemyCount() const;
+
 private:
+    UFUNCTION()
+    void HandleGruntPromoted(ATGEnemyGrunt* Grunt);
+
     void CreateBasicCover();
     void CreatePatrolWaypoints();
     void SetupAtmosphericLighting();
@@ -84,6 +84,7 @@ public:
 
 protected:
     void PerformLineTrace();
+    void OnLineTraceResolved(bool bHit, const FHitResult& HitResult, FVector Start, FVector End);
     void SpawnImpactEffect(FVector Location, FVector Normal);
     void PlayFireEffects();
     void PlayReloadEffects();
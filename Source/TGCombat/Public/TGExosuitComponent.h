@@ -11,6 +11,7 @@ class UTGAugmentData;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnExosuitDamageChanged, EExosuitDamageStage, OldStage, EExosuitDamageStage, NewStage);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAugmentInstalled, UTGAugmentData*, AugmentData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAugmentRemoved, UTGAugmentData*, AugmentData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnExosuitStatsChanged, const FExosuitStats&, NewStats);
 
 /**
  * Component that manages player exosuit configuration and augments
@@ -25,7 +26,6 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
     // Exosuit Management
@@ -60,18 +60,18 @@ public:
     UFUNCTION(BlueprintPure, Category = "Augments")
     int32 GetAvailableAugmentSlots() const;
 
-    // Stats Calculation
+    // Stats (compiled when the frame, damage stage or augments change; reads are plain field loads)
     UFUNCTION(BlueprintPure, Category = "Stats")
-    FExosuitStats GetEffectiveStats() const;
+    FExosuitStats GetEffectiveStats() const { return CompiledStats; }
 
     UFUNCTION(BlueprintPure, Category = "Stats")
-    float GetMovementSpeedMultiplier() const;
+    float GetMovementSpeedMultiplier() const { return CompiledStats.MovementSpeedMultiplier; }
 
     UFUNCTION(BlueprintPure, Category = "Stats")
-    float GetRecoilReduction() const;
+    float GetRecoilReduction() const { return CompiledStats.RecoilReductionPercentage; }
 
     UFUNCTION(BlueprintPure, Category = "Stats")
-    float GetArmorRating() const;
+    float GetArmorRating() const { return CompiledStats.ArmorRating; }
 
     // Events
     UPROPERTY(BlueprintAssignable, Category = "Events")
@@ -83,6 +83,10 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnAugmentRemoved OnAugmentRemoved;
 
+    /** Fired after the compiled stat block changes; movement and weapons should cache from here */
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnExosuitStatsChanged OnExosuitStatsChanged;
+
 protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Exosuit")
     UTGExosuitData* CurrentExosuitData;
@@ -99,6 +103,10 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augments")
     TArray<UTGAugmentData*> InstalledAugments;
 
+    /** Base stats with the current damage stage modifier and installed augments folded in */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+    FExosuitStats CompiledStats;
+
     // Health thresholds for damage stages
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Config")
     float MinorDamageThreshold = 0.8f;
@@ -115,5 +123,6 @@ protected:
 private:
     void UpdateDamageStage();
     void UpdateVisualDamage();
+    void RebuildCompiledStats();
     bool ValidateAugmentInstallation(UTGAugmentData* AugmentData, int32 SlotIndex) const;
 };
\ No newline at end of file
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Engine/EngineTypes.h"
+#include "TGProjectileSubsystem.generated.h"
+
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+
+/** Native impact callback for effects (damage is already applied when this fires) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnTGProjectileImpact, const FHitResult& /*Hit*/, AActor* /*ProjectileOwner*/);
+
+/**
+ * Parameters for launching a single projectile
+ */
+USTRUCT(BlueprintType)
+struct TGCOMBAT_API FTGProjectileLaunchParams
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+    FVector Origin = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+    FVector Velocity = FVector::ZeroVector;
+
+    /** Multiplier on world gravity (0 = straight line, 1 = ballistic) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+    float GravityScale = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+    float Damage = 25.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+    float MaxLifetime = 5.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+    AActor* Owner = nullptr;
+
+    /** Optional mesh drawn through a pooled instanced component; null = invisible */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+    UStaticMesh* VisualMesh = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+    FVector VisualScale = FVector(0.1f);
+};
+
+/**
+ * Projectile Simulation Subsystem
+ * Simulates travel-time projectiles (charge and siege weapons) without spawning an actor each.
+ * State is stored as parallel arrays, integrated with a fixed sub-step, swept in parallel
+ * batches under a per-frame time budget, and drawn through pooled instanced static meshes.
+ */
+UCLASS()
+class TGCOMBAT_API UTGProjectileSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // UWorldSubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGProjectileSubsystem, STATGROUP_Tickables); }
+    virtual bool IsTickable() const override { return !IsTemplate() && Positions.Num() > 0; }
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+    UFUNCTION(BlueprintCallable, Category = "Projectiles")
+    void LaunchProjectile(const FTGProjectileLaunchParams& Params);
+
+    UFUNCTION(BlueprintPure, Category = "Projectiles")
+    int32 GetLiveProjectileCount() const { return Positions.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "Projectiles")
+    void ClearAllProjectiles();
+
+    // Events
+    FOnTGProjectileImpact OnProjectileImpact;
+
+    // Configuration
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectiles|Config", meta = (ClampMin = "0.001"))
+    float FixedSubStep = 1.0f / 60.0f;
+
+    /** Upper bound on sub-steps per frame so a hitch cannot spiral */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectiles|Config", meta = (ClampMin = "1"))
+    int32 MaxSubStepsPerFrame = 4;
+
+    /** Game thread time per frame for sweeps; projectiles not reached keep their unswept segment for next frame.
+        Projectiles that expired this frame are always swept so their final segment can still hit */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectiles|Config", meta = (ClampMin = "0.0"))
+    float SweepBudgetMs = 1.0f;
+
+    /** Projectiles per parallel sweep batch */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectiles|Config", meta = (ClampMin = "1"))
+    int32 SweepBatchSize = 64;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectiles|Config")
+    TEnumAsByte<ECollisionChannel> SweepChannel = ECC_Visibility;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectiles|Config")
+    int32 MaxLiveProjectiles = 8192;
+
+    // Stats
+    double GetLastSimulationTimeMs() const { return LastSimulationTimeMs; }
+    int32 GetLastSweepCount() const { return LastSweepCount; }
+
+private:
+    // Structure-of-arrays projectile state (all arrays share one index space)
+    TArray<FVector> Positions;
+    TArray<FVector> Velocities;
+    TArray<FVector> SweptFrom;      // Last position already checked for collision
+    TArray<float> GravityScales;
+    TArray<float> Damages;
+    TArray<float> RemainingLife;
+    TArray<TWeakObjectPtr<AActor>> Owners;
+    TArray<int32> VisualIndices;    // Index into VisualMeshes, INDEX_NONE if invisible
+    TArray<FVector> VisualScales;
+
+    // Pooled visuals
+    UPROPERTY()
+    AActor* VisualActor = nullptr;
+
+    UPROPERTY()
+    TArray<UStaticMesh*> VisualMeshes;
+
+    UPROPERTY()
+    TArray<UInstancedStaticMeshComponent*> VisualComponents;
+
+    TArray<int32> VisualInstanceCounts;
+    TArray<TArray<FTransform>> VisualTransforms; // Per-visual scratch, reset each frame
+
+    // Sweep scratch, kept across frames
+    TArray<int32> SweepOrder;
+    TArray<FHitResult> SweepHits;
+    TArray<uint8> SweepHitFlags;
+
+    // Structural changes requested by impact handlers while the sweep still holds indices
+    bool bResolvingImpacts = false;
+    bool bClearPending = false;
+    TArray<FTGProjectileLaunchParams> PendingLaunches;
+
+    float TimeAccumulator = 0.0f;
+    int32 SweepCursor = 0;
+
+    double LastSimulationTimeMs = 0.0;
+    int32 LastSweepCount = 0;
+
+    void Integrate(float StepSeconds);
+    void AgeProjectiles(float DeltaSeconds);
+    void SweepProjectiles();
+    void UpdateVisuals();
+    void RemoveProjectileAt(int32 Index);
+
+    int32 FindOrCreateVisual(UStaticMesh* Mesh);
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Engine/EngineTypes.h"
+#include "CollisionQueryParams.h"
+#include "WorldCollision.h"
+#include "TGShotQueueSubsystem.generated.h"
+
+/** Fired when a queued shot's trace has resolved (next frame for async traces) */
+DECLARE_DELEGATE_TwoParams(FTGShotResolved, bool /*bHit*/, const FHitResult& /*HitResult*/);
+
+/**
+ * A single hitscan shot waiting to be traced
+ */
+struct TGCOMBAT_API FTGShotRequest
+{
+    FVector Start = FVector::ZeroVector;
+    FVector End = FVector::ZeroVector;
+    ECollisionChannel Channel = ECC_Visibility;
+    FCollisionQueryParams QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(TGShotTrace), false);
+    FTGShotResolved OnResolved;
+};
+
+/**
+ * Shot Queue Subsystem
+ * Collects every hitscan shot fired during a frame and submits them together as
+ * async line traces, so weapon fire never blocks the game thread on physics queries.
+ * Results are delivered next frame through each shot's FTGShotResolved callback.
+ */
+UCLASS()
+class TGCOMBAT_API UTGShotQueueSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // UWorldSubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGShotQueueSubsystem, STATGROUP_Tickables); }
+    virtual bool IsTickable() const override { return !IsTemplate() && PendingShots.Num() > 0; }
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+    /**
+     * Queue a shot through the world's shot queue, or trace it immediately if the world has none
+     * (editor preview worlds, or async traces disabled via tg.Combat.AsyncShotTraces 0)
+     */
+    static void SubmitShot(UWorld* World, FTGShotRequest&& Request);
+
+    /** Queue a shot for submission at the end of this frame */
+    void QueueShot(FTGShotRequest&& Request);
+
+    /** Submit all shots queued this frame as async traces (called from Tick) */
+    void FlushPendingShots();
+
+    // Stats
+    int32 GetPendingShotCount() const { return PendingShots.Num(); }
+    int32 GetInFlightShotCount() const { return InFlightShots.Num() - FreeSlots.Num(); }
+    int32 GetShotsSubmittedLastFlush() const { return ShotsSubmittedLastFlush; }
+    double GetLastFlushTimeMs() const { return LastFlushTimeMs; }
+
+private:
+    /** Shots fired this frame, not yet submitted */
+    TArray<FTGShotRequest> PendingShots;
+
+    /** Submitted shots awaiting trace results, indexed by the trace UserData */
+    TArray<FTGShotResolved> InFlightShots;
+    TArray<int32> FreeSlots;
+
+    FTraceDelegate TraceDelegate;
+
+    int32 ShotsSubmittedLastFlush = 0;
+    double LastFlushTimeMs = 0.0;
+
+    int32 AcquireSlot(FTGShotResolved&& OnResolved);
+    void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+    static void ResolveShotNow(UWorld* World, FTGShotRequest& Request);
+};
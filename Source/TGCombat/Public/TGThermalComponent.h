@@ -20,6 +20,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCoolingCompleted);
 
 /**
  * Component managing heat buildup for Hybrid technology weapons
+ * Heat is stored as (value, timestamp) and cools linearly, so the current value is evaluated
+ * on demand; the component never ticks and only schedules timers for threshold crossings
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class TGCOMBAT_API UTGThermalComponent : public UActorComponent
@@ -31,7 +33,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     // Heat Management
@@ -45,7 +47,7 @@ public:
     void ForceCooldown();
 
     UFUNCTION(BlueprintPure, Category = "Thermal")
-    float GetCurrentHeat() const { return CurrentHeat; }
+    float GetCurrentHeat() const;
 
     UFUNCTION(BlueprintPure, Category = "Thermal")
     float GetMaxHeat() const { return MaxHeat; }
@@ -83,10 +85,13 @@ public:
     FOnCoolingCompleted OnCoolingCompleted;
 
 protected:
-    // Current heat state
+    // Heat at HeatTimestamp; use GetCurrentHeat() for the live value
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
     float CurrentHeat;
 
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
+    float HeatTimestamp;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
     EThermalState CurrentThermalState;
 
@@ -123,7 +128,17 @@ protected:
     float HotThreshold = 60.0f;
 
 private:
+    FTimerHandle ThermalTimerHandle;
+
     void UpdateThermalState();
     EThermalState CalculateThermalState() const;
     void HandleOverheat();
+
+    // Closed-form evaluation
+    float GetWorldTime() const;
+    float GetEffectiveCoolingRate() const;
+    float EvaluateHeatAt(float Time) const;
+    void ResampleHeat();
+    void ScheduleNextThresholdCrossing();
+    void OnThresholdTimer();
 };
\ No newline at end of file
@@ -2,10 +2,13 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
+#include "TGAttachmentStatCompiler.h"
 #include "TGWeapon.generated.h"
 
 class UTGWeaponInstance;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWeaponLoadoutChanged, const FTGWeaponStatBlock&, NewStats);
+
 USTRUCT(BlueprintType)
 struct FTGShotParams {
   GENERATED_BODY()
@@ -24,6 +27,24 @@ public:
   UFUNCTION(BlueprintCallable) void StopFire();
   UFUNCTION(BlueprintCallable) void Reload();
 
+  // Equips a weapon instance and compiles its attachment loadout
+  UFUNCTION(BlueprintCallable, Category = "Weapon")
+  void SetWeaponData(UTGWeaponInstance* NewWeaponData);
+
+  UFUNCTION(BlueprintPure, Category = "Weapon")
+  UTGWeaponInstance* GetWeaponData() const { return WeaponData; }
+
+  // Loadout stats compiled on the server and replicated; valid on every machine
+  UFUNCTION(BlueprintPure, Category = "Weapon")
+  const FTGWeaponStatBlock& GetLoadoutStats() const { return LoadoutStats; }
+
+  // Aim-down-sights transition time: the weapon's base plus the loadout's ADS_ms_Add
+  UFUNCTION(BlueprintPure, Category = "Weapon")
+  float GetADSTimeSeconds() const;
+
+  UPROPERTY(BlueprintAssignable, Category = "Weapon")
+  FOnWeaponLoadoutChanged OnLoadoutChanged;
+
   // Siege & GAS Integration
   UFUNCTION(BlueprintCallable, Category = "Weapon|Siege")
   void StartFireWithTags(const FGameplayTagContainer& SiegeBuffTags);
@@ -45,8 +66,12 @@ public:
   void PerformWeaponTrace(const FTGShotParams& ShotParams);
 
 protected:
-  UPROPERTY(ReplicatedUsing = OnRep_WeaponData)
+  UPROPERTY(Replicated)
   TObjectPtr<UTGWeaponInstance> WeaponData;
+
+  // The instance's attachments do not replicate, so clients read the compiled block instead
+  UPROPERTY(ReplicatedUsing = OnRep_LoadoutStats)
+  FTGWeaponStatBlock LoadoutStats;
   FTimerHandle FireTimer;
 
   // Siege Modifiers
@@ -62,11 +87,17 @@ protected:
   UPROPERTY(BlueprintReadOnly, Category = "Weapon|Siege")
   FGameplayTagContainer ActiveSiegeTags;
 
-  UFUNCTION() void OnRep_WeaponData();
+  UFUNCTION() void OnRep_LoadoutStats();
+
+  // Copies the instance's compiled block for replication (server)
+  void RefreshLoadoutStats();
 
   UFUNCTION(Server, Reliable) void ServerFire(const FTGShotParams &Params);
   void HandleFireTick();
 
+  // Called by the shot queue once the trace for a fired shot has resolved
+  void OnShotResolved(bool bHit, const FHitResult& HitResult);
+
   virtual void GetLifetimeReplicatedProps(
       TArray<FLifetimeProperty> &OutLifetimeProps) const override;
 };
@@ -1,8 +1,12 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "TGAttachmentStatCompiler.h"
 #include "TGWeaponInstance.generated.h"
 
+class UTGAttachmentDef;
+class UStaticMesh;
+
 UCLASS(BlueprintType)
 class TGCOMBAT_API UTGWeaponInstance : public UObject
 {
@@ -11,4 +15,32 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Weapon") FName WeaponId;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Weapon") int32 MagazineSize = 30;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Weapon") float FireRate = 0.1f; // seconds between shots
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Weapon") float BaseSpreadDegrees = 0.f; // authored cone; 0 fires dead on the aim line
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Weapon") int32 ADSTimeMs = 220; // before attachments; ADS_ms in Weapons.csv
+
+	// Travel-time rounds for charge and siege weapons, simulated by UTGProjectileSubsystem; 0 speed fires a hitscan trace
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Projectile") float ProjectileSpeed = 0.f; // cm/s
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Projectile") float ProjectileGravityScale = 1.f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Projectile") float ProjectileLifetime = 5.f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Projectile") TObjectPtr<UStaticMesh> ProjectileMesh;
+
+	// One attachment per slot; call CompileLoadout after changing
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Attachments") TArray<TObjectPtr<UTGAttachmentDef>> Attachments;
+
+	// Folds the attachments into a shared stat block; done once at equip time, not per shot.
+	// Attachments are server state: clients read the block ATGWeapon replicates
+	UFUNCTION(BlueprintCallable, Category="Attachments") void CompileLoadout();
+
+	// Fires after every compile so the owning weapon can push the new block to clients
+	FSimpleMulticastDelegate OnLoadoutCompiled;
+
+	UFUNCTION(BlueprintCallable, Category="Attachments") bool SetAttachment(UTGAttachmentDef* Attachment);
+
+	// Precomputed stats for the fire path (identity block until compiled)
+	const FTGWeaponStatBlock& GetStatBlock() const;
+
+	UFUNCTION(BlueprintPure, Category="Attachments") FTGWeaponStatBlock GetCompiledStats() const { return GetStatBlock(); }
+
+private:
+	TSharedPtr<const FTGWeaponStatBlock> CompiledStats;
 };
@@ -5,8 +5,11 @@ public class TGCombat : ModuleRules
     public TGCombat(ReadOnlyTargetRules Target) : base(Target)
     {
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
-        PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "GameplayTags" });
+        PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "GameplayTags", "TGAttachments" });
 
         PrivateDependencyModuleNames.AddRange(new string[] { });
+
+        // Header-only automation test helpers
+        PrivateIncludePathModuleNames.AddRange(new string[] { "TGCore" });
     }
 }
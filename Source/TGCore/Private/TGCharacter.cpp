@@ -9,3 +9,12 @@ void ATGCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 }
+
+void ATGCharacter::SetFactionID(int32 NewFactionID)
+{
+	if (FactionID != NewFactionID)
+	{
+		FactionID = NewFactionID;
+		OnFactionChanged.Broadcast(this);
+	}
+}
@@ -128,8 +128,8 @@ void ATGCompleteTestActor::SetupCombatScenario()
         // Setup the demo
         SpawnedDemoSetup->SetupCompleteDemo();
         
-        UE_LOG(LogTemp, Warning, TEXT("Combat scenario setup complete: %d enemies spawned"), SpawnedDemoSetup->SpawnedEnemies.Num());
-        OnCombatSetupComplete(SpawnedDemoSetup->SpawnedEnemies.Num());
+        UE_LOG(LogTemp, Warning, TEXT("Combat scenario setup complete: %d enemies spawned"), SpawnedDemoSetup->GetEnemyCount());
+        OnCombatSetupComplete(SpawnedDemoSetup->GetEnemyCount());
     }
     else
     {
@@ -1,5 +1,6 @@
 #include "TGEconomicVictorySubsystem.h"
 #include "TGWorld/Public/Economy/TGConvoyEconomySubsystem.h"
+#include "TGWorld/Public/Economy/TGEconomicWarfareSubsystem.h"
 #include "TGTerritorial/Public/TerritorialManager.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
@@ -14,6 +15,7 @@ void UTGEconomicVictorySubsystem::Initialize(FSubsystemCollectionBase& Collectio
     
     // Initialize default victory conditions
     InitializeDefaultVictoryConditions();
+    ResetVictoryProgress();
     
     // Reset session state
     SessionStartTime = GetWorld()->GetTimeSeconds();
@@ -27,6 +29,7 @@ void UTGEconomicVictorySubsystem::Deinitialize()
     EndEconomicVictorySession();
     VictoryConditions.Empty();
     VictoryProgress.Empty();
+    VictoryProgressTracked.Empty();
     FactionMetrics.Empty();
     
     Super::Deinitialize();
@@ -123,11 +126,10 @@ TArray<FEconomicVictoryCondition> UTGEconomicVictorySubsystem::GetActiveVictoryC
 
 FEconomicVictoryProgress UTGEconomicVictorySubsystem::GetFactionVictoryProgress(int32 FactionID, EEconomicVictoryType VictoryType) const
 {
-    FString ProgressKey = GenerateProgressKey(FactionID, VictoryType);
-    
-    if (const FEconomicVictoryProgress* Progress = VictoryProgress.Find(ProgressKey))
+    const int32 ProgressIndex = GetProgressIndex(FactionID, VictoryType);
+    if (ProgressIndex != INDEX_NONE && VictoryProgressTracked[ProgressIndex])
     {
-        return *Progress;
+        return VictoryProgress[ProgressIndex];
     }
     
     // Return default progress
@@ -141,9 +143,12 @@ TArray<FEconomicVictoryProgress> UTGEconomicVictorySubsystem::GetAllVictoryProgr
 {
     TArray<FEconomicVictoryProgress> AllProgress;
     
-    for (const auto& ProgressPair : VictoryProgress)
+    for (int32 ProgressIndex = 0; ProgressIndex < VictoryProgress.Num(); ProgressIndex++)
     {
-        AllProgress.Add(ProgressPair.Value);
+        if (VictoryProgressTracked[ProgressIndex])
+        {
+            AllProgress.Add(VictoryProgress[ProgressIndex]);
+        }
     }
     
     // Sort by progress descending
@@ -159,10 +164,10 @@ FEconomicVictoryProgress UTGEconomicVictorySubsystem::GetClosestVictoryToComplet
     FEconomicVictoryProgress ClosestVictory;
     float HighestProgress = 0.0f;
     
-    for (const auto& ProgressPair : VictoryProgress)
+    for (int32 ProgressIndex = 0; ProgressIndex < VictoryProgress.Num(); ProgressIndex++)
     {
-        const FEconomicVictoryProgress& Progress = ProgressPair.Value;
-        if (Progress.Progress > HighestProgress && Progress.Status == EEconomicVictoryStatus::InProgress)
+        const FEconomicVictoryProgress& Progress = VictoryProgress[ProgressIndex];
+        if (VictoryProgressTracked[ProgressIndex] && Progress.Progress > HighestProgress && Progress.Status == EEconomicVictoryStatus::InProgress)
         {
             HighestProgress = Progress.Progress;
             ClosestVictory = Progress;
@@ -189,62 +194,83 @@ void UTGEconomicVictorySubsystem::UpdateEconomicMetrics(int32 FactionID)
         return;
     }
     
-    FEconomicMetrics Metrics;
-    
-    // Get all convoy routes
-    TArray<FConvoyRoute> AllRoutes = ConvoyEconomySubsystem->GetAllRoutes();
-    TArray<FConvoyRoute> FactionRoutes = ConvoyEconomySubsystem->GetRoutesByFaction(FactionID);
+    RefreshRouteTotals();
+    BuildEconomicMetrics(FactionID);
+}
+
+void UTGEconomicVictorySubsystem::RefreshRouteTotals() const
+{
+    // Routes keep their controller and value once registered, so the route set version covers every input
+    if (!ConvoyEconomySubsystem)
+    {
+        RouteTotals = FRouteTotals();
+        bRouteTotalsValid = false;
+        return;
+    }
     
-    // Calculate basic route control
-    Metrics.TotalRoutes = AllRoutes.Num();
-    Metrics.ControlledRoutes = FactionRoutes.Num();
+    const uint32 RouteSetVersion = ConvoyEconomySubsystem->GetRouteSetVersion();
+    if (bRouteTotalsValid && RouteTotalsVersion == RouteSetVersion)
+    {
+        return;
+    }
     
-    // Calculate route values
-    float TotalValue = 0.0f;
-    float ControlledValue = 0.0f;
+    RouteTotals = FRouteTotals();
+    RouteTotalsVersion = RouteSetVersion;
+    bRouteTotalsValid = true;
     
-    for (const FConvoyRoute& Route : AllRoutes)
+    // One pass over the live routes, aggregated for every faction at once
+    ConvoyEconomySubsystem->ForEachRoute([this](const FConvoyRoute& Route)
     {
-        float RouteValue = Route.BaseIntegrityImpact * Route.DifficultyMultiplier;
-        TotalValue += RouteValue;
+        const float RouteValue = Route.BaseIntegrityImpact * Route.DifficultyMultiplier;
+        RouteTotals.TotalRoutes++;
+        RouteTotals.TotalValue += RouteValue;
         
-        if (Route.FactionControllerID == FactionID)
+        if (Route.ControllingFactionId >= 0 && Route.ControllingFactionId < NumTrackedFactions)
         {
-            ControlledValue += RouteValue;
+            RouteTotals.FactionRoutes[Route.ControllingFactionId]++;
+            RouteTotals.FactionValue[Route.ControllingFactionId] += RouteValue;
         }
-    }
+    });
+}
+
+void UTGEconomicVictorySubsystem::BuildEconomicMetrics(int32 FactionID)
+{
+    FEconomicMetrics Metrics;
+    const bool bTracked = FactionID >= 0 && FactionID < NumTrackedFactions;
     
-    Metrics.TotalRouteValue = TotalValue;
-    Metrics.ControlledRouteValue = ControlledValue;
-    Metrics.RouteControlPercentage = TotalValue > 0.0f ? (ControlledValue / TotalValue) : 0.0f;
+    // Calculate basic route control
+    Metrics.TotalRoutes = RouteTotals.TotalRoutes;
+    Metrics.ControlledRoutes = bTracked ? RouteTotals.FactionRoutes[FactionID] : 0;
+    
+    // Calculate route values
+    Metrics.TotalRouteValue = RouteTotals.TotalValue;
+    Metrics.ControlledRouteValue = bTracked ? RouteTotals.FactionValue[FactionID] : 0.0f;
+    Metrics.RouteControlPercentage = GetRouteValueShare(FactionID);
     
-    // Calculate resource control percentages
+    // Calculate resource control percentages; routes carry no resource type yet, so every type shares the route count
+    const float RouteShare = GetRouteShare(FactionID);
     for (int32 ResourceIndex = 0; ResourceIndex < (int32)EResourceType::Personnel + 1; ResourceIndex++)
     {
-        EResourceType ResourceType = (EResourceType)ResourceIndex;
-        float ResourceControl = GetRouteControlPercentage(FactionID, ResourceType);
-        Metrics.ResourceControlPercentage.Add(ResourceType, ResourceControl);
+        Metrics.ResourceControlPercentage.Add((EResourceType)ResourceIndex, RouteShare);
     }
     
     // Calculate network connectivity
     Metrics.NetworkConnectivity = CalculateNetworkConnectivity(FactionID);
     
     // Calculate enemy economic output impact
-    TArray<int32> AllFactionIDs = {0, 1, 2, 3, 4, 5, 6}; // Assuming 7 factions
-    for (int32 EnemyFactionID : AllFactionIDs)
+    for (int32 EnemyFactionID = 0; EnemyFactionID < NumTrackedFactions; EnemyFactionID++)
     {
         if (EnemyFactionID != FactionID)
         {
-            float EconomicOutput = CalculateEconomicOutput(EnemyFactionID);
-            Metrics.EnemyEconomicOutput.Add(EnemyFactionID, EconomicOutput);
+            Metrics.EnemyEconomicOutput.Add(EnemyFactionID, CalculateEconomicOutput(EnemyFactionID));
         }
     }
     
     // Store updated metrics
-    FactionMetrics.Add(FactionID, Metrics);
+    FEconomicMetrics& StoredMetrics = FactionMetrics.Add(FactionID, MoveTemp(Metrics));
     
     // Broadcast update
-    OnEconomicMetricsUpdated.Broadcast(FactionID, Metrics);
+    OnEconomicMetricsUpdated.Broadcast(FactionID, StoredMetrics);
 }
 
 float UTGEconomicVictorySubsystem::GetRouteControlPercentage(int32 FactionID, EResourceType ResourceType) const
@@ -254,34 +280,53 @@ float UTGEconomicVictorySubsystem::GetRouteControlPercentage(int32 FactionID, ER
         return 0.0f;
     }
     
-    TArray<FConvoyRoute> AllRoutes = ConvoyEconomySubsystem->GetAllRoutes();
-    
     float TotalResourceRoutes = 0.0f;
     float ControlledResourceRoutes = 0.0f;
     
-    for (const FConvoyRoute& Route : AllRoutes)
+    ConvoyEconomySubsystem->ForEachRoute([FactionID, &TotalResourceRoutes, &ControlledResourceRoutes](const FConvoyRoute& Route)
     {
         // For now, consider all routes as supply routes
         // In a more advanced system, routes would have specific resource types
         TotalResourceRoutes += 1.0f;
         
-        if (Route.FactionControllerID == FactionID)
+        if (Route.ControllingFactionId == FactionID)
         {
             ControlledResourceRoutes += 1.0f;
         }
-    }
+    });
     
     return TotalResourceRoutes > 0.0f ? (ControlledResourceRoutes / TotalResourceRoutes) : 0.0f;
 }
 
+float UTGEconomicVictorySubsystem::GetRouteShare(int32 FactionID) const
+{
+    if (RouteTotals.TotalRoutes == 0 || FactionID < 0 || FactionID >= NumTrackedFactions)
+    {
+        return 0.0f;
+    }
+    
+    return float(RouteTotals.FactionRoutes[FactionID]) / RouteTotals.TotalRoutes;
+}
+
+float UTGEconomicVictorySubsystem::GetRouteValueShare(int32 FactionID) const
+{
+    if (RouteTotals.TotalValue <= 0.0f || FactionID < 0 || FactionID >= NumTrackedFactions)
+    {
+        return 0.0f;
+    }
+    
+    return RouteTotals.FactionValue[FactionID] / RouteTotals.TotalValue;
+}
+
 void UTGEconomicVictorySubsystem::EvaluateVictoryConditions()
 {
-    TArray<int32> ActiveFactions = {0, 1, 2, 3, 4, 5, 6}; // Assuming 7 factions
+    // Route aggregates for every faction from a single scan
+    RefreshRouteTotals();
     
-    for (int32 FactionID : ActiveFactions)
+    for (int32 FactionID = 0; FactionID < NumTrackedFactions; FactionID++)
     {
         // Update economic metrics for this faction
-        UpdateEconomicMetrics(FactionID);
+        BuildEconomicMetrics(FactionID);
         
         // Check each victory condition
         for (const FEconomicVictoryCondition& Condition : VictoryConditions)
@@ -291,19 +336,10 @@ void UTGEconomicVictorySubsystem::EvaluateVictoryConditions()
                 continue;
             }
             
-            bool bConditionMet = CheckVictoryCondition(FactionID, Condition);
-            FString ProgressKey = GenerateProgressKey(FactionID, Condition.VictoryType);
-            
-            // Get or create progress tracking
-            FEconomicVictoryProgress* Progress = VictoryProgress.Find(ProgressKey);
-            if (!Progress)
-            {
-                FEconomicVictoryProgress NewProgress;
-                NewProgress.FactionID = FactionID;
-                NewProgress.VictoryType = Condition.VictoryType;
-                VictoryProgress.Add(ProgressKey, NewProgress);
-                Progress = &VictoryProgress[ProgressKey];
-            }
+            // Start tracking the slot on first evaluation
+            const int32 ProgressIndex = GetProgressIndex(FactionID, Condition.VictoryType);
+            VictoryProgressTracked[ProgressIndex] = true;
+            FEconomicVictoryProgress* Progress = &VictoryProgress[ProgressIndex];
             
             // Calculate current progress
             float NewProgress = 0.0f;
@@ -380,6 +416,9 @@ void UTGEconomicVictorySubsystem::EvaluateVictoryConditions()
 
 bool UTGEconomicVictorySubsystem::CheckVictoryCondition(int32 FactionID, const FEconomicVictoryCondition& Condition) const
 {
+    // Callable between evaluations, so bring the route totals up to date first
+    RefreshRouteTotals();
+    
     float Progress = 0.0f;
     
     switch (Condition.VictoryType)
@@ -483,7 +522,7 @@ void UTGEconomicVictorySubsystem::StartEconomicVictorySession()
     LastVictoryCheck = 0.0f;
     
     // Clear previous session data
-    VictoryProgress.Empty();
+    ResetVictoryProgress();
     FactionMetrics.Empty();
     
     UE_LOG(LogTemp, Log, TEXT("Economic Victory Session Started"));
@@ -541,12 +580,26 @@ void UTGEconomicVictorySubsystem::InitializeDefaultVictoryConditions()
     RegisterVictoryCondition(TradeNetwork);
 }
 
+void UTGEconomicVictorySubsystem::ResetVictoryProgress()
+{
+    VictoryProgress.Reset(NumTrackedFactions * NumVictoryTypes);
+    for (int32 FactionID = 0; FactionID < NumTrackedFactions; FactionID++)
+    {
+        for (int32 TypeIndex = 0; TypeIndex < NumVictoryTypes; TypeIndex++)
+        {
+            FEconomicVictoryProgress& Progress = VictoryProgress.AddDefaulted_GetRef();
+            Progress.FactionID = FactionID;
+            Progress.VictoryType = (EEconomicVictoryType)TypeIndex;
+        }
+    }
+    VictoryProgressTracked.Init(false, VictoryProgress.Num());
+}
+
 void UTGEconomicVictorySubsystem::UpdateVictoryProgress(float DeltaTime)
 {
     // Update time-based progress tracking
-    for (auto& ProgressPair : VictoryProgress)
+    for (FEconomicVictoryProgress& Progress : VictoryProgress)
     {
-        FEconomicVictoryProgress& Progress = ProgressPair.Value;
         
         if (Progress.Status == EEconomicVictoryStatus::NearComplete)
         {
@@ -566,9 +619,15 @@ void UTGEconomicVictorySubsystem::CheckForEconomicCamping(int32 FactionID)
 float UTGEconomicVictorySubsystem::CalculateNetworkConnectivity(int32 FactionID) const
 {
     // Calculate how well connected the faction's trade routes are
-    // For now, return a placeholder value based on route control
-    float RouteControl = GetRouteControlPercentage(FactionID);
-    return FMath::Sqrt(RouteControl); // Non-linear scaling
+    float RouteControl = GetRouteShare(FactionID);
+    float Connectivity = FMath::Sqrt(RouteControl); // Non-linear scaling
+    
+    // Scaled by how much of the faction's supply still gets through disruptions and blockades
+    if (const UTGEconomicWarfareSubsystem* EconomicWarfare = GetWorld()->GetSubsystem<UTGEconomicWarfareSubsystem>())
+    {
+        Connectivity *= EconomicWarfare->GetSupplyNetworkEfficiency(FactionID);
+    }
+    return Connectivity;
 }
 
 float UTGEconomicVictorySubsystem::CalculateEconomicOutput(int32 FactionID) const
@@ -579,13 +638,7 @@ float UTGEconomicVictorySubsystem::CalculateEconomicOutput(int32 FactionID) cons
         return 0.0f;
     }
     
-    TArray<FConvoyRoute> FactionRoutes = ConvoyEconomySubsystem->GetRoutesByFaction(FactionID);
-    float TotalOutput = 0.0f;
-    
-    for (const FConvoyRoute& Route : FactionRoutes)
-    {
-        TotalOutput += Route.BaseIntegrityImpact * Route.DifficultyMultiplier;
-    }
+    const float TotalOutput = (FactionID >= 0 && FactionID < NumTrackedFactions) ? RouteTotals.FactionValue[FactionID] : 0.0f;
     
     // Factor in convoy system integrity
     float IntegrityIndex = ConvoyEconomySubsystem->GetIntegrityIndex();
@@ -613,27 +666,26 @@ bool UTGEconomicVictorySubsystem::ValidateVictoryCondition(const FEconomicVictor
     return true;
 }
 
-FString UTGEconomicVictorySubsystem::GenerateProgressKey(int32 FactionID, EEconomicVictoryType VictoryType) const
+int32 UTGEconomicVictorySubsystem::GetProgressIndex(int32 FactionID, EEconomicVictoryType VictoryType) const
 {
-    return FString::Printf(TEXT("%d_%d"), FactionID, (int32)VictoryType);
+    if (FactionID < 0 || FactionID >= NumTrackedFactions)
+    {
+        return INDEX_NONE;
+    }
+    
+    return FactionID * NumVictoryTypes + (int32)VictoryType;
 }
 
 // Victory-specific calculation methods
 
 float UTGEconomicVictorySubsystem::CalculateEconomicDominance(int32 FactionID) const
 {
-    const FEconomicMetrics* Metrics = FactionMetrics.Find(FactionID);
-    if (!Metrics)
-    {
-        return 0.0f;
-    }
-    
-    return Metrics->RouteControlPercentage;
+    return GetRouteValueShare(FactionID);
 }
 
 float UTGEconomicVictorySubsystem::CalculateSupplyMonopoly(int32 FactionID, EResourceType ResourceType) const
 {
-    return GetRouteControlPercentage(FactionID, ResourceType);
+    return GetRouteShare(FactionID);
 }
 
 float UTGEconomicVictorySubsystem::CalculateEconomicCollapse(int32 FactionID, const TArray<int32>& TargetFactions) const
@@ -651,7 +703,7 @@ float UTGEconomicVictorySubsystem::CalculateEconomicCollapse(int32 FactionID, co
         float CurrentOutput = BaseOutput; // This would need historical tracking
         
         // For now, assume reduction based on route control disruption
-        float DisruptionLevel = 1.0f - GetRouteControlPercentage(TargetFaction);
+        float DisruptionLevel = 1.0f - GetRouteShare(TargetFaction);
         TotalReduction += DisruptionLevel;
     }
     
@@ -665,20 +717,14 @@ float UTGEconomicVictorySubsystem::CalculateTradeNetwork(int32 FactionID) const
 
 float UTGEconomicVictorySubsystem::CalculateResourceControl(int32 FactionID, EResourceType ResourceType) const
 {
-    return GetRouteControlPercentage(FactionID, ResourceType);
+    return GetRouteShare(FactionID);
 }
 
 float UTGEconomicVictorySubsystem::CalculateConvoySupremacy(int32 FactionID) const
 {
-    const FEconomicMetrics* Metrics = FactionMetrics.Find(FactionID);
-    if (!Metrics)
-    {
-        return 0.0f;
-    }
-    
     // Consider both route control and network efficiency
-    float RouteControl = Metrics->RouteControlPercentage;
-    float NetworkEfficiency = Metrics->NetworkConnectivity;
+    float RouteControl = GetRouteValueShare(FactionID);
+    float NetworkEfficiency = CalculateNetworkConnectivity(FactionID);
     
     return (RouteControl * 0.7f) + (NetworkEfficiency * 0.3f);
 }
\ No newline at end of file
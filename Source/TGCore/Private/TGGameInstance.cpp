@@ -22,6 +22,11 @@ void UTGGameInstance::Shutdown()
     Super::Shutdown();
 }
 
+int32 UTGGameInstance::GetProfileFactionID() const
+{
+    return Profile ? Profile->FactionID : 0;
+}
+
 void UTGGameInstance::LoadProfile()
 {
     if (USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(SLOT_NAME, SLOT_INDEX))
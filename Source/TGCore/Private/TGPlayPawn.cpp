@@ -9,11 +9,26 @@
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 #include "TGCombat/Public/TGWeapon.h"
+#include "TGCombat/Public/TGWeaponInstance.h"
+#include "TGCombat/Public/TGExosuitComponent.h"
 #include "TGPlaytestGameMode.h"
+#include "TGGameInstance.h"
 #include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
+
+namespace
+{
+	// Camera boom lengths for hip fire and aim-down-sights
+	constexpr float HipCameraArmLength = 400.0f;
+	constexpr float AimCameraArmLength = 200.0f;
+}
 
 ATGPlayPawn::ATGPlayPawn()
 {
+	// Ticks only while the camera eases between hip and aim over the weapon's ADS time
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
 	// Set size for collision capsule
 	GetCapsuleComponent()->SetCapsuleSize(42.f, 96.0f);
 
@@ -34,7 +49,7 @@ ATGPlayPawn::ATGPlayPawn()
 	// Create a camera boom (pulls in towards the player if there is a collision)
 	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
 	CameraBoom->SetupAttachment(RootComponent);
-	CameraBoom->TargetArmLength = 400.0f; // The camera follows at this distance behind the character	
+	CameraBoom->TargetArmLength = HipCameraArmLength; // The camera follows at this distance behind the character	
 	CameraBoom->bUsePawnControlRotation = true; // Rotate the arm based on the controller
 
 	// Create a follow camera
@@ -59,6 +74,90 @@ void ATGPlayPawn::BeginPlay()
 	// Initialize health and ammo to max values
 	Health = MaxHealth;
 	Ammo = MaxAmmo;
+
+	// Follow exosuit stat changes instead of querying them per frame
+	if (UTGExosuitComponent* Exosuit = FindComponentByClass<UTGExosuitComponent>())
+	{
+		Exosuit->OnExosuitStatsChanged.AddDynamic(this, &ATGPlayPawn::OnExosuitStatsChanged);
+		OnExosuitStatsChanged(Exosuit->GetEffectiveStats());
+	}
+
+	// A weapon placed on the pawn in the editor still goes through the equip path
+	if (EquippedWeapon)
+	{
+		EquipWeapon(EquippedWeapon);
+	}
+}
+
+void ATGPlayPawn::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+
+	// A local player fights for the faction their profile enlisted with, unless one was assigned
+	if (GetFactionID() == 0 && NewController && NewController->IsLocalPlayerController())
+	{
+		if (const UTGGameInstance* GameInstance = GetGameInstance<UTGGameInstance>())
+		{
+			SetFactionID(GameInstance->GetProfileFactionID());
+		}
+	}
+}
+
+void ATGPlayPawn::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(ATGPlayPawn, EquippedWeapon);
+}
+
+void ATGPlayPawn::EquipWeapon(ATGWeapon* NewWeapon, UTGWeaponInstance* WeaponData)
+{
+	ATGWeapon* PreviousWeapon = EquippedWeapon;
+	EquippedWeapon = NewWeapon;
+
+	if (NewWeapon)
+	{
+		NewWeapon->SetOwner(this);
+		NewWeapon->AttachToActor(this, FAttachmentTransformRules::KeepWorldTransform);
+
+		// Attachments are server state; clients receive the compiled block through the weapon
+		if (HasAuthority())
+		{
+			if (!WeaponData)
+			{
+				WeaponData = NewWeapon->GetWeaponData();
+			}
+			if (!WeaponData)
+			{
+				WeaponData = NewObject<UTGWeaponInstance>(NewWeapon);
+			}
+			NewWeapon->SetWeaponData(WeaponData);
+		}
+	}
+
+	BindEquippedWeapon(PreviousWeapon);
+}
+
+void ATGPlayPawn::OnRep_EquippedWeapon(ATGWeapon* PreviousWeapon)
+{
+	BindEquippedWeapon(PreviousWeapon);
+}
+
+void ATGPlayPawn::BindEquippedWeapon(ATGWeapon* PreviousWeapon)
+{
+	if (PreviousWeapon && PreviousWeapon != EquippedWeapon)
+	{
+		PreviousWeapon->OnLoadoutChanged.RemoveDynamic(this, &ATGPlayPawn::OnWeaponLoadoutChanged);
+	}
+
+	if (EquippedWeapon)
+	{
+		EquippedWeapon->OnLoadoutChanged.AddUniqueDynamic(this, &ATGPlayPawn::OnWeaponLoadoutChanged);
+		OnWeaponLoadoutChanged(EquippedWeapon->GetLoadoutStats());
+	}
+	else
+	{
+		OnWeaponLoadoutChanged(FTGWeaponStatBlock());
+	}
 }
 
 void ATGPlayPawn::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -155,13 +254,33 @@ void ATGPlayPawn::Look(const FInputActionValue& Value)
 void ATGPlayPawn::StartSprint()
 {
 	bIsSprinting = true;
-	GetCharacterMovement()->MaxWalkSpeed = SprintSpeed;
+	ApplyMovementSpeed();
 }
 
 void ATGPlayPawn::StopSprint()
 {
 	bIsSprinting = false;
-	GetCharacterMovement()->MaxWalkSpeed = WalkSpeed;
+	ApplyMovementSpeed();
+}
+
+void ATGPlayPawn::OnExosuitStatsChanged(const FExosuitStats& NewStats)
+{
+	ExosuitSpeedMultiplier = NewStats.MovementSpeedMultiplier;
+	ExosuitSprintMultiplier = NewStats.SprintSpeedMultiplier;
+	ApplyMovementSpeed();
+}
+
+void ATGPlayPawn::OnWeaponLoadoutChanged(const FTGWeaponStatBlock& NewStats)
+{
+	WeaponSpeedMultiplier = NewStats.MoveSpeedMultiplier;
+	ApplyMovementSpeed();
+}
+
+void ATGPlayPawn::ApplyMovementSpeed()
+{
+	GetCharacterMovement()->MaxWalkSpeed = WeaponSpeedMultiplier * (bIsSprinting
+		? SprintSpeed * ExosuitSprintMultiplier
+		: WalkSpeed * ExosuitSpeedMultiplier);
 }
 
 void ATGPlayPawn::StartFire()
@@ -183,20 +302,33 @@ void ATGPlayPawn::StopFire()
 void ATGPlayPawn::StartAim()
 {
 	bIsAiming = true;
-	// Adjust camera for aiming
-	if (CameraBoom)
-	{
-		CameraBoom->TargetArmLength = 200.0f;
-	}
+	SetActorTickEnabled(true);
 }
 
 void ATGPlayPawn::StopAim()
 {
 	bIsAiming = false;
-	// Return camera to normal
+	SetActorTickEnabled(true);
+}
+
+void ATGPlayPawn::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// The aim camera moves over the loadout's ADS time; cosmetic only, the server never reads it
+	const float TargetLength = bIsAiming ? AimCameraArmLength : HipCameraArmLength;
 	if (CameraBoom)
 	{
-		CameraBoom->TargetArmLength = 400.0f;
+		const float ADSTime = EquippedWeapon ? EquippedWeapon->GetADSTimeSeconds() : 0.0f;
+		CameraBoom->TargetArmLength = ADSTime > 0.0f
+			? FMath::FInterpConstantTo(CameraBoom->TargetArmLength, TargetLength, DeltaTime, (HipCameraArmLength - AimCameraArmLength) / ADSTime)
+			: TargetLength;
+	}
+
+	// Transition finished; stay idle until the next aim change
+	if (!CameraBoom || FMath::IsNearlyEqual(CameraBoom->TargetArmLength, TargetLength))
+	{
+		SetActorTickEnabled(false);
 	}
 }
 
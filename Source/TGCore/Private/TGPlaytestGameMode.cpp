@@ -2,6 +2,7 @@
 #include "TGPlayPawn.h"
 #include "TGCombat/Public/TGDemoSetup.h"
 #include "TGAI/Public/TGEnemyGrunt.h"
+#include "TGAI/Public/TGCrowdSubsystem.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
@@ -121,6 +122,12 @@ void ATGPlaytestGameMode::SetupEnemyTracking()
             RegisterEnemy(Enemy);
         }
     }
+
+    // Crowd agents count as remaining enemies and become tracked grunts once promoted
+    if (UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>())
+    {
+        Crowd->OnGruntPromoted.AddUniqueDynamic(this, &ATGPlaytestGameMode::RegisterEnemy);
+    }
     
     UpdateEnemyCount();
     
@@ -220,6 +227,10 @@ void ATGPlaytestGameMode::UpdateEnemyCount()
     });
     
     RemainingEnemies = TrackedEnemies.Num();
+    if (const UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>())
+    {
+        RemainingEnemies += Crowd->GetCrowdAgentCount();
+    }
     
     // Set total on first count
     if (TotalEnemies == 0)
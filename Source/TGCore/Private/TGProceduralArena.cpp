@@ -2,6 +2,7 @@
 #include "TGCaptureNode.h"
 #include "TGExtractionPad.h"
 #include "TGAI/Public/TGEnemyGrunt.h"
+#include "TGAI/Public/TGCrowdSubsystem.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "NavigationSystem.h"
@@ -82,7 +83,7 @@ void ATGProceduralArena::ClearArena()
 	}
 	SpawnedCaptureNodes.Empty();
 
-	// Destroy enemies
+	// Destroy enemies; clearing the crowd also destroys grunts promoted from it
 	for (ATGEnemyGrunt* Enemy : SpawnedEnemies)
 	{
 		if (IsValid(Enemy))
@@ -91,6 +92,10 @@ void ATGProceduralArena::ClearArena()
 		}
 	}
 	SpawnedEnemies.Empty();
+	if (UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>())
+	{
+		Crowd->ClearCrowd(this);
+	}
 
 	// Destroy extraction pad
 	if (IsValid(SpawnedExtractionPad))
@@ -252,16 +257,52 @@ void ATGProceduralArena::SpawnEnemies()
 {
 	UE_LOG(LogTemp, Log, TEXT("Spawning %d enemies"), EnemyCount);
 
+	// Enemies far from every player start out as crowd agents and are tracked once promoted
+	UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>();
+	if (Crowd)
+	{
+		Crowd->OnGruntPromoted.AddUniqueDynamic(this, &ATGProceduralArena::HandleGruntPromoted);
+	}
+
 	for (int32 i = 0; i < EnemyCount; i++)
 	{
 		FVector SpawnLocation = GetRandomPositionInRadius(ArenaRadius * 0.9f);
 		
-		if (ATGEnemyGrunt* Enemy = GetWorld()->SpawnActor<ATGEnemyGrunt>(ATGEnemyGrunt::StaticClass(), SpawnLocation, FRotator::ZeroRotator))
+		ATGEnemyGrunt* Enemy = Crowd
+			? Crowd->SpawnEnemy(SpawnLocation, FRotator::ZeroRotator, ATGEnemyGrunt::StaticClass(), this)
+			: GetWorld()->SpawnActor<ATGEnemyGrunt>(ATGEnemyGrunt::StaticClass(), SpawnLocation, FRotator::ZeroRotator);
+		if (Enemy)
 		{
 			SpawnedEnemies.Add(Enemy);
 			UE_LOG(LogTemp, Log, TEXT("Spawned enemy %d at %s"), i, *SpawnLocation.ToString());
 		}
+		else if (Crowd)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Added crowd enemy %d at %s"), i, *SpawnLocation.ToString());
+		}
+	}
+}
+
+void ATGProceduralArena::HandleGruntPromoted(ATGEnemyGrunt* Grunt)
+{
+	SpawnedEnemies.AddUnique(Grunt);
+}
+
+int32 ATGProceduralArena::GetEnemyCount() const
+{
+	int32 Count = 0;
+	for (const ATGEnemyGrunt* Enemy : SpawnedEnemies)
+	{
+		if (IsValid(Enemy) && !Enemy->IsDead())
+		{
+			Count++;
+		}
+	}
+	if (const UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>())
+	{
+		Count += Crowd->GetCrowdAgentCount();
 	}
+	return Count;
 }
 
 void ATGProceduralArena::PlacePlayerStart()
@@ -3,12 +3,28 @@
 #include "GameFramework/Character.h"
 #include "TGCharacter.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FTGOnCharacterFactionChanged, ATGCharacter*, Character);
+
 UCLASS()
 class TGCORE_API ATGCharacter : public ACharacter
 {
 	GENERATED_BODY()
 public:
 	ATGCharacter();
+
+	// Faction this character fights for (EFactionID value), 0 for none
+	UFUNCTION(BlueprintPure, Category = "Faction")
+	int32 GetFactionID() const { return FactionID; }
+
+	UFUNCTION(BlueprintCallable, Category = "Faction")
+	void SetFactionID(int32 NewFactionID);
+
+	UPROPERTY(BlueprintAssignable, Category = "Faction")
+	FTGOnCharacterFactionChanged OnFactionChanged;
+
 protected:
 	virtual void BeginPlay() override;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Faction")
+	int32 FactionID = 0;
 };
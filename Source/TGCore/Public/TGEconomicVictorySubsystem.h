@@ -225,6 +225,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Economic Victory")
     void EvaluateVictoryConditions();
 
+    // Evaluated against the live route set; route totals are rebuilt on read when convoy routes changed
     UFUNCTION(BlueprintPure, Category = "Economic Victory")
     bool CheckVictoryCondition(int32 FactionID, const FEconomicVictoryCondition& Condition) const;
 
@@ -283,12 +284,17 @@ protected:
     virtual TStatId GetStatID() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGEconomicVictorySubsystem, STATGROUP_Tickables); }
 
 private:
+    static constexpr int32 NumTrackedFactions = 7; // Faction IDs 0-6
+    static constexpr int32 NumVictoryTypes = (int32)EEconomicVictoryType::ConvoySupremacy + 1;
+
     // Core state
     UPROPERTY()
     TArray<FEconomicVictoryCondition> VictoryConditions;
 
     UPROPERTY()
-    TMap<FString, FEconomicVictoryProgress> VictoryProgress; // Key: FactionID_VictoryType
+    TArray<FEconomicVictoryProgress> VictoryProgress; // [FactionID * NumVictoryTypes + VictoryType]
+
+    TBitArray<> VictoryProgressTracked; // Set once a slot has been evaluated
 
     UPROPERTY()
     TMap<int32, FEconomicMetrics> FactionMetrics;
@@ -299,18 +305,36 @@ private:
     UPROPERTY()
     class UTerritorialManager* TerritorialManager;
 
+    // Per-faction route aggregates from one pass over the convoy routes
+    struct FRouteTotals
+    {
+        int32 TotalRoutes = 0;
+        float TotalValue = 0.0f;
+        int32 FactionRoutes[NumTrackedFactions] = {};
+        float FactionValue[NumTrackedFactions] = {};
+    };
+    // Cache of convoy state, so const readers may rebuild it
+    mutable FRouteTotals RouteTotals;
+    mutable uint32 RouteTotalsVersion = 0; // Convoy route set version RouteTotals was built from
+    mutable bool bRouteTotalsValid = false;
+
     // Timing
     float LastVictoryCheck = 0.0f;
     float SessionStartTime = 0.0f;
 
     // Internal systems
     void InitializeDefaultVictoryConditions();
+    void ResetVictoryProgress();
+    void RefreshRouteTotals() const; // Rescans routes only when the convoy route set changed
+    void BuildEconomicMetrics(int32 FactionID);
     void UpdateVictoryProgress(float DeltaTime);
     void CheckForEconomicCamping(int32 FactionID);
     float CalculateNetworkConnectivity(int32 FactionID) const;
     float CalculateEconomicOutput(int32 FactionID) const;
     bool ValidateVictoryCondition(const FEconomicVictoryCondition& Condition) const;
-    FString GenerateProgressKey(int32 FactionID, EEconomicVictoryType VictoryType) const;
+    int32 GetProgressIndex(int32 FactionID, EEconomicVictoryType VictoryType) const; // INDEX_NONE if untracked
+    float GetRouteShare(int32 FactionID) const; // From RouteTotals
+    float GetRouteValueShare(int32 FactionID) const; // From RouteTotals
 
     // Victory type specific calculations
     float CalculateEconomicDominance(int32 FactionID) const;
@@ -16,6 +16,9 @@ public:
     virtual void Init() override;
     virtual void Shutdown() override;
 
+    // Faction the local player's profile has enlisted with, 0 if none
+    int32 GetProfileFactionID() const;
+
 private:
     UPROPERTY()
     UTGProfileSave* Profile = nullptr;
@@ -9,9 +9,11 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "TGCombat/Public/TGExosuitData.h"
+#include "TGCombat/Public/TGWeapon.h"
 #include "TGPlayPawn.generated.h"
 
-class ATGWeapon;
+class UTGWeaponInstance;
 class UInputAction;
 class UInputMappingContext;
 
@@ -23,8 +25,11 @@ class TGCORE_API ATGPlayPawn : public ATGCharacter
 public:
 	ATGPlayPawn();
 
+	virtual void Tick(float DeltaTime) override;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void PossessedBy(AController* NewController) override;
 	virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
 
 	// Camera Components
@@ -79,8 +84,8 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
 	float MaxAmmo = 30.0f;
 
-	// Weapon Instance
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	// Weapon Instance; change it through EquipWeapon so the loadout is compiled and followed
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_EquippedWeapon, Category = "Combat")
 	TObjectPtr<ATGWeapon> EquippedWeapon;
 
 	// Input Functions
@@ -94,6 +99,24 @@ protected:
 	void StopAim();
 	void RestartMission();
 
+	// Exosuit stat block, cached when the exosuit component reports a change
+	UFUNCTION()
+	void OnExosuitStatsChanged(const FExosuitStats& NewStats);
+
+	// Attachment weight on the equipped weapon slows the carrier
+	UFUNCTION()
+	void OnWeaponLoadoutChanged(const FTGWeaponStatBlock& NewStats);
+
+	UFUNCTION()
+	void OnRep_EquippedWeapon(ATGWeapon* PreviousWeapon);
+
+	// Moves the loadout binding from the previous weapon to EquippedWeapon
+	void BindEquippedWeapon(ATGWeapon* PreviousWeapon);
+
+	void ApplyMovementSpeed();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 	// Combat Functions
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void TakeDamage(float DamageAmount);
@@ -111,10 +134,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void Heal(float HealAmount);
 
+	// Attaches a weapon and, on the server, compiles its loadout from WeaponData (or the weapon's own)
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void EquipWeapon(ATGWeapon* NewWeapon, UTGWeaponInstance* WeaponData = nullptr);
+
 private:
 	bool bIsSprinting = false;
 	bool bIsAiming = false;
 
+	float ExosuitSpeedMultiplier = 1.0f;
+	float ExosuitSprintMultiplier = 1.0f;
+	float WeaponSpeedMultiplier = 1.0f;
+
 public:
 	// Getters
 	UFUNCTION(BlueprintPure, Category = "Combat")
@@ -135,6 +166,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Combat")
 	bool GetIsAiming() const { return bIsAiming; }
 
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	ATGWeapon* GetEquippedWeapon() const { return EquippedWeapon; }
+
 	FORCEINLINE class USpringArmComponent* GetCameraBoom() const { return CameraBoom; }
 	FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
 };
\ No newline at end of file
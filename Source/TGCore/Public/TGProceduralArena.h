@@ -164,6 +164,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Generation")
 	int32 GetSpawnedPieceCount() const { return SpawnedPieces.Num(); }
 
+	// Live enemies: spawned and promoted grunts plus enemies still in the crowd
+	UFUNCTION(BlueprintPure, Category = "Generation")
+	int32 GetEnemyCount() const;
+
 	// Blueprint Events
 	UFUNCTION(BlueprintImplementableEvent, Category = "Generation")
 	void OnArenaGenerated();
@@ -180,6 +184,9 @@ private:
 	void PlaceExtractionPad();
 	void SpawnEnemies();
 	void PlacePlayerStart();
+
+	UFUNCTION()
+	void HandleGruntPromoted(ATGEnemyGrunt* Grunt);
 	
 	FVector GetRandomPositionInRadius(float Radius) const;
 	bool IsPositionValid(const FVector& Position, float MinDistance = 1000.0f) const;
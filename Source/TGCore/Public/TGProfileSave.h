@@ -179,6 +179,9 @@ public:
 	UPROPERTY()
 	TArray<FName> CompletedTerritorialObjectives; // Completed objective IDs for persistence
 	
+	UPROPERTY()
+	int32 FactionID = 0; // Faction the player has enlisted with, 0 until chosen
+	
 	UTGProfileSave()
 	{
 		ConvoyIntegrityIndex = 0.5f;
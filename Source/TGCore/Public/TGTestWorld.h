@@ -0,0 +1,43 @@
+#pragma once
+
+#if WITH_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+/**
+ * Game world for automation tests. Registered with the engine for the lifetime of the scope so
+ * world subsystems are created, then destroyed with its world context on every return path.
+ */
+class FTGScopedTestWorld : public FNoncopyable
+{
+public:
+    explicit FTGScopedTestWorld(const TCHAR* Name)
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false, Name);
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+    }
+
+    ~FTGScopedTestWorld()
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    /** Starts play, for tests that spawn actors or rely on begin play hooks */
+    void BeginPlay()
+    {
+        World->InitializeActorsForPlay(FURL());
+        World->BeginPlay();
+    }
+
+    UWorld* Get() const { return World; }
+    UWorld* operator->() const { return World; }
+
+private:
+    UWorld* World = nullptr;
+};
+
+#endif // WITH_AUTOMATION_TESTS
@@ -6,6 +6,7 @@
 #include "Trust/TGTrustSubsystem.h"
 #include "Economy/TGConvoyEconomySubsystem.h"
 #include "TGTerritorialManager.h"
+#include "Algo/BinarySearch.h"
 
 void UTGSpliceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -40,21 +41,271 @@ void UTGSpliceSubsystem::RegisterDeck(UTGSpliceEventDeck* Deck)
     if (Deck)
     {
         Decks.AddUnique(Deck);
+        RebuildSpliceIndex();
     }
 }
 
 void UTGSpliceSubsystem::ClearDecks()
 {
     Decks.Reset();
+    RebuildSpliceIndex();
 }
 
-bool UTGSpliceSubsystem::IsCardEligible(const FTGSpliceEventCard& Card, const TMap<FName, FString>& Context) const
+static const TCHAR* const GSpliceFixedContextKeys[] =
 {
-    // All constraints must match provided context (exact string compare)
-    for (const auto& Kvp : Card.Constraints)
+    TEXT("TerritoryId"),
+    TEXT("TerritoryName"),
+    TEXT("TerritoryType"),
+    TEXT("PreviousControllerFactionId"),
+    TEXT("PreviousControllerFactionName"),
+    TEXT("NewControllerFactionId"),
+    TEXT("NewControllerFactionName"),
+    TEXT("StrategicValue"),
+    TEXT("ResourceMultiplier"),
+    TEXT("WasContested"),
+    TEXT("IsContested"),
+    TEXT("ConnectedTerritoryIds"),
+    TEXT("ConnectedTerritoryNames"),
+};
+static_assert(UE_ARRAY_COUNT(GSpliceFixedContextKeys) == static_cast<int32>(ETGSpliceContextSlot::Count), "Fixed splice context keys out of sync with ETGSpliceContextSlot");
+
+void UTGSpliceSubsystem::RebuildSpliceIndex()
+{
+    // Unloaded decks drop out here rather than being skipped on every trigger
+    Decks.RemoveAll([](const TWeakObjectPtr<UTGSpliceEventDeck>& DeckPtr) { return !DeckPtr.IsValid(); });
+
+    CardEntries.Reset();
+    OutcomeCumulativeWeights.Reset();
+    ConstraintPool.Reset();
+    TriggerBuckets.Reset();
+
+    KeySlots.Reset();
+    ValueSymbols.Reset();
+    IntValueSymbols.Reset();
+    FloatValueSymbols.Reset();
+    ReferencedSlotMask = 0;
+    for (const TCHAR* FixedKey : GSpliceFixedContextKeys)
     {
-        const FString* Found = Context.Find(Kvp.Key);
-        if (!Found || *Found != Kvp.Value)
+        InternKey(FixedKey);
+    }
+    TrueSymbol = InternValue(TEXT("true"));
+    FalseSymbol = InternValue(TEXT("false"));
+
+    TArray<ETGSpliceTrigger, TInlineAllocator<8>> CardTriggers;
+    for (int32 DeckIndex = 0; DeckIndex < Decks.Num(); ++DeckIndex)
+    {
+        const UTGSpliceEventDeck* Deck = Decks[DeckIndex].Get();
+        for (int32 CardIndex = 0; CardIndex < Deck->Cards.Num(); ++CardIndex)
+        {
+            const FTGSpliceEventCard& Card = Deck->Cards[CardIndex];
+
+            const int32 EntryIndex = CardEntries.AddDefaulted();
+            FSpliceCardEntry& Entry = CardEntries[EntryIndex];
+            Entry.DeckIndex = DeckIndex;
+            Entry.CardIndex = CardIndex;
+            Entry.Weight = FMath::Max(1, Card.Weight);
+            Entry.OutcomeStart = OutcomeCumulativeWeights.Num();
+            Entry.OutcomeCount = Card.Outcomes.Num();
+
+            int64 OutcomeTotal = 0;
+            for (const FTGSpliceOutcome& Outcome : Card.Outcomes)
+            {
+                OutcomeTotal += FMath::Max(1, Outcome.Weight);
+                OutcomeCumulativeWeights.Add(OutcomeTotal);
+            }
+
+            Entry.ConstraintStart = ConstraintPool.Num();
+            bool bConstraintsCompiled = true;
+            for (const TPair<FName, FString>& Constraint : Card.Constraints)
+            {
+                const int32 Slot = InternKey(Constraint.Key);
+                if (Slot == INDEX_NONE)
+                {
+                    bConstraintsCompiled = false;
+                    break;
+                }
+                ConstraintPool.Add({Slot, InternValue(Constraint.Value)});
+                Entry.RequiredMask |= uint64(1) << Slot;
+            }
+            Entry.ConstraintCount = ConstraintPool.Num() - Entry.ConstraintStart;
+
+            if (!bConstraintsCompiled)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("UTGSpliceSubsystem: Card %s exceeds %d distinct constraint keys and will never trigger"),
+                       *Card.Id, FTGSpliceSymbolContext::MaxSlots);
+                continue;
+            }
+            ReferencedSlotMask |= Entry.RequiredMask;
+
+            // A trigger listed twice on one card still counts once
+            CardTriggers.Reset();
+            for (const ETGSpliceTrigger Trigger : Card.Triggers)
+            {
+                CardTriggers.AddUnique(Trigger);
+            }
+
+            for (const ETGSpliceTrigger Trigger : CardTriggers)
+            {
+                const int32 BucketIndex = static_cast<int32>(Trigger);
+                if (!TriggerBuckets.IsValidIndex(BucketIndex))
+                {
+                    TriggerBuckets.SetNum(BucketIndex + 1);
+                }
+
+                FSpliceTriggerBucket& Bucket = TriggerBuckets[BucketIndex];
+                if (Card.Constraints.Num() > 0)
+                {
+                    Bucket.Constrained.Add(EntryIndex);
+                }
+                else
+                {
+                    const int64 Previous = Bucket.UnconstrainedCumulative.Num() > 0 ? Bucket.UnconstrainedCumulative.Last() : 0;
+                    Bucket.Unconstrained.Add(EntryIndex);
+                    Bucket.UnconstrainedCumulative.Add(Previous + Entry.Weight);
+                }
+            }
+        }
+    }
+}
+
+const FTGSpliceEventCard* UTGSpliceSubsystem::ResolveCard(const FSpliceCardEntry& Entry) const
+{
+    const UTGSpliceEventDeck* Deck = Decks.IsValidIndex(Entry.DeckIndex) ? Decks[Entry.DeckIndex].Get() : nullptr;
+    return Deck && Deck->Cards.IsValidIndex(Entry.CardIndex) ? &Deck->Cards[Entry.CardIndex] : nullptr;
+}
+
+void UTGSpliceSubsystem::RefreshStaleDecks()
+{
+    // Must run before a context is resolved, since rebuilding renumbers the symbols
+    for (const TWeakObjectPtr<UTGSpliceEventDeck>& DeckPtr : Decks)
+    {
+        if (!DeckPtr.IsValid())
+        {
+            RebuildSpliceIndex();
+            return;
+        }
+    }
+}
+
+int32 UTGSpliceSubsystem::InternKey(FName Key)
+{
+    if (const int32* Existing = KeySlots.Find(Key))
+    {
+        return *Existing;
+    }
+    if (KeySlots.Num() >= FTGSpliceSymbolContext::MaxSlots)
+    {
+        return INDEX_NONE;
+    }
+    return KeySlots.Add(Key, KeySlots.Num());
+}
+
+int32 UTGSpliceSubsystem::InternValue(const FString& Value)
+{
+    if (const int32* Existing = ValueSymbols.Find(Value))
+    {
+        return *Existing;
+    }
+
+    const int32 Symbol = ValueSymbols.Add(Value, ValueSymbols.Num());
+
+    // Register the numeric reading too when it formats back to the same text as the context would produce
+    if (Value.IsNumeric())
+    {
+        const int32 AsInt = FCString::Atoi(*Value);
+        if (FString::FromInt(AsInt) == Value)
+        {
+            IntValueSymbols.Add(AsInt, Symbol);
+        }
+        const float AsFloat = FCString::Atof(*Value);
+        if (FString::SanitizeFloat(AsFloat) == Value)
+        {
+            FloatValueSymbols.Add(AsFloat, Symbol);
+        }
+    }
+    return Symbol;
+}
+
+int32 UTGSpliceSubsystem::FindValueSymbol(const FString& Value) const
+{
+    const int32* Symbol = ValueSymbols.Find(Value);
+    return Symbol ? *Symbol : INDEX_NONE;
+}
+
+void UTGSpliceSubsystem::BuildSymbolContext(const TMap<FName, FString>& Context, FTGSpliceSymbolContext& OutContext) const
+{
+    for (const TPair<FName, FString>& Kvp : Context)
+    {
+        // Keys no constraint mentions have no slot and can be ignored
+        if (const int32* Slot = KeySlots.Find(Kvp.Key))
+        {
+            OutContext.Set(*Slot, FindValueSymbol(Kvp.Value));
+        }
+    }
+}
+
+void UTGSpliceSubsystem::BuildSymbolContext(const FTGTerritorialEventContext& TerritorialContext, FTGSpliceSymbolContext& OutContext) const
+{
+    // Same keys and values as ToContextMap, but numbers and flags map straight to symbols and
+    // string fields are only looked up when some constraint actually reads them
+    auto IsReferenced = [this](ETGSpliceContextSlot Slot)
+    {
+        return (ReferencedSlotMask & (uint64(1) << static_cast<int32>(Slot))) != 0;
+    };
+    auto SetInt = [&](ETGSpliceContextSlot Slot, int32 Value)
+    {
+        const int32* Symbol = IntValueSymbols.Find(Value);
+        OutContext.Set(static_cast<int32>(Slot), Symbol ? *Symbol : INDEX_NONE);
+    };
+    auto SetFlag = [&](ETGSpliceContextSlot Slot, bool bValue)
+    {
+        OutContext.Set(static_cast<int32>(Slot), bValue ? TrueSymbol : FalseSymbol);
+    };
+    auto SetString = [&](ETGSpliceContextSlot Slot, const FString& Value)
+    {
+        if (IsReferenced(Slot))
+        {
+            OutContext.Set(static_cast<int32>(Slot), FindValueSymbol(Value));
+        }
+    };
+
+    SetInt(ETGSpliceContextSlot::TerritoryId, TerritorialContext.TerritoryId);
+    SetString(ETGSpliceContextSlot::TerritoryName, TerritorialContext.TerritoryName);
+    SetString(ETGSpliceContextSlot::TerritoryType, TerritorialContext.TerritoryType);
+    SetInt(ETGSpliceContextSlot::PreviousControllerFactionId, TerritorialContext.PreviousControllerFactionId);
+    SetString(ETGSpliceContextSlot::PreviousControllerFactionName, TerritorialContext.PreviousControllerFactionName);
+    SetInt(ETGSpliceContextSlot::NewControllerFactionId, TerritorialContext.NewControllerFactionId);
+    SetString(ETGSpliceContextSlot::NewControllerFactionName, TerritorialContext.NewControllerFactionName);
+    SetInt(ETGSpliceContextSlot::StrategicValue, TerritorialContext.StrategicValue);
+    SetFlag(ETGSpliceContextSlot::WasContested, TerritorialContext.bWasContested);
+    SetFlag(ETGSpliceContextSlot::IsContested, TerritorialContext.bIsContested);
+
+    const int32* MultiplierSymbol = FloatValueSymbols.Find(TerritorialContext.ResourceMultiplier);
+    OutContext.Set(static_cast<int32>(ETGSpliceContextSlot::ResourceMultiplier), MultiplierSymbol ? *MultiplierSymbol : INDEX_NONE);
+
+    // Joined lists are rare constraint targets; only pay for them on demand
+    if (IsReferenced(ETGSpliceContextSlot::ConnectedTerritoryIds))
+    {
+        const FString ConnectedIdsList = FString::JoinBy(TerritorialContext.ConnectedTerritoryIds, TEXT(","), [](int32 Id) { return FString::FromInt(Id); });
+        SetString(ETGSpliceContextSlot::ConnectedTerritoryIds, ConnectedIdsList);
+    }
+    if (IsReferenced(ETGSpliceContextSlot::ConnectedTerritoryNames))
+    {
+        SetString(ETGSpliceContextSlot::ConnectedTerritoryNames, FString::Join(TerritorialContext.ConnectedTerritoryNames, TEXT(",")));
+    }
+}
+
+bool UTGSpliceSubsystem::IsEntryEligible(const FSpliceCardEntry& Entry, const FTGSpliceSymbolContext& Context) const
+{
+    // Every constrained key must be present, then each value must be the same symbol
+    if ((Context.PresentMask & Entry.RequiredMask) != Entry.RequiredMask)
+    {
+        return false;
+    }
+    for (int32 Index = Entry.ConstraintStart; Index < Entry.ConstraintStart + Entry.ConstraintCount; ++Index)
+    {
+        const FSpliceConstraint& Constraint = ConstraintPool[Index];
+        if (Context.Values[Constraint.Slot] != Constraint.Symbol)
         {
             return false;
         }
@@ -62,59 +313,82 @@ bool UTGSpliceSubsystem::IsCardEligible(const FTGSpliceEventCard& Card, const TM
     return true;
 }
 
-const FTGSpliceOutcome* UTGSpliceSubsystem::ChooseOutcome(const FTGSpliceEventCard& Card) const
+const FTGSpliceOutcome* UTGSpliceSubsystem::ChooseOutcome(const FSpliceCardEntry& Entry, const FTGSpliceEventCard& Card) const
 {
-    if (Card.Outcomes.Num() == 0)
+    if (Entry.OutcomeCount == 0 || Card.Outcomes.Num() != Entry.OutcomeCount)
     {
         return nullptr;
     }
-    // Simple uniform choice for now
-    const int32 Index = FMath::RandRange(0, Card.Outcomes.Num() - 1);
+
+    // Weighted pick by binary search over the card's precompiled prefix sums
+    const TArrayView<const int64> Cumulative(OutcomeCumulativeWeights.GetData() + Entry.OutcomeStart, Entry.OutcomeCount);
+    const int64 Roll = FMath::RandRange(static_cast<int64>(0), Cumulative.Last() - 1);
+    const int32 Index = Algo::UpperBound(Cumulative, Roll);
     return &Card.Outcomes[Index];
 }
 
 bool UTGSpliceSubsystem::TriggerEligibleEvents(ETGSpliceTrigger Trigger, const TMap<FName, FString>& Context)
 {
-    bool bTriggeredAny = false;
-    // Build weighted list of cards that contain this trigger and pass constraints
-    TArray<const FTGSpliceEventCard*> Eligible;
-    for (const TWeakObjectPtr<UTGSpliceEventDeck>& DeckPtr : Decks)
+    RefreshStaleDecks();
+
+    FTGSpliceSymbolContext SymbolContext;
+    BuildSymbolContext(Context, SymbolContext);
+    return TriggerWithSymbols(Trigger, SymbolContext, Context);
+}
+
+bool UTGSpliceSubsystem::TriggerWithSymbols(ETGSpliceTrigger Trigger, const FTGSpliceSymbolContext& SymbolContext, const TMap<FName, FString>& OutcomeContext)
+{
+    const int32 BucketIndex = static_cast<int32>(Trigger);
+    if (!TriggerBuckets.IsValidIndex(BucketIndex))
+    {
+        return false;
+    }
+    const FSpliceTriggerBucket& Bucket = TriggerBuckets[BucketIndex];
+
+    // Only constrained cards depend on the context; extend the precompiled sums with those that pass
+    const int64 UnconstrainedTotal = Bucket.UnconstrainedCumulative.Num() > 0 ? Bucket.UnconstrainedCumulative.Last() : 0;
+    int64 Total = UnconstrainedTotal;
+    ScratchEligible.Reset();
+    ScratchCumulative.Reset();
+    for (const int32 EntryIndex : Bucket.Constrained)
     {
-        const UTGSpliceEventDeck* Deck = DeckPtr.Get();
-        if (!Deck) continue;
-        for (const FTGSpliceEventCard& Card : Deck->Cards)
+        if (IsEntryEligible(CardEntries[EntryIndex], SymbolContext))
         {
-            if (!Card.Triggers.Contains(Trigger)) continue;
-            if (!IsCardEligible(Card, Context)) continue;
-            const int32 ClampedW = FMath::Max(1, Card.Weight);
-            for (int32 i=0; i<ClampedW; ++i)
-            {
-                Eligible.Add(&Card);
-            }
+            Total += CardEntries[EntryIndex].Weight;
+            ScratchEligible.Add(EntryIndex);
+            ScratchCumulative.Add(Total);
         }
     }
 
-    if (Eligible.Num() == 0)
+    if (Total == 0)
     {
         return false;
     }
 
-    const int32 Pick = FMath::RandRange(0, Eligible.Num() - 1);
-    const FTGSpliceEventCard* Card = Eligible[Pick];
-    if (Card)
+    const int64 Roll = FMath::RandRange(static_cast<int64>(0), Total - 1);
+    const int32 EntryIndex = Roll < UnconstrainedTotal
+        ? Bucket.Unconstrained[Algo::UpperBound(Bucket.UnconstrainedCumulative, Roll)]
+        : ScratchEligible[Algo::UpperBound(ScratchCumulative, Roll)];
+
+    const FSpliceCardEntry& Entry = CardEntries[EntryIndex];
+    const FTGSpliceEventCard* Card = ResolveCard(Entry);
+    if (!Card)
     {
-        const FTGSpliceOutcome* Outcome = ChooseOutcome(*Card);
-        if (Outcome)
-        {
-            // Apply side effects into other systems
-            ApplyOutcome(*Outcome, Context);
+        return false;
+    }
 
-            // Broadcast for UI/audio hooks
-            OnSpliceEventTriggered.Broadcast(*Card, *Outcome);
-            bTriggeredAny = true;
-        }
+    const FTGSpliceOutcome* Outcome = ChooseOutcome(Entry, *Card);
+    if (!Outcome)
+    {
+        return false;
     }
-    return bTriggeredAny;
+
+    // Apply side effects into other systems
+    ApplyOutcome(*Outcome, OutcomeContext);
+
+    // Broadcast for UI/audio hooks
+    OnSpliceEventTriggered.Broadcast(*Card, *Outcome);
+    return true;
 }
 
 static UTGCodexSubsystem* TG_GetCodexSubsystem(const UObject* WorldContext)
@@ -265,11 +539,15 @@ void UTGSpliceSubsystem::InitializeTerritorialIntegration()
 
 bool UTGSpliceSubsystem::TriggerTerritorialEvents(ETGSpliceTrigger Trigger, const FTGTerritorialEventContext& TerritorialContext)
 {
-    // Convert territorial context to standard context map
-    TMap<FName, FString> Context = TerritorialContext.ToContextMap();
-    
-    // Use existing trigger system with enhanced context
-    return TriggerEligibleEvents(Trigger, Context);
+    RefreshStaleDecks();
+
+    // Resolve straight into symbol slots; the string map form is never built on this path
+    FTGSpliceSymbolContext SymbolContext;
+    BuildSymbolContext(TerritorialContext, SymbolContext);
+
+    // Territorial contexts carry none of the route or player keys outcomes read
+    static const TMap<FName, FString> EmptyOutcomeContext;
+    return TriggerWithSymbols(Trigger, SymbolContext, EmptyOutcomeContext);
 }
 
 void UTGSpliceSubsystem::OnTerritorialControlChanged(int32 TerritoryId, int32 OldControllerFactionId, int32 NewControllerFactionId)
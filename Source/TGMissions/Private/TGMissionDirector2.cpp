@@ -1,9 +1,11 @@
 #include "TGMissionDirector2.h"
 #include "SiegeHelpers.h"
-#include "TimerManager.h"
+#include "TGMissionSchedulerSubsystem.h"
+#include "Engine/World.h"
 
 ATGMissionDirector2::ATGMissionDirector2() {
-  PrimaryActorTick.bCanEverTick = true;
+  // Stage limits and event triggers are driven by UTGMissionSchedulerSubsystem
+  PrimaryActorTick.bCanEverTick = false;
   CurrentStageIndex = INDEX_NONE;
   CurrentStage = EMissionStage::Briefing;
   CurrentThreatLevel = EThreatLevel::Low;
@@ -14,19 +16,16 @@ ATGMissionDirector2::ATGMissionDirector2() {
 
 void ATGMissionDirector2::BeginPlay() {
   Super::BeginPlay();
-  if (EventCheckInterval > 0.0f) {
-    GetWorldTimerManager().SetTimer(EventCheckTimer, this,
-                                    &ATGMissionDirector2::CheckEventTriggers,
-                                    EventCheckInterval, true);
+  for (int32 EventIndex = 0; EventIndex < RegisteredEvents.Num(); EventIndex++) {
+    ScheduleEventTrigger(EventIndex);
   }
 }
 
-void ATGMissionDirector2::Tick(float DeltaTime) {
-  Super::Tick(DeltaTime);
-  if (bMissionActive) {
-    ProcessStageTimeLimit(DeltaTime);
-    UpdateStageProgress();
-  }
+void ATGMissionDirector2::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  // Orphan anything still queued; the scheduler drops it when it comes due
+  CancelStageTimeLimit();
+  ++EventTriggerGeneration;
+  Super::EndPlay(EndPlayReason);
 }
 
 void ATGMissionDirector2::StartMission(
@@ -37,6 +36,7 @@ void ATGMissionDirector2::StartMission(
   StageStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
   CurrentStage =
       bMissionActive ? MissionStages[0].StageType : EMissionStage::Completed;
+  ScheduleStageTimeLimit();
   OnMissionStageChanged.Broadcast(CurrentStage);
 }
 
@@ -48,6 +48,7 @@ void ATGMissionDirector2::AdvanceToNextStage() {
     CurrentStageIndex++;
     CurrentStage = MissionStages[CurrentStageIndex].StageType;
     StageStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+    ScheduleStageTimeLimit();
     OnMissionStageChanged.Broadcast(CurrentStage);
   } else {
     CompleteMission();
@@ -56,17 +57,22 @@ void ATGMissionDirector2::AdvanceToNextStage() {
 
 void ATGMissionDirector2::CompleteMission() {
   bMissionActive = false;
+  CancelStageTimeLimit();
   CurrentStage = EMissionStage::Completed;
   OnMissionCompleted.Broadcast();
 }
 
 void ATGMissionDirector2::FailMission() {
   bMissionActive = false;
+  CancelStageTimeLimit();
   CurrentStage = EMissionStage::Failed;
   OnMissionFailed.Broadcast();
 }
 
-void ATGMissionDirector2::AbortMission() { bMissionActive = false; }
+void ATGMissionDirector2::AbortMission() {
+  bMissionActive = false;
+  CancelStageTimeLimit();
+}
 
 FMissionStageData ATGMissionDirector2::GetCurrentStageData() const {
   return (MissionStages.IsValidIndex(CurrentStageIndex))
@@ -93,7 +99,10 @@ float ATGMissionDirector2::GetStageTimeRemaining() const {
 }
 
 void ATGMissionDirector2::RegisterDynamicEvent(const FDynamicEvent &Event) {
-  RegisteredEvents.Add(Event);
+  const int32 EventIndex = RegisteredEvents.Add(Event);
+  if (HasActorBegunPlay()) {
+    ScheduleEventTrigger(EventIndex);
+  }
 }
 
 void ATGMissionDirector2::TriggerDynamicEvent(const FString &EventName,
@@ -172,17 +181,76 @@ bool ATGMissionDirector2::CheckConditions(
   return ActiveConditions.HasAll(RequiredTags);
 }
 
-void ATGMissionDirector2::UpdateStageProgress() {}
+void ATGMissionDirector2::ScheduleStageTimeLimit() {
+  // Any limit from the previous stage no longer applies
+  CancelStageTimeLimit();
+  if (!bMissionActive || !MissionStages.IsValidIndex(CurrentStageIndex)) {
+    return;
+  }
+  const float TimeLimit = MissionStages[CurrentStageIndex].TimeLimit;
+  if (TimeLimit <= 0.0f) {
+    return;
+  }
+  if (UWorld *World = GetWorld()) {
+    if (UTGMissionSchedulerSubsystem *Scheduler =
+            World->GetSubsystem<UTGMissionSchedulerSubsystem>()) {
+      Scheduler->ScheduleDeadline(this, ETGMissionDeadline::StageTimeLimit,
+                                  StageStartTime + TimeLimit,
+                                  StageDeadlineGeneration);
+    }
+  }
+}
 
-void ATGMissionDirector2::ProcessStageTimeLimit(float DeltaTime) {
-  if (!GetWorld())
+void ATGMissionDirector2::ScheduleEventTrigger(int32 EventIndex) {
+  if (EventCheckInterval <= 0.0f || !RegisteredEvents.IsValidIndex(EventIndex)) {
     return;
-  const FMissionStageData Data = GetCurrentStageData();
-  if (bMissionActive && Data.TimeLimit > 0.0f) {
-    const float Elapsed = GetWorld()->GetTimeSeconds() - StageStartTime;
-    if (Elapsed >= Data.TimeLimit) {
+  }
+  const FDynamicEvent &Event = RegisteredEvents[EventIndex];
+  if (Event.TriggerProbability <= 0.0f ||
+      TriggeredEventNames.Contains(Event.EventName)) {
+    return;
+  }
+
+  // Rolling once per interval, the first success is geometrically distributed;
+  // draw it up front so the event sleeps until then instead of being polled
+  double Intervals = 1.0;
+  if (Event.TriggerProbability < 1.0f) {
+    const double Roll = FMath::Max(1.0 - FMath::FRand(), UE_DOUBLE_SMALL_NUMBER);
+    Intervals = FMath::Max(
+        1.0, FMath::CeilToDouble(FMath::Loge(Roll) /
+                                 FMath::Loge(1.0 - Event.TriggerProbability)));
+  }
+
+  if (UWorld *World = GetWorld()) {
+    if (UTGMissionSchedulerSubsystem *Scheduler =
+            World->GetSubsystem<UTGMissionSchedulerSubsystem>()) {
+      Scheduler->ScheduleDeadline(
+          this, ETGMissionDeadline::DynamicEvent,
+          World->GetTimeSeconds() + Intervals * EventCheckInterval,
+          EventTriggerGeneration, EventIndex);
+    }
+  }
+}
+
+void ATGMissionDirector2::OnScheduledDeadline(ETGMissionDeadline Kind,
+                                              uint32 Generation, int32 Index) {
+  switch (Kind) {
+  case ETGMissionDeadline::StageTimeLimit:
+    if (Generation == StageDeadlineGeneration && bMissionActive) {
       AdvanceToNextStage();
     }
+    break;
+  case ETGMissionDeadline::DynamicEvent:
+    // The probability roll already succeeded; the event fires if its conditions hold, else it redraws
+    if (Generation == EventTriggerGeneration &&
+        RegisteredEvents.IsValidIndex(Index)) {
+      if (ActiveConditions.HasAll(RegisteredEvents[Index].TriggerConditions)) {
+        TriggerDynamicEvent(RegisteredEvents[Index].EventName);
+      } else {
+        ScheduleEventTrigger(Index);
+      }
+    }
+    break;
   }
 }
 
@@ -0,0 +1,59 @@
+#include "TGMissionSchedulerSubsystem.h"
+#include "TGMissionDirector2.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("TG Mission Scheduler"), STAT_TGMissionScheduler, STATGROUP_Game);
+
+void UTGMissionSchedulerSubsystem::Deinitialize()
+{
+    Deadlines.Empty();
+    Super::Deinitialize();
+}
+
+bool UTGMissionSchedulerSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTGMissionSchedulerSubsystem::ScheduleDeadline(ATGMissionDirector2* Director, ETGMissionDeadline Kind, double Time, uint32 Generation, int32 Index)
+{
+    if (!Director)
+    {
+        return;
+    }
+
+    FScheduledDeadline Deadline;
+    Deadline.Time = Time;
+    Deadline.Sequence = NextSequence++;
+    Deadline.Director = Director;
+    Deadline.Kind = Kind;
+    Deadline.Generation = Generation;
+    Deadline.Index = Index;
+    Deadlines.HeapPush(Deadline, FDeadlineOrder());
+}
+
+void UTGMissionSchedulerSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_TGMissionScheduler);
+
+    LastDispatchCount = 0;
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    while (Deadlines.Num() > 0 && Deadlines.HeapTop().Time <= Now)
+    {
+        // Pop before dispatching; the handler usually schedules the director's next deadline
+        FScheduledDeadline Deadline;
+        Deadlines.HeapPop(Deadline, FDeadlineOrder(), EAllowShrinking::No);
+
+        if (ATGMissionDirector2* Director = Deadline.Director.Get())
+        {
+            Director->OnScheduledDeadline(Deadline.Kind, Deadline.Generation, Deadline.Index);
+            ++LastDispatchCount;
+        }
+    }
+}
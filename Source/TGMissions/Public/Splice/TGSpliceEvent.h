@@ -68,6 +68,40 @@ struct FTGTerritorialEventContext
     TMap<FName, FString> ToContextMap() const;
 };
 
+/** Context keys with fixed symbol slots, in FTGTerritorialEventContext order; other constraint keys get slots after these */
+enum class ETGSpliceContextSlot : uint8
+{
+    TerritoryId,
+    TerritoryName,
+    TerritoryType,
+    PreviousControllerFactionId,
+    PreviousControllerFactionName,
+    NewControllerFactionId,
+    NewControllerFactionName,
+    StrategicValue,
+    ResourceMultiplier,
+    WasContested,
+    IsContested,
+    ConnectedTerritoryIds,
+    ConnectedTerritoryNames,
+    Count
+};
+
+/** Splice context resolved to interned value symbols, one slot per constraint key */
+struct FTGSpliceSymbolContext
+{
+    static constexpr int32 MaxSlots = 64;
+
+    uint64 PresentMask = 0;
+    int32 Values[MaxSlots]; // Only meaningful where PresentMask is set; INDEX_NONE = value no constraint uses
+
+    void Set(int32 Slot, int32 Symbol)
+    {
+        Values[Slot] = Symbol;
+        PresentMask |= uint64(1) << Slot;
+    }
+};
+
 USTRUCT(BlueprintType)
 struct FTGSpliceOutcome
 {
@@ -76,6 +110,10 @@ struct FTGSpliceOutcome
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Splice")
     FString OutcomeId;
 
+    /** Relative chance among the card's outcomes (clamped to at least 1) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Splice")
+    int32 Weight = 1;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Splice")
     int32 ReputationDelta = 0;
 
@@ -132,6 +170,8 @@ public:
     // UWorldSubsystem interface
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
+
+    /** Compiles the deck into the per-trigger selection tables; re-register a deck after editing its cards */
     UFUNCTION(BlueprintCallable, Category="Splice")
     void RegisterDeck(UTGSpliceEventDeck* Deck);
 
@@ -155,8 +195,66 @@ public:
 protected:
     TArray<TWeakObjectPtr<UTGSpliceEventDeck>> Decks;
 
-    bool IsCardEligible(const FTGSpliceEventCard& Card, const TMap<FName, FString>& Context) const;
-    const FTGSpliceOutcome* ChooseOutcome(const FTGSpliceEventCard& Card) const;
+    struct FSpliceConstraint
+    {
+        int32 Slot = 0;
+        int32 Symbol = 0;
+    };
+
+    /** One compiled card; weights are pre-clamped, outcomes index into OutcomeCumulativeWeights
+        and constraints into ConstraintPool */
+    struct FSpliceCardEntry
+    {
+        int32 DeckIndex = 0;
+        int32 CardIndex = 0;
+        int64 Weight = 1;
+        int32 OutcomeStart = 0;
+        int32 OutcomeCount = 0;
+        uint64 RequiredMask = 0;
+        int32 ConstraintStart = 0;
+        int32 ConstraintCount = 0;
+    };
+
+    /** Cards listening to one trigger. Unconstrained cards are always eligible, so their
+        prefix sums are built once; constrained cards are filtered per call into scratch sums. */
+    struct FSpliceTriggerBucket
+    {
+        TArray<int32> Unconstrained;
+        TArray<int64> UnconstrainedCumulative;
+        TArray<int32> Constrained;
+    };
+
+    TArray<FSpliceCardEntry> CardEntries;
+    TArray<int64> OutcomeCumulativeWeights;
+    TArray<FSpliceConstraint> ConstraintPool;
+    TArray<FSpliceTriggerBucket> TriggerBuckets; // Index = ETGSpliceTrigger
+
+    // Reused between triggers so selection does not allocate once warm
+    TArray<int32> ScratchEligible;
+    TArray<int64> ScratchCumulative;
+
+    // Symbol tables, rebuilt with the index. Value symbols compare like FString (case-insensitive).
+    TMap<FName, int32> KeySlots;
+    TMap<FString, int32> ValueSymbols;
+    TMap<int32, int32> IntValueSymbols;     // Numeric constraint values, so integer fields skip formatting
+    TMap<float, int32> FloatValueSymbols;
+    int32 TrueSymbol = INDEX_NONE;
+    int32 FalseSymbol = INDEX_NONE;
+    uint64 ReferencedSlotMask = 0;          // Slots at least one constraint reads
+
+    void RebuildSpliceIndex();
+    void RefreshStaleDecks();
+    const FTGSpliceEventCard* ResolveCard(const FSpliceCardEntry& Entry) const;
+
+    int32 InternKey(FName Key);
+    int32 InternValue(const FString& Value);
+    int32 FindValueSymbol(const FString& Value) const;
+    void BuildSymbolContext(const TMap<FName, FString>& Context, FTGSpliceSymbolContext& OutContext) const;
+    void BuildSymbolContext(const FTGTerritorialEventContext& TerritorialContext, FTGSpliceSymbolContext& OutContext) const;
+
+    bool IsEntryEligible(const FSpliceCardEntry& Entry, const FTGSpliceSymbolContext& Context) const;
+    bool TriggerWithSymbols(ETGSpliceTrigger Trigger, const FTGSpliceSymbolContext& SymbolContext, const TMap<FName, FString>& OutcomeContext);
+    const FTGSpliceOutcome* ChooseOutcome(const FSpliceCardEntry& Entry, const FTGSpliceEventCard& Card) const;
 
     /** Apply card outcome side effects into other systems (convoy economy, trust, codex). */
     void ApplyOutcome(const FTGSpliceOutcome& Outcome, const TMap<FName, FString>& Context);
@@ -7,6 +7,7 @@
 #include "TGMissionDirector2.generated.h"
 
 // Forward declarations
+enum class ETGMissionDeadline : uint8;
 
 UENUM(BlueprintType)
 enum class EMissionStage : uint8
@@ -122,7 +123,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMissionCompleted);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMissionFailed);
 
 /**
- * Advanced mission director managing multi-stage missions with dynamic events
+ * Advanced mission director managing multi-stage missions with dynamic events.
+ * Does not tick: stage time limits and event checks are deadlines on the world's
+ * UTGMissionSchedulerSubsystem, and stage progress is computed when queried.
  */
 UCLASS()
 class TGMISSIONS_API ATGMissionDirector2 : public AActor
@@ -134,7 +137,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaTime) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     // Mission Management
@@ -225,6 +228,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Siege")
     void SetSiegeMode(bool bEnabled) { bSiegeMode = bEnabled; }
 
+    /** Called by the mission scheduler; ignored if the deadline was superseded since it was scheduled */
+    void OnScheduledDeadline(ETGMissionDeadline Kind, uint32 Generation, int32 Index);
+
     // Events
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnMissionStageChanged OnMissionStageChanged;
@@ -281,7 +287,7 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Progress")
     TArray<FString> CompletedObjectives;
 
-    // Configuration
+    // Configuration: each event rolls its trigger probability once per interval
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Configuration")
     float EventCheckInterval = 30.0f;
 
@@ -292,10 +298,13 @@ protected:
     float ThreatScalingIncrement = 0.25f;
 
 private:
-    void UpdateStageProgress();
-    void ProcessStageTimeLimit(float DeltaTime);
+    void ScheduleStageTimeLimit();
+    void ScheduleEventTrigger(int32 EventIndex);
+    void CancelStageTimeLimit() { ++StageDeadlineGeneration; }
     bool EvaluateEventTrigger(const FDynamicEvent& Event) const;
     void ApplyThreatScaling();
 
-    FTimerHandle EventCheckTimer;
+    // Bumped to invalidate deadlines already queued on the scheduler
+    uint32 StageDeadlineGeneration = 0;
+    uint32 EventTriggerGeneration = 0;
 };
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "TGMissionSchedulerSubsystem.generated.h"
+
+class ATGMissionDirector2;
+
+/** What a scheduled mission deadline wakes its director up for */
+enum class ETGMissionDeadline : uint8
+{
+    StageTimeLimit,
+    DynamicEvent // One registered event's next trigger time
+};
+
+/**
+ * Mission Scheduler Subsystem
+ * One deadline queue shared by every mission director in the world. Directors schedule their
+ * stage time limits and each dynamic event's trigger time here instead of ticking; each frame only the
+ * deadlines that have come due are popped and dispatched, so idle directors cost nothing.
+ * Cancelling is lazy: directors bump a generation and stale entries are dropped when popped.
+ */
+UCLASS()
+class TGMISSIONS_API UTGMissionSchedulerSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // UWorldSubsystem interface
+    virtual void Deinitialize() override;
+    virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGMissionSchedulerSubsystem, STATGROUP_Tickables); }
+    virtual bool IsTickable() const override { return !IsTemplate() && Deadlines.Num() > 0; }
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+    /** Calls Director->OnScheduledDeadline(Kind, Generation, Index) once world time reaches Time */
+    void ScheduleDeadline(ATGMissionDirector2* Director, ETGMissionDeadline Kind, double Time, uint32 Generation, int32 Index = INDEX_NONE);
+
+    /** Pending entries, including cancelled ones not yet popped */
+    int32 GetPendingDeadlineCount() const { return Deadlines.Num(); }
+    int32 GetLastDispatchCount() const { return LastDispatchCount; }
+
+private:
+    struct FScheduledDeadline
+    {
+        double Time = 0.0;
+        uint64 Sequence = 0;
+        TWeakObjectPtr<ATGMissionDirector2> Director;
+        ETGMissionDeadline Kind = ETGMissionDeadline::StageTimeLimit;
+        uint32 Generation = 0;
+        int32 Index = INDEX_NONE; // Which event, for DynamicEvent deadlines
+    };
+
+    // Earliest first; equal times fire in the order they were scheduled
+    struct FDeadlineOrder
+    {
+        bool operator()(const FScheduledDeadline& A, const FScheduledDeadline& B) const
+        {
+            return A.Time < B.Time || (A.Time == B.Time && A.Sequence < B.Sequence);
+        }
+    };
+
+    TArray<FScheduledDeadline> Deadlines; // Binary min-heap
+    uint64 NextSequence = 0;
+    int32 LastDispatchCount = 0;
+};
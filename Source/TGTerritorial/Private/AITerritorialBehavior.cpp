@@ -3,6 +3,12 @@
 #include "AITerritorialBehavior.h"
 #include "Engine/World.h"
 #include "TerritorialManager.h"
+#include "TerritorialInfluenceMapSubsystem.h"
+#include "Economy/TGEconomicWarfareSubsystem.h"
+#include "Async/ParallelFor.h"
+
+// Frontier pressure change that invalidates a cached region priority
+static constexpr float FrontierPressureTolerance = 0.05f;
 
 UAITerritorialBehavior::UAITerritorialBehavior()
 {
@@ -16,40 +22,217 @@ UAITerritorialBehavior::UAITerritorialBehavior()
 
 void UAITerritorialBehavior::UpdateTerritorialAI(const FTerritorialWorldState& WorldState)
 {
-    // Stub implementation - analyze threats and make decisions
-    TArray<FTerritorialThreat> CurrentThreats = AnalyzeThreats(WorldState);
-    FTerritorialDecision Decision = MakeStrategicDecisionWithThreats(WorldState, CurrentThreats);
-    
-    if (!Decision.DecisionType.IsEmpty())
+    FTerritorialFactionEvaluation Evaluation;
+    EvaluateWorldSnapshot(WorldState, Evaluation);
+    ApplyEvaluation(MoveTemp(Evaluation));
+}
+
+void UAITerritorialBehavior::EvaluateWorldSnapshot(const FTerritorialWorldState& Snapshot, FTerritorialFactionEvaluation& OutEvaluation)
+{
+    // Runs on worker threads: reads the snapshot and touches only this behavior's own
+    // incremental tables, never shared UObject state or Blueprint events
+    OutEvaluation.FactionID = FactionID;
+
+    // With a manager feeding updates, threats and priorities cost O(changes + top-k)
+    const bool bIncremental = bThreatTableActive;
+
+    if (bIncremental)
     {
-        PendingDecisions.Add(Decision);
+        GetTopThreats(TopThreatCount, OutEvaluation.Threats);
     }
-    
+    else
+    {
+        OutEvaluation.Threats = AnalyzeThreats(Snapshot);
+    }
+
+    OutEvaluation.TerritoryPriorities.Reset();
+    if (!bIncremental || !bPrioritiesSeeded)
+    {
+        OutEvaluation.bFullPriorityRefresh = true;
+        OutEvaluation.TerritoryPriorities.Reserve(Snapshot.RegionStates.Num());
+        PriorityHeap.Reset();
+        PriorityFrontierPressure.Reset();
+        for (const auto& RegionPair : Snapshot.RegionStates)
+        {
+            const float Priority = CalculateTerritoryPriority(RegionPair.Key, ETerritoryType::Region, Snapshot);
+            OutEvaluation.TerritoryPriorities.Add(RegionPair.Key, Priority);
+            PriorityHeap.Set(MakeTerritoryKey(ETerritoryType::Region, RegionPair.Key), Priority);
+            PriorityFrontierPressure.Add(RegionPair.Key, GetFrontierPressure(RegionPair.Key, Snapshot));
+        }
+        bPrioritiesSeeded = bIncremental;
+    }
+    else
+    {
+        // Influence-map pressure moves without territorial updates; re-rank regions whose pressure shifted
+        for (const auto& SamplePair : Snapshot.RegionInfluence)
+        {
+            const float Pressure = GetFrontierPressure(SamplePair.Key, Snapshot);
+            if (FMath::Abs(Pressure - PriorityFrontierPressure.FindRef(SamplePair.Key)) > FrontierPressureTolerance)
+            {
+                DirtyPriorityRegions.Add(SamplePair.Key);
+            }
+        }
+
+        // Supply choke points move with convoy disruptions rather than territorial updates
+        for (const auto& ChokePair : Snapshot.SupplyChokeFactionMasks)
+        {
+            if (PrioritySupplyChokeMasks.FindRef(ChokePair.Key) != ChokePair.Value)
+            {
+                DirtyPriorityRegions.Add(ChokePair.Key);
+            }
+        }
+        for (const auto& ChokePair : PrioritySupplyChokeMasks)
+        {
+            if (!Snapshot.SupplyChokeFactionMasks.Contains(ChokePair.Key))
+            {
+                DirtyPriorityRegions.Add(ChokePair.Key);
+            }
+        }
+
+        for (const int32 RegionID : DirtyPriorityRegions)
+        {
+            const uint64 Key = MakeTerritoryKey(ETerritoryType::Region, RegionID);
+            if (Snapshot.RegionStates.Contains(RegionID))
+            {
+                const float Priority = CalculateTerritoryPriority(RegionID, ETerritoryType::Region, Snapshot);
+                OutEvaluation.TerritoryPriorities.Add(RegionID, Priority);
+                PriorityHeap.Set(Key, Priority);
+                PriorityFrontierPressure.Add(RegionID, GetFrontierPressure(RegionID, Snapshot));
+            }
+            else
+            {
+                PriorityHeap.Remove(Key);
+            }
+        }
+    }
+    DirtyPriorityRegions.Reset();
+    PrioritySupplyChokeMasks = Snapshot.SupplyChokeFactionMasks;
+
+    OutEvaluation.Decision = MakeStrategicDecisionWithThreats(Snapshot, OutEvaluation.Threats);
+
+    // Give expansion a concrete target: the highest priority viable region (lowest ID breaks ties)
+    if (OutEvaluation.Decision.DecisionType == TEXT("expansion") && OutEvaluation.Decision.TargetTerritoryID == 0)
+    {
+        TArray<TPair<uint64, float>> Candidates;
+        PriorityHeap.GetTop(bIncremental ? ExpansionCandidateCount : PriorityHeap.Num(), Candidates);
+        for (const TPair<uint64, float>& Candidate : Candidates)
+        {
+            const int32 RegionID = GetTerritoryKeyID(Candidate.Key);
+            if (IsViableTerritorialTarget(RegionID, ETerritoryType::Region, Snapshot))
+            {
+                OutEvaluation.Decision.TargetTerritoryID = RegionID;
+                break;
+            }
+        }
+    }
+}
+
+void UAITerritorialBehavior::ApplyEvaluation(FTerritorialFactionEvaluation&& Evaluation)
+{
+    if (Evaluation.bFullPriorityRefresh)
+    {
+        TerritoryPriorities = MoveTemp(Evaluation.TerritoryPriorities);
+    }
+    else
+    {
+        for (const auto& PriorityPair : Evaluation.TerritoryPriorities)
+        {
+            TerritoryPriorities.Add(PriorityPair.Key, PriorityPair.Value);
+        }
+    }
+
+    if (!Evaluation.Decision.DecisionType.IsEmpty())
+    {
+        PendingDecisions.Add(MoveTemp(Evaluation.Decision));
+    }
+
     LastDecisionTime = FDateTime::Now();
 }
 
+void UAITerritorialBehavior::SetThreat(uint64 TerritoryKey, const FTerritorialThreat& Threat, float Score)
+{
+    FTerritorialThreat& Entry = ThreatTable.FindOrAdd(TerritoryKey);
+    const FDateTime FirstDetected = Entry.TargetTerritoryID != 0 ? Entry.ThreatDetected : Threat.ThreatDetected;
+    Entry = Threat;
+    Entry.ThreatDetected = FirstDetected;
+    ThreatHeap.Set(TerritoryKey, Score);
+}
+
+void UAITerritorialBehavior::ClearThreat(uint64 TerritoryKey)
+{
+    if (ThreatTable.Remove(TerritoryKey) > 0)
+    {
+        ThreatHeap.Remove(TerritoryKey);
+    }
+}
+
+void UAITerritorialBehavior::ResetThreatTable()
+{
+    ThreatTable.Reset();
+    ThreatHeap.Reset();
+    PriorityHeap.Reset();
+    DirtyPriorityRegions.Reset();
+    bPrioritiesSeeded = false;
+}
+
+void UAITerritorialBehavior::GetTopThreats(int32 Count, TArray<FTerritorialThreat>& OutThreats)
+{
+    TArray<TPair<uint64, float>> Top;
+    ThreatHeap.GetTop(Count, Top);
+
+    OutThreats.Reset(Top.Num());
+    for (const TPair<uint64, float>& Entry : Top)
+    {
+        if (const FTerritorialThreat* Threat = ThreatTable.Find(Entry.Key))
+        {
+            OutThreats.Add(*Threat);
+        }
+    }
+}
+
+// Tracked influence state for every region and district in a world snapshot
+static void TrackWorldState(const FTerritorialWorldState& WorldState, TMap<uint64, FTrackedTerritoryState>& OutTerritories)
+{
+    auto TrackStates = [&OutTerritories](const TMap<int32, FTerritorialState>& States, ETerritoryType Type)
+    {
+        for (const auto& StatePair : States)
+        {
+            FTrackedTerritoryState& Tracked = OutTerritories.Add(MakeTerritoryKey(Type, StatePair.Key));
+            for (const auto& Influence : StatePair.Value.FactionInfluences)
+            {
+                if (Influence.Key >= 1 && Influence.Key <= TERRITORIAL_MAX_FACTIONS)
+                {
+                    Tracked.Influence[Influence.Key] = Influence.Value;
+                }
+            }
+            Tracked.Refresh();
+        }
+    };
+    TrackStates(WorldState.RegionStates, ETerritoryType::Region);
+    TrackStates(WorldState.DistrictStates, ETerritoryType::District);
+}
+
 TArray<FTerritorialThreat> UAITerritorialBehavior::AnalyzeThreats(const FTerritorialWorldState& WorldState)
 {
     TArray<FTerritorialThreat> Threats;
-    
-    // Stub implementation - basic threat detection
-    for (const auto& RegionPair : WorldState.RegionStates)
+
+    // Same state and scoring the incremental threat table keeps, built from the snapshot in one pass
+    TMap<uint64, FTrackedTerritoryState> Territories;
+    Territories.Reserve(WorldState.RegionStates.Num() + WorldState.DistrictStates.Num());
+    TrackWorldState(WorldState, Territories);
+
+    for (const auto& TerritoryPair : Territories)
     {
-        const FTerritorialState& RegionState = RegionPair.Value;
-        
-        // Check if we're losing influence in territories we control
-        if (RegionState.DominantFaction == FactionID && RegionState.bIsContested)
+        FTerritorialThreat Threat;
+        if (ScoreTerritoryThreat(FactionID, TerritoryPair.Key, TerritoryPair.Value, Threat) > 0.0f)
         {
-            FTerritorialThreat Threat;
-            Threat.TargetTerritoryID = RegionPair.Key;
-            Threat.TargetTerritoryType = ETerritoryType::Region;
-            Threat.ThreatLevel = 70; // High threat for contested controlled territory
-            Threat.ThreatType = TEXT("territorial_loss");
-            Threat.ThreatDetected = FDateTime::Now();
-            Threats.Add(Threat);
+            Threats.Add(MoveTemp(Threat));
         }
     }
-    
+
+    // Highest threat first, as GetTopThreats returns them
+    Threats.Sort([](const FTerritorialThreat& A, const FTerritorialThreat& B) { return A.ThreatLevel > B.ThreatLevel; });
+
     return Threats;
 }
 
@@ -151,13 +334,66 @@ void UAITerritorialManager::InitializeFactionalAI()
 
 void UAITerritorialManager::UpdateAIDecisions(const FTerritorialWorldState& WorldState)
 {
+    // Deterministic merge order regardless of map layout or worker scheduling
+    TArray<UAITerritorialBehavior*> Behaviors;
+    Behaviors.Reserve(FactionAIs.Num());
     for (auto& FactionAIPair : FactionAIs)
     {
         if (FactionAIPair.Value)
         {
-            FactionAIPair.Value->UpdateTerritorialAI(WorldState);
+            Behaviors.Add(FactionAIPair.Value);
+        }
+    }
+    Behaviors.Sort([](const UAITerritorialBehavior& A, const UAITerritorialBehavior& B)
+    {
+        return A.FactionID < B.FactionID;
+    });
+
+    // Frozen copy so callers mutating their state mid-evaluation cannot race the workers
+    FTerritorialWorldState Snapshot = WorldState;
+
+    // Supply choke points from the economic warfare max-flow model, unless the caller already supplied them
+    if (Snapshot.SupplyChokeFactionMasks.Num() == 0)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            if (const UTGEconomicWarfareSubsystem* Warfare = World->GetSubsystem<UTGEconomicWarfareSubsystem>())
+            {
+                for (int32 SupplyFaction = 1; SupplyFaction <= TERRITORIAL_MAX_FACTIONS; ++SupplyFaction)
+                {
+                    for (const int32 ChokeTerritoryID : Warfare->GetVulnerableSupplyRoutes(SupplyFaction))
+                    {
+                        Snapshot.SupplyChokeFactionMasks.FindOrAdd(ChokeTerritoryID) |= 1 << SupplyFaction;
+                    }
+                }
+            }
         }
     }
+
+    // Spatial pressure from the influence map, unless the caller already sampled it
+    if (Snapshot.RegionInfluence.Num() == 0)
+    {
+        SampleRegionInfluence(Snapshot);
+    }
+
+    // One full pass to build the threat model; afterwards it is kept current by NotifyTerritorialChange
+    if (!bThreatModelSeeded)
+    {
+        SeedThreatModel(Snapshot);
+    }
+
+    TArray<FTerritorialFactionEvaluation> Evaluations;
+    Evaluations.SetNum(Behaviors.Num());
+
+    ParallelFor(Behaviors.Num(), [&Behaviors, &Snapshot, &Evaluations](int32 Index)
+    {
+        Behaviors[Index]->EvaluateWorldSnapshot(Snapshot, Evaluations[Index]);
+    }, !bParallelFactionEvaluation);
+
+    for (int32 Index = 0; Index < Behaviors.Num(); ++Index)
+    {
+        Behaviors[Index]->ApplyEvaluation(MoveTemp(Evaluations[Index]));
+    }
 }
 
 void UAITerritorialManager::ProcessAIActions(float DeltaTime)
@@ -184,13 +420,120 @@ void UAITerritorialManager::ProcessAIActions(float DeltaTime)
 
 void UAITerritorialManager::NotifyTerritorialChange(const FTerritorialUpdate& Update)
 {
-    // Notify all faction AIs about territorial changes so they can react
+    // Before the first decision pass the seed will capture this state anyway
+    if (!bThreatModelSeeded || Update.FactionID < 1 || Update.FactionID > TERRITORIAL_MAX_FACTIONS)
+    {
+        return;
+    }
+
+    const uint64 Key = MakeTerritoryKey(Update.TerritoryType, Update.TerritoryID);
+    FTrackedTerritoryState& State = TrackedTerritories.FindOrAdd(Key);
+    State.Influence[Update.FactionID] = FMath::Max(0, Update.NewInfluenceValue);
+    State.Refresh();
+
+    RescoreTerritory(Key);
+
+    if (Update.TerritoryType == ETerritoryType::Region)
+    {
+        for (auto& FactionAIPair : FactionAIs)
+        {
+            if (FactionAIPair.Value)
+            {
+                FactionAIPair.Value->MarkPriorityDirty(Update.TerritoryID);
+            }
+        }
+    }
+}
+
+void UAITerritorialManager::SetRegionLayout(const TArray<FTerritorialConfigRow>& ConfigRows)
+{
+    RegionLayout.Reset();
+    for (const FTerritorialConfigRow& Row : ConfigRows)
+    {
+        if (Row.TerritoryInfo.TerritoryType == ETerritoryType::Region)
+        {
+            RegionLayout.Add(Row.TerritoryInfo);
+        }
+    }
+}
+
+void UAITerritorialManager::SampleRegionInfluence(FTerritorialWorldState& WorldState) const
+{
+    if (RegionLayout.Num() == 0)
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (const UTerritorialInfluenceMapSubsystem* InfluenceMap = World->GetSubsystem<UTerritorialInfluenceMapSubsystem>())
+        {
+            InfluenceMap->FillWorldStateInfluence(RegionLayout, WorldState);
+        }
+    }
+}
+
+void UAITerritorialManager::SeedThreatModel(const FTerritorialWorldState& WorldState)
+{
+    TrackedTerritories.Reset();
+
+    TrackWorldState(WorldState, TrackedTerritories);
+
     for (auto& FactionAIPair : FactionAIs)
     {
         if (FactionAIPair.Value)
         {
-            // AI can analyze this update and adjust its strategy
-            // For now, just trigger a re-evaluation on the next update cycle
+            FactionAIPair.Value->ResetThreatTable();
+            FactionAIPair.Value->bThreatTableActive = true;
+        }
+    }
+
+    for (const auto& TerritoryPair : TrackedTerritories)
+    {
+        RescoreTerritory(TerritoryPair.Key);
+    }
+
+    bThreatModelSeeded = true;
+}
+
+float UAITerritorialBehavior::ScoreTerritoryThreat(int32 ThreatenedFactionID, uint64 Key, const FTrackedTerritoryState& State, FTerritorialThreat& OutThreat)
+{
+    // Check if we're losing influence in regions we control
+    if (GetTerritoryKeyType(Key) != ETerritoryType::Region || State.DominantFaction != ThreatenedFactionID || !State.bIsContested)
+    {
+        return 0.0f;
+    }
+
+    OutThreat.TargetTerritoryID = GetTerritoryKeyID(Key);
+    OutThreat.TargetTerritoryType = ETerritoryType::Region;
+    OutThreat.ThreatLevel = 70; // High threat for contested controlled territory
+    OutThreat.ThreatType = TEXT("territorial_loss");
+    OutThreat.ThreatDetected = FDateTime::Now();
+
+    return static_cast<float>(OutThreat.ThreatLevel);
+}
+
+void UAITerritorialManager::RescoreTerritory(uint64 TerritoryKey)
+{
+    const FTrackedTerritoryState* State = TrackedTerritories.Find(TerritoryKey);
+
+    for (auto& FactionAIPair : FactionAIs)
+    {
+        UAITerritorialBehavior* FactionAI = FactionAIPair.Value;
+        if (!FactionAI)
+        {
+            continue;
+        }
+
+        FTerritorialThreat Threat;
+        const float Score = State ? UAITerritorialBehavior::ScoreTerritoryThreat(FactionAI->FactionID, TerritoryKey, *State, Threat) : 0.0f;
+        if (Score > 0.0f)
+        {
+            FactionAI->SetThreat(TerritoryKey, Threat, Score);
+        }
+        else
+        {
+            FactionAI->ClearThreat(TerritoryKey);
         }
     }
 }
@@ -306,15 +649,54 @@ float UAITerritorialBehavior::CalculateTerritoryPriority(int32 TerritoryID, ETer
     // Apply defensive bonus for territories we already control
     if (const FTerritorialState* State = WorldState.RegionStates.Find(TerritoryID))
     {
+        const float Pressure = GetFrontierPressure(TerritoryID, WorldState);
         if (State->DominantFaction == FactionID)
         {
             Priority += DefensiveBonus * 20.0f;
+
+            // Rivals massing on the ground raise the stakes of holding it
+            Priority += FMath::Max(0.0f, Pressure) * FrontierPressureWeight;
+        }
+        else
+        {
+            // Our own presence near the border makes it the natural next step
+            Priority += FMath::Max(0.0f, -Pressure) * FrontierPressureWeight;
+        }
+
+        // Choke points on a rival's supply network are worth taking; our own are worth holding
+        const int32 ChokeMask = WorldState.SupplyChokeFactionMasks.FindRef(TerritoryID);
+        const int32 OwnBit = 1 << FactionID;
+        if (ChokeMask & (State->DominantFaction == FactionID ? OwnBit : ~OwnBit))
+        {
+            Priority += SupplyChokeWeight;
         }
     }
     
     return FMath::Clamp(Priority, 10.0f, 100.0f);
 }
 
+float UAITerritorialBehavior::GetFrontierPressure(int32 TerritoryID, const FTerritorialWorldState& WorldState) const
+{
+    const FTerritorialInfluenceSample* Sample = WorldState.RegionInfluence.Find(TerritoryID);
+    if (!Sample || !Sample->FactionInfluence.IsValidIndex(FactionID))
+    {
+        return 0.0f;
+    }
+
+    const float Own = Sample->FactionInfluence[FactionID];
+    float StrongestRival = 0.0f;
+    for (int32 OtherFaction = 1; OtherFaction < Sample->FactionInfluence.Num(); ++OtherFaction)
+    {
+        if (OtherFaction != FactionID)
+        {
+            StrongestRival = FMath::Max(StrongestRival, Sample->FactionInfluence[OtherFaction]);
+        }
+    }
+
+    const float Total = Own + StrongestRival;
+    return Total > KINDA_SMALL_NUMBER ? (StrongestRival - Own) / Total : 0.0f;
+}
+
 bool UAITerritorialBehavior::IsViableTerritorialTarget(int32 TerritoryID, ETerritoryType TerritoryType, const FTerritorialWorldState& WorldState)
 {
     const FTerritorialState* State = WorldState.RegionStates.Find(TerritoryID);
@@ -7,6 +7,7 @@
 #include "Components/DecalComponent.h"
 #include "GameFramework/Pawn.h"
 #include "TerritorialManager.h"
+#include "TerritorialInfluenceMapSubsystem.h"
 
 UFactionAreaComponent::UFactionAreaComponent()
 {
@@ -78,6 +79,14 @@ void UFactionAreaComponent::BeginPlay()
             SpawnPoints.Add(AreaCenter + SpawnOffset);
         }
     }
+
+    RegisterInfluenceSource();
+}
+
+void UFactionAreaComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UnregisterInfluenceSource();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UFactionAreaComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -127,6 +136,11 @@ void UFactionAreaComponent::InitializeFactionArea(EFactionID InFactionID, int32
 
     UE_LOG(LogTemp, Log, TEXT("FactionAreaComponent: Initialized %s (ID: %d) at %s with radius %f"), 
         *AreaName, TerritoryID, *AreaCenter.ToString(), AreaRadius);
+
+    if (HasBegunPlay())
+    {
+        RegisterInfluenceSource();
+    }
 }
 
 void UFactionAreaComponent::SetFactionVisualIdentity(FLinearColor Color, float Intensity)
@@ -441,4 +455,44 @@ void UFactionAreaComponent::NotifyTerritorialManager(int32 InfluenceChange, cons
             );
         }
     }
-}
\ No newline at end of file
+}
+
+void UFactionAreaComponent::RegisterInfluenceSource()
+{
+    UnregisterInfluenceSource();
+
+    if (FactionID == EFactionID::None || !GetOwner())
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UTerritorialInfluenceMapSubsystem* InfluenceMap = World->GetSubsystem<UTerritorialInfluenceMapSubsystem>())
+        {
+            // Control structures are static, so a fixed source is enough
+            InfluenceSourceHandle = InfluenceMap->AddSource(
+                static_cast<int32>(FactionID),
+                GetOwner()->GetActorTransform().TransformPosition(AreaCenter),
+                InfluenceMapStrength * BaseInfluenceRate,
+                InfluenceRadius);
+        }
+    }
+}
+
+void UFactionAreaComponent::UnregisterInfluenceSource()
+{
+    if (InfluenceSourceHandle == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UTerritorialInfluenceMapSubsystem* InfluenceMap = World->GetSubsystem<UTerritorialInfluenceMapSubsystem>())
+        {
+            InfluenceMap->RemoveSource(InfluenceSourceHandle);
+        }
+    }
+    InfluenceSourceHandle = INDEX_NONE;
+}
@@ -0,0 +1,74 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "TerritorialManager.h"
+#include "AITerritorialBehavior.h"
+#include "TerritorialInfluenceMapSubsystem.h"
+#include "TGTestWorld.h"
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTerritorialConfigurationTest, "TerminalGrounds.Territorial.Configuration.RegionInfluenceSampled", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTerritorialConfigurationTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 RegionID = 9001;
+    constexpr int32 DistrictID = 9002;
+    constexpr int32 FactionID = 2;
+
+    FTGScopedTestWorld TestWorld(TEXT("TGTerritorialConfigurationTest"));
+    UWorld* World = TestWorld.Get();
+
+    UTerritorialSubsystem* Territorial = World->GetSubsystem<UTerritorialSubsystem>();
+    UTerritorialInfluenceMapSubsystem* InfluenceMap = World->GetSubsystem<UTerritorialInfluenceMapSubsystem>();
+    TestNotNull(TEXT("Territorial subsystem exists in game worlds"), Territorial);
+    TestNotNull(TEXT("Influence map subsystem exists in game worlds"), InfluenceMap);
+    if (!Territorial || !InfluenceMap || !Territorial->GetAIManager())
+    {
+        return false;
+    }
+
+    // A region well outside the influence map's default bounds, and a district the AI does not sample
+    const FVector RegionLocation(150000.0f, 20000.0f, 0.0f);
+    UDataTable* ConfigTable = NewObject<UDataTable>(GetTransientPackage());
+    ConfigTable->RowStruct = FTerritorialConfigRow::StaticStruct();
+
+    FTerritorialConfigRow RegionRow;
+    RegionRow.TerritoryInfo.TerritoryID = RegionID;
+    RegionRow.TerritoryInfo.TerritoryType = ETerritoryType::Region;
+    RegionRow.TerritoryInfo.WorldPosition = RegionLocation;
+    RegionRow.TerritoryInfo.ControlRadius = 5000.0f;
+    ConfigTable->AddRow(TEXT("FarRegion"), RegionRow);
+
+    FTerritorialConfigRow DistrictRow;
+    DistrictRow.TerritoryInfo.TerritoryID = DistrictID;
+    DistrictRow.TerritoryInfo.TerritoryType = ETerritoryType::District;
+    DistrictRow.TerritoryInfo.WorldPosition = RegionLocation;
+    DistrictRow.TerritoryInfo.ControlRadius = 2000.0f;
+    DistrictRow.ParentTerritoryID = RegionID;
+    ConfigTable->AddRow(TEXT("FarDistrict"), DistrictRow);
+
+    Territorial->ConfigureTerritories(ConfigTable);
+
+    InfluenceMap->UpdateInterval = 0.0f;
+    InfluenceMap->AddSource(FactionID, RegionLocation, 50.0f, 4000.0f);
+    for (int32 Step = 0; Step < 5; Step++)
+    {
+        InfluenceMap->Tick(0.1f);
+    }
+    TestTrue(TEXT("The grid was resized to cover the configured territories"), InfluenceMap->GetInfluenceAt(FactionID, RegionLocation) > 0.0f);
+
+    FTerritorialWorldState WorldState;
+    Territorial->GetAIManager()->SampleRegionInfluence(WorldState);
+    const FTerritorialInfluenceSample* Sample = WorldState.RegionInfluence.Find(RegionID);
+    TestNotNull(TEXT("The configured region is sampled for the faction AI"), Sample);
+    TestFalse(TEXT("Districts are not part of the region layout"), WorldState.RegionInfluence.Contains(DistrictID));
+    if (Sample)
+    {
+        TestTrue(TEXT("The region sample carries the faction's pressure"), Sample->FactionInfluence.IsValidIndex(FactionID) && Sample->FactionInfluence[FactionID] > 0.0f);
+    }
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -5,6 +5,7 @@
 #include "GameFramework/Pawn.h"
 #include "TimerManager.h"
 #include "TerritorialManager.h"
+#include "TerritorialInfluenceMapSubsystem.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Engine/Engine.h"
 #include "HAL/PlatformFilemanager.h"
@@ -96,6 +97,12 @@ void ATerritorialExtractionPoint::BeginPlay()
     UE_LOG(LogTemp, Log, TEXT("TerritorialExtractionPoint '%s' initialized for Territory %d"), *ExtractionPointName, TerritoryID);
 }
 
+void ATerritorialExtractionPoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UnregisterInfluenceSource();
+    Super::EndPlay(EndPlayReason);
+}
+
 void ATerritorialExtractionPoint::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
@@ -1074,6 +1081,7 @@ void ATerritorialExtractionPoint::UpdateTerritorialBonuses()
 {
     // Batch update territorial bonuses for performance
     QueryTerritorialManager();
+    RefreshInfluenceSource();
     
     // Update visual elements based on cached territorial state
     if (bTerritorialStateValid)
@@ -1128,6 +1136,46 @@ void ATerritorialExtractionPoint::OnTerritorialControlChanged(int32 ChangedTerri
     }
 }
 
+void ATerritorialExtractionPoint::RefreshInfluenceSource()
+{
+    const EFactionID ControllingFaction = bTerritorialStateValid ? CachedTerritorialController : OwningFaction;
+    if (ControllingFaction == InfluenceSourceFaction && InfluenceSourceHandle != INDEX_NONE)
+    {
+        return;
+    }
+
+    UnregisterInfluenceSource();
+    if (ControllingFaction == EFactionID::None)
+    {
+        return;
+    }
+
+    if (UTerritorialInfluenceMapSubsystem* InfluenceMap = GetWorld()->GetSubsystem<UTerritorialInfluenceMapSubsystem>())
+    {
+        const float Radius = ContestationZone ? ContestationZone->GetScaledSphereRadius() : 800.0f;
+        InfluenceSourceHandle = InfluenceMap->AddActorSource(this, static_cast<int32>(ControllingFaction), InfluenceMapStrength, Radius);
+        InfluenceSourceFaction = ControllingFaction;
+    }
+}
+
+void ATerritorialExtractionPoint::UnregisterInfluenceSource()
+{
+    if (InfluenceSourceHandle == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UTerritorialInfluenceMapSubsystem* InfluenceMap = World->GetSubsystem<UTerritorialInfluenceMapSubsystem>())
+        {
+            InfluenceMap->RemoveSource(InfluenceSourceHandle);
+        }
+    }
+    InfluenceSourceHandle = INDEX_NONE;
+    InfluenceSourceFaction = EFactionID::None;
+}
+
 void ATerritorialExtractionPoint::UpdateTerritorialDisplay()
 {
     // Update UI elements showing territorial control with performance optimization
@@ -0,0 +1,92 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "TerritorialInfluenceMapSubsystem.h"
+#include "TGTestWorld.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTerritorialInfluenceMapBenchmarkTest, "TerminalGrounds.Territorial.InfluenceMap.Update256x256", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTerritorialInfluenceMapBenchmarkTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 Resolution = 256;
+    constexpr int32 BudgetFactions = 8;
+    constexpr double BudgetMs = 0.5;
+    constexpr int32 SourcesPerFaction = 12;
+    constexpr int32 MovesPerStep = 24;
+    constexpr int32 WarmupSteps = 50;
+    constexpr int32 NumSteps = 300;
+    constexpr float WorldExtent = 50000.0f;
+
+    FTGScopedTestWorld TestWorld(TEXT("TGInfluenceMapBenchmark"));
+    UWorld* World = TestWorld.Get();
+
+    UTerritorialInfluenceMapSubsystem* InfluenceMap = World->GetSubsystem<UTerritorialInfluenceMapSubsystem>();
+    TestNotNull(TEXT("Influence map subsystem exists in game worlds"), InfluenceMap);
+    if (!InfluenceMap)
+    {
+        return false;
+    }
+
+    InfluenceMap->ConfigureGrid(FBox2D(FVector2D(-WorldExtent), FVector2D(WorldExtent)), Resolution);
+    InfluenceMap->UpdateInterval = 0.0f;
+
+    // Squads of players per faction plus their control structures, scattered over the map
+    FRandomStream Random(3838);
+    TArray<int32> Handles;
+    TArray<FVector> Locations;
+    for (int32 FactionID = 1; FactionID <= TERRITORIAL_MAX_FACTIONS; FactionID++)
+    {
+        for (int32 i = 0; i < SourcesPerFaction; i++)
+        {
+            const FVector Location(Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-WorldExtent, WorldExtent), 0.0f);
+            Handles.Add(InfluenceMap->AddSource(FactionID, Location, Random.FRandRange(20.0f, 60.0f), Random.FRandRange(1000.0f, 4000.0f)));
+            Locations.Add(Location);
+        }
+    }
+
+    // Each step some sources walk a few cells, the rest of the map keeps settling
+    auto Step = [&]()
+    {
+        for (int32 Move = 0; Move < MovesPerStep; Move++)
+        {
+            const int32 Index = Random.RandRange(0, Handles.Num() - 1);
+            Locations[Index] += FVector(Random.FRandRange(-1500.0f, 1500.0f), Random.FRandRange(-1500.0f, 1500.0f), 0.0f);
+            Locations[Index] = Locations[Index].BoundToBox(FVector(-WorldExtent), FVector(WorldExtent));
+            InfluenceMap->MoveSource(Handles[Index], Locations[Index]);
+        }
+        InfluenceMap->Tick(0.1f);
+    };
+
+    for (int32 i = 0; i < WarmupSteps; i++)
+    {
+        Step();
+    }
+
+    double TotalSeconds = 0.0;
+    double WorstSeconds = 0.0;
+    int64 ActiveCells = 0;
+    for (int32 i = 0; i < NumSteps; i++)
+    {
+        const double Start = FPlatformTime::Seconds();
+        Step();
+        const double Seconds = FPlatformTime::Seconds() - Start;
+        TotalSeconds += Seconds;
+        WorstSeconds = FMath::Max(WorstSeconds, Seconds);
+        ActiveCells += InfluenceMap->GetLastActiveCellCount();
+    }
+
+    // The grid keeps TERRITORIAL_MAX_FACTIONS layers; scale to the budgeted faction count
+    const double AverageMs = TotalSeconds * 1000.0 / NumSteps;
+    const double ScaledMs = AverageMs * BudgetFactions / TERRITORIAL_MAX_FACTIONS;
+    TestTrue(FString::Printf(TEXT("Average update %.3f ms (scaled to %d factions) is within the %.1f ms budget"), ScaledMs, BudgetFactions, BudgetMs), ScaledMs <= BudgetMs);
+
+    AddInfo(FString::Printf(TEXT("%dx%d grid, %d layers, %d sources, %d moves/step: %.3f ms/update average (%.3f ms for %d factions), %.3f ms worst, %.0f active cells/update"),
+        Resolution, Resolution, TERRITORIAL_MAX_FACTIONS, Handles.Num(), MovesPerStep,
+        AverageMs, ScaledMs, BudgetFactions, WorstSeconds * 1000.0, double(ActiveCells) / NumSteps));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,55 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "TerritorialInfluenceMapSubsystem.h"
+#include "TGCore/Public/TGPlayPawn.h"
+#include "TGCore/Public/TGTestWorld.h"
+#include "Engine/World.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTerritorialInfluenceMapPawnTest, "TerminalGrounds.Territorial.InfluenceMap.PlayerPawnInfluence", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTerritorialInfluenceMapPawnTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 FactionID = 2;
+    constexpr float WorldExtent = 10000.0f;
+
+    FTGScopedTestWorld TestWorld(TEXT("TGInfluenceMapPawnTest"));
+    UWorld* World = TestWorld.Get();
+
+    UTerritorialInfluenceMapSubsystem* InfluenceMap = World->GetSubsystem<UTerritorialInfluenceMapSubsystem>();
+    TestNotNull(TEXT("Influence map subsystem exists in game worlds"), InfluenceMap);
+    if (!InfluenceMap)
+    {
+        return false;
+    }
+
+    InfluenceMap->ConfigureGrid(FBox2D(FVector2D(-WorldExtent), FVector2D(WorldExtent)), 64);
+    InfluenceMap->UpdateInterval = 0.0f;
+
+    // Begin play installs the spawn hook that registers pawns
+    TestWorld.BeginPlay();
+
+    const FVector Location(1000.0f, -2000.0f, 0.0f);
+    ATGPlayPawn* Pawn = World->SpawnActor<ATGPlayPawn>(ATGPlayPawn::StaticClass(), FTransform(Location));
+    TestNotNull(TEXT("Player pawn spawns"), Pawn);
+    if (Pawn)
+    {
+        InfluenceMap->Tick(0.1f);
+        TestTrue(TEXT("A pawn without a faction adds no influence"), FMath::IsNearlyZero(InfluenceMap->GetInfluenceAt(FactionID, Location)));
+
+        // Joining a faction re-registers the already spawned pawn under it
+        Pawn->SetFactionID(FactionID);
+        for (int32 Step = 0; Step < 5; Step++)
+        {
+            InfluenceMap->Tick(0.1f);
+        }
+        TestTrue(TEXT("The player pawn projects influence for its faction"), InfluenceMap->GetInfluenceAt(FactionID, Location) > 0.0f);
+
+        float DominantInfluence = 0.0f;
+        TestEqual(TEXT("The pawn's faction dominates where it stands"), InfluenceMap->GetDominantFactionAt(Location, DominantInfluence), FactionID);
+    }
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,615 @@
+// Copyright Terminal Grounds. All Rights Reserved.
+
+#include "TerritorialInfluenceMapSubsystem.h"
+#include "AITerritorialBehavior.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Controller.h"
+#include "GenericTeamAgentInterface.h"
+#include "TGCore/Public/TGCharacter.h"
+#include "EngineUtils.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+DECLARE_CYCLE_STAT(TEXT("TG Influence Map - Propagate"), STAT_TGInfluenceMapPropagate, STATGROUP_Game);
+
+void UTerritorialInfluenceMapSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    ConfigureGrid(GridBounds, Resolution);
+}
+
+void UTerritorialInfluenceMapSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    }
+    ActorSpawnedHandle.Reset();
+    PawnSources.Empty();
+    Sources.Empty();
+    Layers.Empty();
+    ZeroRow.Empty();
+    Super::Deinitialize();
+}
+
+bool UTerritorialInfluenceMapSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTerritorialInfluenceMapSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    for (TActorIterator<APawn> It(&InWorld); It; ++It)
+    {
+        RegisterPawn(*It);
+    }
+    ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UTerritorialInfluenceMapSubsystem::HandleActorSpawned));
+}
+
+void UTerritorialInfluenceMapSubsystem::HandleActorSpawned(AActor* Actor)
+{
+    if (APawn* Pawn = Cast<APawn>(Actor))
+    {
+        RegisterPawn(Pawn);
+    }
+}
+
+void UTerritorialInfluenceMapSubsystem::RegisterPawn(APawn* Pawn)
+{
+    if (!Pawn)
+    {
+        return;
+    }
+
+    // Freshly spawned pawns are usually not possessed yet; possession re-resolves the faction
+    Pawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(this, &UTerritorialInfluenceMapSubsystem::HandlePawnControllerChanged);
+    Pawn->OnEndPlay.AddUniqueDynamic(this, &UTerritorialInfluenceMapSubsystem::HandlePawnEndPlay);
+    if (ATGCharacter* Character = Cast<ATGCharacter>(Pawn))
+    {
+        Character->OnFactionChanged.AddUniqueDynamic(this, &UTerritorialInfluenceMapSubsystem::HandleCharacterFactionChanged);
+    }
+    RefreshPawnSource(Pawn);
+}
+
+void UTerritorialInfluenceMapSubsystem::RefreshPawnSource(APawn* Pawn)
+{
+    const int32 FactionID = ResolvePawnFaction(Pawn);
+    if (const int32* Existing = PawnSources.Find(Pawn))
+    {
+        const FInfluenceSource* Source = Sources.Find(*Existing);
+        if (Source && Source->FactionID == FactionID)
+        {
+            return;
+        }
+        RemoveSource(*Existing);
+        PawnSources.Remove(Pawn);
+    }
+
+    const int32 Handle = AddActorSource(Pawn, FactionID, PawnInfluenceStrength, PawnInfluenceRadius);
+    if (Handle != INDEX_NONE)
+    {
+        PawnSources.Add(Pawn, Handle);
+    }
+}
+
+void UTerritorialInfluenceMapSubsystem::HandlePawnControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+    RefreshPawnSource(Pawn);
+}
+
+void UTerritorialInfluenceMapSubsystem::HandlePawnEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    int32 Handle = INDEX_NONE;
+    if (PawnSources.RemoveAndCopyValue(Cast<APawn>(Actor), Handle))
+    {
+        RemoveSource(Handle);
+    }
+}
+
+void UTerritorialInfluenceMapSubsystem::HandleCharacterFactionChanged(ATGCharacter* Character)
+{
+    RefreshPawnSource(Character);
+}
+
+int32 UTerritorialInfluenceMapSubsystem::ResolvePawnFaction(const APawn* Pawn)
+{
+    // Players and grunts carry their faction on the character
+    if (const ATGCharacter* Character = Cast<const ATGCharacter>(Pawn))
+    {
+        const int32 FactionID = Character->GetFactionID();
+        return (FactionID >= 1 && FactionID <= TERRITORIAL_MAX_FACTIONS) ? FactionID : 0;
+    }
+
+    const IGenericTeamAgentInterface* TeamAgent = Cast<const IGenericTeamAgentInterface>(Pawn);
+    if (!TeamAgent && Pawn)
+    {
+        TeamAgent = Cast<const IGenericTeamAgentInterface>(Pawn->GetController());
+    }
+    if (!TeamAgent)
+    {
+        return 0;
+    }
+
+    const int32 TeamId = TeamAgent->GetGenericTeamId().GetId();
+    return (TeamId >= 1 && TeamId <= TERRITORIAL_MAX_FACTIONS) ? TeamId : 0;
+}
+
+void UTerritorialInfluenceMapSubsystem::ConfigureGrid(const FBox2D& WorldBounds, int32 InResolution)
+{
+    GridBounds = WorldBounds;
+    Resolution = FMath::Clamp(InResolution, 8, 1024);
+
+    // Square cells; the grid covers the larger extent from the bounds' min corner
+    const FVector2D Extent = GridBounds.GetSize();
+    CellSize = FMath::Max(FMath::Max(Extent.X, Extent.Y) / Resolution, 1.0f);
+
+    const int32 NumCells = Resolution * Resolution;
+    Layers.SetNum(TERRITORIAL_MAX_FACTIONS);
+    for (FInfluenceLayer& Layer : Layers)
+    {
+        Layer.Values.Reset();
+        Layer.Values.SetNumZeroed(NumCells);
+        Layer.Stamp.Reset();
+        Layer.Stamp.SetNumZeroed(NumCells);
+        Layer.ScratchA.SetNumZeroed(Resolution + 2);
+        Layer.ScratchB.SetNumZeroed(Resolution + 2);
+        Layer.bActive = false;
+    }
+    ZeroRow.Reset();
+    ZeroRow.SetNumZeroed(Resolution);
+    ++Revision;
+
+    for (const auto& SourcePair : Sources)
+    {
+        RestampRect(SourcePair.Value.FactionID, GetSourceRect(SourcePair.Value));
+    }
+}
+
+int32 UTerritorialInfluenceMapSubsystem::AddSource(int32 FactionID, const FVector& Location, float Strength, float Radius)
+{
+    if (FactionID < 1 || FactionID > TERRITORIAL_MAX_FACTIONS)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Handle = NextSourceHandle++;
+    FInfluenceSource& Source = Sources.Add(Handle);
+    Source.FactionID = FactionID;
+    Source.Location = FVector2D(Location);
+    Source.Strength = FMath::Max(0.0f, Strength);
+    Source.Radius = FMath::Max(0.0f, Radius);
+
+    RestampRect(FactionID, GetSourceRect(Source));
+    return Handle;
+}
+
+int32 UTerritorialInfluenceMapSubsystem::AddActorSource(AActor* Actor, int32 FactionID, float Strength, float Radius)
+{
+    if (!Actor)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Handle = AddSource(FactionID, Actor->GetActorLocation(), Strength, Radius);
+    if (FInfluenceSource* Source = Sources.Find(Handle))
+    {
+        Source->TrackedActor = Actor;
+    }
+    return Handle;
+}
+
+void UTerritorialInfluenceMapSubsystem::MoveSource(int32 SourceHandle, const FVector& NewLocation)
+{
+    FInfluenceSource* Source = Sources.Find(SourceHandle);
+    if (!Source)
+    {
+        return;
+    }
+
+    const FIntRect OldRect = GetSourceRect(*Source);
+    Source->Location = FVector2D(NewLocation);
+    const FIntRect NewRect = GetSourceRect(*Source);
+
+    RestampRect(Source->FactionID, OldRect);
+    RestampRect(Source->FactionID, NewRect);
+}
+
+void UTerritorialInfluenceMapSubsystem::SetSourceStrength(int32 SourceHandle, float Strength)
+{
+    if (FInfluenceSource* Source = Sources.Find(SourceHandle))
+    {
+        Source->Strength = FMath::Max(0.0f, Strength);
+        RestampRect(Source->FactionID, GetSourceRect(*Source));
+    }
+}
+
+void UTerritorialInfluenceMapSubsystem::RemoveSource(int32 SourceHandle)
+{
+    FInfluenceSource Removed;
+    if (Sources.RemoveAndCopyValue(SourceHandle, Removed))
+    {
+        RestampRect(Removed.FactionID, GetSourceRect(Removed));
+    }
+}
+
+void UTerritorialInfluenceMapSubsystem::Tick(float DeltaTime)
+{
+    TimeAccumulator += DeltaTime;
+    if (TimeAccumulator < UpdateInterval)
+    {
+        return;
+    }
+    // One step per tick; a hitch slows the spread rather than spiking the frame
+    TimeAccumulator = 0.0f;
+
+    SCOPE_CYCLE_COUNTER(STAT_TGInfluenceMapPropagate);
+    const double StartTime = FPlatformTime::Seconds();
+
+    RefreshTrackedSources();
+
+    LastActiveCells = 0;
+    for (const FInfluenceLayer& Layer : Layers)
+    {
+        LastActiveCells += Layer.bActive ? Layer.ActiveRect.Area() : 0;
+    }
+
+    if (LastActiveCells > 0)
+    {
+        ParallelFor(Layers.Num(), [this](int32 LayerIndex)
+        {
+            PropagateLayer(Layers[LayerIndex]);
+        });
+        ++Revision;
+    }
+
+    LastUpdateTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+void UTerritorialInfluenceMapSubsystem::RefreshTrackedSources()
+{
+    const float MoveThresholdSq = FMath::Square(CellSize * 0.5f);
+
+    TArray<int32, TInlineAllocator<8>> Expired;
+    TArray<TPair<int32, FVector>, TInlineAllocator<16>> Moved;
+    for (const auto& SourcePair : Sources)
+    {
+        const FInfluenceSource& Source = SourcePair.Value;
+        if (Source.TrackedActor.IsExplicitlyNull())
+        {
+            continue;
+        }
+
+        const AActor* Actor = Source.TrackedActor.Get();
+        if (!Actor)
+        {
+            Expired.Add(SourcePair.Key);
+            continue;
+        }
+
+        const FVector Location = Actor->GetActorLocation();
+        if (FVector2D::DistSquared(FVector2D(Location), Source.Location) > MoveThresholdSq)
+        {
+            Moved.Emplace(SourcePair.Key, Location);
+        }
+    }
+
+    for (const int32 Handle : Expired)
+    {
+        RemoveSource(Handle);
+    }
+    for (const TPair<int32, FVector>& Move : Moved)
+    {
+        MoveSource(Move.Key, Move.Value);
+    }
+}
+
+FIntRect UTerritorialInfluenceMapSubsystem::GetSourceRect(const FInfluenceSource& Source) const
+{
+    const FVector2D Min = (Source.Location - FVector2D(Source.Radius) - GridBounds.Min) / CellSize;
+    const FVector2D Max = (Source.Location + FVector2D(Source.Radius) - GridBounds.Min) / CellSize;
+    return FIntRect(
+        FMath::Clamp(FMath::FloorToInt(Min.X), 0, Resolution),
+        FMath::Clamp(FMath::FloorToInt(Min.Y), 0, Resolution),
+        FMath::Clamp(FMath::FloorToInt(Max.X) + 1, 0, Resolution),
+        FMath::Clamp(FMath::FloorToInt(Max.Y) + 1, 0, Resolution));
+}
+
+void UTerritorialInfluenceMapSubsystem::RestampRect(int32 FactionID, const FIntRect& Rect)
+{
+    if (FactionID < 1 || FactionID > Layers.Num() || Rect.Area() <= 0)
+    {
+        return;
+    }
+
+    FInfluenceLayer& Layer = Layers[FactionID - 1];
+    float* Stamp = Layer.Stamp.GetData();
+
+    for (int32 Y = Rect.Min.Y; Y < Rect.Max.Y; ++Y)
+    {
+        FMemory::Memzero(Stamp + Y * Resolution + Rect.Min.X, Rect.Width() * sizeof(float));
+    }
+
+    // Overlapping sources of the same faction combine by max, so restamping a rect needs every source touching it
+    for (const auto& SourcePair : Sources)
+    {
+        const FInfluenceSource& Source = SourcePair.Value;
+        if (Source.FactionID != FactionID || Source.Radius <= 0.0f || Source.Strength <= 0.0f)
+        {
+            continue;
+        }
+
+        FIntRect Overlap = GetSourceRect(Source);
+        Overlap.Clip(Rect);
+        if (Overlap.Area() <= 0)
+        {
+            continue;
+        }
+
+        const float InvRadius = 1.0f / Source.Radius;
+        for (int32 Y = Overlap.Min.Y; Y < Overlap.Max.Y; ++Y)
+        {
+            const float CellY = GridBounds.Min.Y + (Y + 0.5f) * CellSize - Source.Location.Y;
+            float* StampRow = Stamp + Y * Resolution;
+            for (int32 X = Overlap.Min.X; X < Overlap.Max.X; ++X)
+            {
+                const float CellX = GridBounds.Min.X + (X + 0.5f) * CellSize - Source.Location.X;
+                const float Falloff = 1.0f - FMath::Sqrt(CellX * CellX + CellY * CellY) * InvRadius;
+                if (Falloff > 0.0f)
+                {
+                    StampRow[X] = FMath::Max(StampRow[X], Source.Strength * Falloff);
+                }
+            }
+        }
+    }
+
+    if (Layer.bActive)
+    {
+        Layer.ActiveRect.Union(Rect);
+    }
+    else
+    {
+        Layer.ActiveRect = Rect;
+        Layer.bActive = true;
+    }
+}
+
+void UTerritorialInfluenceMapSubsystem::PropagateLayer(FInfluenceLayer& Layer) const
+{
+    if (!Layer.bActive)
+    {
+        return;
+    }
+
+    const int32 N = Resolution;
+
+    // Cells next to last step's changes see new neighbour values this step
+    const int32 X0 = FMath::Max(0, Layer.ActiveRect.Min.X - 1);
+    const int32 X1 = FMath::Min(N, Layer.ActiveRect.Max.X + 1);
+    const int32 Y0 = FMath::Max(0, Layer.ActiveRect.Min.Y - 1);
+    const int32 Y1 = FMath::Min(N, Layer.ActiveRect.Max.Y + 1);
+    const int32 Width = X1 - X0;
+
+    float* Values = Layer.Values.GetData();
+    const float* Stamp = Layer.Stamp.GetData();
+    const float* Zero = ZeroRow.GetData();
+
+    // Rows are updated in place; the pre-update copy of the current row (with one cell of
+    // padding each side) and of the row above stand in for a second full-size buffer
+    float* Prev = Layer.ScratchA.GetData();
+    float* Cur = Layer.ScratchB.GetData();
+
+    const VectorRegister4Float DecayV = VectorSetFloat1(PropagationDecay);
+    const VectorRegister4Float MomentumV = VectorSetFloat1(Momentum);
+    const VectorRegister4Float SettleV = VectorSetFloat1(SettleThreshold);
+
+    int32 ChangedMinX = N;
+    int32 ChangedMaxX = -1;
+    int32 ChangedMinY = N;
+    int32 ChangedMaxY = -1;
+
+    for (int32 Y = Y0; Y < Y1; ++Y)
+    {
+        float* Row = Values + Y * N;
+        const float* Up = (Y == Y0) ? (Y > 0 ? Values + (Y - 1) * N + X0 : Zero) : Prev + 1;
+        const float* Down = (Y + 1 < N) ? Values + (Y + 1) * N + X0 : Zero;
+        const float* StampRow = Stamp + Y * N + X0;
+
+        Cur[0] = X0 > 0 ? Row[X0 - 1] : 0.0f;
+        FMemory::Memcpy(Cur + 1, Row + X0, Width * sizeof(float));
+        Cur[Width + 1] = X1 < N ? Row[X1] : 0.0f;
+
+        const float* Left = Cur;
+        const float* Self = Cur + 1;
+        const float* Right = Cur + 2;
+        float* Out = Row + X0;
+
+        int32 RowMin = -1;
+        int32 RowMax = -1;
+
+        int32 X = 0;
+        for (; X + 4 <= Width; X += 4)
+        {
+            const VectorRegister4Float Old = VectorLoad(Self + X);
+            const VectorRegister4Float Neighbours = VectorMax(
+                VectorMax(VectorLoad(Left + X), VectorLoad(Right + X)),
+                VectorMax(VectorLoad(Up + X), VectorLoad(Down + X)));
+            const VectorRegister4Float Target = VectorMax(VectorLoad(StampRow + X), VectorMultiply(Neighbours, DecayV));
+            const VectorRegister4Float Delta = VectorSubtract(Target, Old);
+            const VectorRegister4Float New = VectorMultiplyAdd(Delta, MomentumV, Old);
+            VectorStore(New, Out + X);
+
+            if (VectorMaskBits(VectorCompareGT(VectorAbs(VectorSubtract(New, Old)), SettleV)))
+            {
+                RowMin = RowMin < 0 ? X : RowMin;
+                RowMax = X + 3;
+            }
+        }
+        for (; X < Width; ++X)
+        {
+            const float Old = Self[X];
+            const float Neighbours = FMath::Max(FMath::Max(Left[X], Right[X]), FMath::Max(Up[X], Down[X]));
+            const float Target = FMath::Max(StampRow[X], Neighbours * PropagationDecay);
+            const float New = Old + (Target - Old) * Momentum;
+            Out[X] = New;
+
+            if (FMath::Abs(New - Old) > SettleThreshold)
+            {
+                RowMin = RowMin < 0 ? X : RowMin;
+                RowMax = X;
+            }
+        }
+
+        if (RowMax >= 0)
+        {
+            ChangedMinX = FMath::Min(ChangedMinX, X0 + RowMin);
+            ChangedMaxX = FMath::Max(ChangedMaxX, X0 + RowMax);
+            ChangedMinY = FMath::Min(ChangedMinY, Y);
+            ChangedMaxY = Y;
+        }
+
+        Swap(Prev, Cur);
+    }
+
+    Layer.bActive = ChangedMaxY >= 0;
+    if (Layer.bActive)
+    {
+        Layer.ActiveRect = FIntRect(ChangedMinX, ChangedMinY, ChangedMaxX + 1, ChangedMaxY + 1);
+    }
+}
+
+float UTerritorialInfluenceMapSubsystem::SampleLayer(const FInfluenceLayer& Layer, const FVector2D& Location) const
+{
+    const FVector2D Grid = (Location - GridBounds.Min) / CellSize - FVector2D(0.5f);
+    const int32 GX = FMath::FloorToInt(Grid.X);
+    const int32 GY = FMath::FloorToInt(Grid.Y);
+    const float FX = Grid.X - GX;
+    const float FY = Grid.Y - GY;
+
+    const int32 X0 = FMath::Clamp(GX, 0, Resolution - 1);
+    const int32 X1 = FMath::Clamp(GX + 1, 0, Resolution - 1);
+    const int32 Y0 = FMath::Clamp(GY, 0, Resolution - 1);
+    const int32 Y1 = FMath::Clamp(GY + 1, 0, Resolution - 1);
+
+    const float* Values = Layer.Values.GetData();
+    const float Top = FMath::Lerp(Values[Y0 * Resolution + X0], Values[Y0 * Resolution + X1], FX);
+    const float Bottom = FMath::Lerp(Values[Y1 * Resolution + X0], Values[Y1 * Resolution + X1], FX);
+    return FMath::Lerp(Top, Bottom, FY);
+}
+
+float UTerritorialInfluenceMapSubsystem::GetInfluenceAt(int32 FactionID, const FVector& Location) const
+{
+    if (FactionID < 1 || FactionID > Layers.Num())
+    {
+        return 0.0f;
+    }
+    return SampleLayer(Layers[FactionID - 1], FVector2D(Location));
+}
+
+int32 UTerritorialInfluenceMapSubsystem::GetDominantFactionAt(const FVector& Location, float& OutInfluence) const
+{
+    int32 DominantFaction = 0;
+    OutInfluence = 0.0f;
+    for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); ++LayerIndex)
+    {
+        const float Influence = SampleLayer(Layers[LayerIndex], FVector2D(Location));
+        if (Influence > OutInfluence)
+        {
+            OutInfluence = Influence;
+            DominantFaction = LayerIndex + 1;
+        }
+    }
+    return DominantFaction;
+}
+
+void UTerritorialInfluenceMapSubsystem::SampleTerritory(const FTerritorialInfo& Territory, FTerritorialInfluenceSample& OutSample) const
+{
+    OutSample.FactionInfluence.Reset();
+    OutSample.FactionInfluence.SetNumZeroed(TERRITORIAL_MAX_FACTIONS + 1);
+
+    FInfluenceSource Area;
+    Area.Location = FVector2D(Territory.WorldPosition);
+    Area.Radius = FMath::Max(Territory.ControlRadius, CellSize * 0.5f);
+    const FIntRect Rect = GetSourceRect(Area);
+    const float RadiusSq = FMath::Square(Area.Radius);
+
+    int32 NumCells = 0;
+    for (int32 Y = Rect.Min.Y; Y < Rect.Max.Y; ++Y)
+    {
+        const float CellY = GridBounds.Min.Y + (Y + 0.5f) * CellSize - Area.Location.Y;
+        for (int32 X = Rect.Min.X; X < Rect.Max.X; ++X)
+        {
+            const float CellX = GridBounds.Min.X + (X + 0.5f) * CellSize - Area.Location.X;
+            if (CellX * CellX + CellY * CellY > RadiusSq)
+            {
+                continue;
+            }
+
+            ++NumCells;
+            for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); ++LayerIndex)
+            {
+                OutSample.FactionInfluence[LayerIndex + 1] += Layers[LayerIndex].Values[Y * Resolution + X];
+            }
+        }
+    }
+
+    if (NumCells == 0)
+    {
+        // Territory smaller than a cell (or off the grid): fall back to a point sample
+        for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); ++LayerIndex)
+        {
+            OutSample.FactionInfluence[LayerIndex + 1] = SampleLayer(Layers[LayerIndex], Area.Location);
+        }
+        return;
+    }
+
+    for (float& Influence : OutSample.FactionInfluence)
+    {
+        Influence /= NumCells;
+    }
+}
+
+void UTerritorialInfluenceMapSubsystem::FillWorldStateInfluence(const TArray<FTerritorialInfo>& Regions, FTerritorialWorldState& WorldState) const
+{
+    WorldState.RegionInfluence.Reset();
+    for (const FTerritorialInfo& Region : Regions)
+    {
+        SampleTerritory(Region, WorldState.RegionInfluence.Add(Region.TerritoryID));
+    }
+}
+
+void UTerritorialInfluenceMapSubsystem::BuildHeatmapPixels(const TMap<int32, FLinearColor>& FactionColors, TArray<FColor>& OutPixels) const
+{
+    const int32 NumCells = Resolution * Resolution;
+    OutPixels.SetNumUninitialized(NumCells);
+
+    TArray<FColor, TInlineAllocator<TERRITORIAL_MAX_FACTIONS>> LayerColors;
+    for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); ++LayerIndex)
+    {
+        const FLinearColor* Color = FactionColors.Find(LayerIndex + 1);
+        LayerColors.Add((Color ? *Color : FLinearColor::White).ToFColor(true));
+    }
+
+    const float InvFullStrength = 1.0f / HeatmapFullStrength;
+    for (int32 Cell = 0; Cell < NumCells; ++Cell)
+    {
+        int32 Dominant = INDEX_NONE;
+        float Strongest = 0.0f;
+        for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); ++LayerIndex)
+        {
+            const float Influence = Layers[LayerIndex].Values[Cell];
+            if (Influence > Strongest)
+            {
+                Strongest = Influence;
+                Dominant = LayerIndex;
+            }
+        }
+
+        FColor Pixel = Dominant != INDEX_NONE ? LayerColors[Dominant] : FColor::Transparent;
+        Pixel.A = static_cast<uint8>(FMath::Clamp(Strongest * InvFullStrength, 0.0f, 1.0f) * 255.0f);
+        OutPixels[Cell] = Pixel;
+    }
+}
@@ -1,7 +1,11 @@
 // Copyright Terminal Grounds. All Rights Reserved.
 
 #include "TerritorialManager.h"
+#include "AITerritorialBehavior.h"
+#include "TerritorialInfluenceMapSubsystem.h"
+#include "Engine/DataTable.h"
 #include "Engine/Engine.h"
+#include "Engine/LevelBounds.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 
@@ -327,12 +331,79 @@ void UTerritorialSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     
+    // The influence map must exist before the territory layout sizes it
+    Collection.InitializeDependency<UTerritorialInfluenceMapSubsystem>();
+
     TerritorialManager = NewObject<UTerritorialManager>(this);
     if (TerritorialManager)
     {
         TerritorialManager->InitializeTerritorialSystem();
         UE_LOG(LogTemp, Log, TEXT("TerritorialSubsystem initialized successfully"));
     }
+
+    AIManager = NewObject<UAITerritorialManager>(this);
+    AIManager->InitializeFactionalAI();
+}
+
+void UTerritorialSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (!TerritorialConfigTable.IsNull())
+    {
+        ConfigureTerritories(TerritorialConfigTable.LoadSynchronous());
+    }
+}
+
+void UTerritorialSubsystem::ConfigureTerritories(const UDataTable* ConfigTable)
+{
+    if (!ConfigTable)
+    {
+        return;
+    }
+
+    TArray<FTerritorialConfigRow*> RowPointers;
+    ConfigTable->GetAllRows<FTerritorialConfigRow>(TEXT("UTerritorialSubsystem::ConfigureTerritories"), RowPointers);
+
+    TArray<FTerritorialConfigRow> ConfigRows;
+    ConfigRows.Reserve(RowPointers.Num());
+    for (const FTerritorialConfigRow* Row : RowPointers)
+    {
+        ConfigRows.Add(*Row);
+    }
+
+    if (AIManager)
+    {
+        AIManager->SetRegionLayout(ConfigRows);
+    }
+
+    // The grid covers the level's actors and every territory's control area
+    UWorld* World = GetWorld();
+    UTerritorialInfluenceMapSubsystem* InfluenceMap = World ? World->GetSubsystem<UTerritorialInfluenceMapSubsystem>() : nullptr;
+    if (!InfluenceMap)
+    {
+        return;
+    }
+
+    FBox2D GridBounds(ForceInit);
+    const FBox LevelBounds = ALevelBounds::CalculateLevelBounds(World->PersistentLevel);
+    if (LevelBounds.IsValid)
+    {
+        GridBounds += FVector2D(LevelBounds.Min);
+        GridBounds += FVector2D(LevelBounds.Max);
+    }
+    for (const FTerritorialConfigRow& Row : ConfigRows)
+    {
+        const FVector2D Center(Row.TerritoryInfo.WorldPosition);
+        const FVector2D Radius(Row.TerritoryInfo.ControlRadius);
+        GridBounds += Center - Radius;
+        GridBounds += Center + Radius;
+    }
+
+    if (GridBounds.bIsValid)
+    {
+        InfluenceMap->ConfigureGrid(GridBounds, InfluenceMap->GetResolution());
+    }
 }
 
 void UTerritorialSubsystem::Deinitialize()
@@ -342,6 +413,7 @@ void UTerritorialSubsystem::Deinitialize()
         TerritorialManager->ShutdownTerritorialSystem();
         TerritorialManager = nullptr;
     }
+    AIManager = nullptr;
     
     Super::Deinitialize();
 }
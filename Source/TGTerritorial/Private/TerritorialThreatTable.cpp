@@ -0,0 +1,89 @@
+// Copyright Terminal Grounds. All Rights Reserved.
+
+#include "TerritorialThreatTable.h"
+#include "TerritorialManager.h"
+
+void FTerritorialScoreHeap::Set(uint64 Key, float Score)
+{
+    TPair<float, uint32>& Slot = Current.FindOrAdd(Key);
+    if (Slot.Value != 0 && Slot.Key == Score)
+    {
+        return;
+    }
+
+    Slot.Key = Score;
+    Slot.Value = NextVersion++;
+    Heap.HeapPush(FEntry{Score, Key, Slot.Value}, FEntryOrder());
+    CompactIfNeeded();
+}
+
+void FTerritorialScoreHeap::Remove(uint64 Key)
+{
+    // The heap entry goes stale and is dropped when it reaches the top
+    Current.Remove(Key);
+    CompactIfNeeded();
+}
+
+void FTerritorialScoreHeap::Reset()
+{
+    Heap.Reset();
+    Current.Reset();
+}
+
+bool FTerritorialScoreHeap::IsLive(const FEntry& Entry) const
+{
+    const TPair<float, uint32>* Slot = Current.Find(Entry.Key);
+    return Slot && Slot->Value == Entry.Version;
+}
+
+void FTerritorialScoreHeap::GetTop(int32 Count, TArray<TPair<uint64, float>>& OutTop)
+{
+    OutTop.Reset();
+
+    TArray<FEntry, TInlineAllocator<16>> Popped;
+    while (OutTop.Num() < Count && Heap.Num() > 0)
+    {
+        FEntry Top;
+        Heap.HeapPop(Top, FEntryOrder(), EAllowShrinking::No);
+        if (IsLive(Top))
+        {
+            OutTop.Emplace(Top.Key, Top.Score);
+            Popped.Add(Top);
+        }
+    }
+
+    // Live entries go back; stale ones popped on the way are gone for good
+    for (const FEntry& Entry : Popped)
+    {
+        Heap.HeapPush(Entry, FEntryOrder());
+    }
+}
+
+void FTerritorialScoreHeap::CompactIfNeeded()
+{
+    // Bound memory when many updates hit keys that never reach the top
+    if (Heap.Num() <= 64 || Heap.Num() <= Current.Num() * 4)
+    {
+        return;
+    }
+
+    Heap.RemoveAll([this](const FEntry& Entry) { return !IsLive(Entry); });
+    Heap.Heapify(FEntryOrder());
+}
+
+void FTrackedTerritoryState::Refresh()
+{
+    // Ascending faction order keeps UTerritorialManager's tie-break (first highest wins)
+    TMap<int32, int32> FactionInfluences;
+    FactionInfluences.Reserve(TERRITORIAL_MAX_FACTIONS);
+    for (int32 FactionID = 1; FactionID <= TERRITORIAL_MAX_FACTIONS; ++FactionID)
+    {
+        if (Influence[FactionID] > 0)
+        {
+            FactionInfluences.Add(FactionID, Influence[FactionID]);
+        }
+    }
+
+    DominantFaction = UTerritorialManager::FindDominantFaction(FactionInfluences);
+    bIsContested = UTerritorialManager::DetermineIfContested(FactionInfluences);
+}
@@ -0,0 +1,74 @@
+// Copyright Terminal Grounds. All Rights Reserved.
+
+#include "TerritorialWarSimCommandlet.h"
+#include "TerritorialWarSimulation.h"
+#include "TGTerritorial.h"
+#include "Misc/Paths.h"
+#include "UObject/UnrealType.h"
+
+UTerritorialWarSimCommandlet::UTerritorialWarSimCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UTerritorialWarSimCommandlet::Main(const FString& Params)
+{
+    int32 Runs = 1000;
+    int32 BaseSeed = 1;
+    FString Output = FPaths::ProjectSavedDir() / TEXT("WarSim") / TEXT("warsim");
+    FParse::Value(*Params, TEXT("Runs="), Runs);
+    FParse::Value(*Params, TEXT("Seed="), BaseSeed);
+    FParse::Value(*Params, TEXT("Output="), Output);
+
+    // Any config property can be swept by name, e.g. -ConvoyBaseSuccess=0.6
+    FTerritorialWarSimConfig Config;
+    for (TFieldIterator<FProperty> It(FTerritorialWarSimConfig::StaticStruct()); It; ++It)
+    {
+        FString Value;
+        if (FParse::Value(*Params, *(It->GetName() + TEXT("=")), Value))
+        {
+            if (!It->ImportText_InContainer(*Value, &Config, nullptr, PPF_None))
+            {
+                UE_LOG(LogTGTerritorial, Error, TEXT("War sim: invalid value '%s' for %s"), *Value, *It->GetName());
+                return 1;
+            }
+        }
+    }
+
+    const FTerritorialWarSimulator Simulator(Config);
+
+    TArray<FTerritorialWarSimResult> Results;
+    FTerritorialWarSimSummary Summary;
+    Simulator.RunBatch(BaseSeed, Runs, Results, Summary);
+
+    if (FParse::Param(*Params, TEXT("VerifyDeterminism")) && Results.Num() > 0)
+    {
+        if (!(Simulator.RunSingle(Results[0].Seed) == Results[0]))
+        {
+            UE_LOG(LogTGTerritorial, Error, TEXT("War sim: seed %d did not reproduce"), Results[0].Seed);
+            return 1;
+        }
+    }
+
+    UE_LOG(LogTGTerritorial, Display, TEXT("War sim: %d runs, %.0f simulated hours in %.2fs (%.0f hours/min), %d stalemates"),
+        Summary.Runs, Summary.TotalSimulatedHours, Summary.WallSeconds,
+        Summary.WallSeconds > 0.0 ? Summary.TotalSimulatedHours * 60.0 / Summary.WallSeconds : 0.0, Summary.Stalemates);
+    for (int32 Index = 0; Index < Summary.FactionIDs.Num(); ++Index)
+    {
+        UE_LOG(LogTGTerritorial, Display, TEXT("  Faction %d: %d wins, %.2f regions held, %.0f%% convoys delivered"),
+            Summary.FactionIDs[Index], Summary.Wins[Index], Summary.MeanRegionsHeld[Index], Summary.ConvoySuccessRate[Index] * 100.0f);
+    }
+
+    const bool bWritten = FTerritorialWarSimulator::WriteResultsCsv(Output + TEXT(".csv"), Results)
+        && FTerritorialWarSimulator::WriteSummaryJson(Output + TEXT(".json"), Summary, Simulator.GetConfig());
+    if (!bWritten)
+    {
+        UE_LOG(LogTGTerritorial, Error, TEXT("War sim: failed to write results to %s"), *Output);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,491 @@
+// Copyright Terminal Grounds. All Rights Reserved.
+
+#include "TerritorialWarSimulation.h"
+#include "TGTerritorial.h"
+#include "TerritorialManager.h"
+#include "Economy/TGConvoyEconomySubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "JsonObjectConverter.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+// Simultaneous runs per wave; behavior instances are created once per slot and reused between runs
+static constexpr int32 RunsPerWorkerSlot = 4;
+
+bool FTerritorialWarSimResult::operator==(const FTerritorialWarSimResult& Other) const
+{
+    if (Seed != Other.Seed || WinnerFactionID != Other.WinnerFactionID || EndHour != Other.EndHour
+        || ControlChanges != Other.ControlChanges || ContestedRegionHours != Other.ContestedRegionHours
+        || Factions.Num() != Other.Factions.Num())
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < Factions.Num(); ++Index)
+    {
+        const FTerritorialWarSimFactionResult& A = Factions[Index];
+        const FTerritorialWarSimFactionResult& B = Other.Factions[Index];
+        if (A.FactionID != B.FactionID || A.RegionsHeld != B.RegionsHeld || A.MeanInfluence != B.MeanInfluence
+            || A.SupplyIntegrity != B.SupplyIntegrity || A.ConvoysDelivered != B.ConvoysDelivered
+            || A.ConvoysLost != B.ConvoysLost || A.Decisions != B.Decisions)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FTerritorialWarSimulator::FTerritorialWarSimulator(const FTerritorialWarSimConfig& InConfig)
+    : Config(InConfig)
+{
+    if (Config.Factions.Num() == 0)
+    {
+        for (UClass* BehaviorClass : { UDirectorateAI::StaticClass(), UFree77AI::StaticClass(), UNomadClansAI::StaticClass() })
+        {
+            FTerritorialWarSimFaction Faction;
+            Faction.BehaviorClass = BehaviorClass;
+            Config.Factions.Add(Faction);
+        }
+    }
+
+    Config.NumRegions = FMath::Max(2, Config.NumRegions);
+    Config.InitialInfluenceMax = FMath::Clamp(Config.InitialInfluenceMax, 0, 100);
+    Config.InitialInfluenceMin = FMath::Clamp(Config.InitialInfluenceMin, 0, Config.InitialInfluenceMax);
+    Config.StepMinutes = FMath::Max(1.0f, Config.StepMinutes);
+}
+
+TArray<UAITerritorialBehavior*> FTerritorialWarSimulator::CreateBehaviors() const
+{
+    TArray<UAITerritorialBehavior*> Behaviors;
+    TSet<int32> UsedFactionIDs;
+
+    for (const FTerritorialWarSimFaction& Faction : Config.Factions)
+    {
+        UClass* BehaviorClass = Faction.BehaviorClass.Get();
+        if (!BehaviorClass || BehaviorClass->HasAnyClassFlags(CLASS_Abstract))
+        {
+            UE_LOG(LogTGTerritorial, Warning, TEXT("War sim: skipping faction with missing or abstract behavior class"));
+            continue;
+        }
+
+        UAITerritorialBehavior* Behavior = NewObject<UAITerritorialBehavior>(GetTransientPackage(), BehaviorClass);
+        if (Behavior->FactionID < 1 || Behavior->FactionID > TERRITORIAL_MAX_FACTIONS || UsedFactionIDs.Contains(Behavior->FactionID))
+        {
+            UE_LOG(LogTGTerritorial, Warning, TEXT("War sim: skipping %s, faction %d is invalid or already simulated"),
+                *BehaviorClass->GetName(), Behavior->FactionID);
+            continue;
+        }
+        UsedFactionIDs.Add(Behavior->FactionID);
+
+        if (Faction.AggressionLevel >= 0.0f)
+        {
+            Behavior->AggressionLevel = Faction.AggressionLevel;
+        }
+        if (Faction.DefensiveBonus >= 0.0f)
+        {
+            Behavior->DefensiveBonus = Faction.DefensiveBonus;
+        }
+        if (Faction.EconomicFocus >= 0.0f)
+        {
+            Behavior->EconomicFocus = Faction.EconomicFocus;
+        }
+
+        Behavior->AddToRoot();
+        Behaviors.Add(Behavior);
+    }
+
+    return Behaviors;
+}
+
+FTerritorialWarSimResult FTerritorialWarSimulator::RunSingle(int32 Seed) const
+{
+    check(IsInGameThread());
+
+    FTerritorialWarSimResult Result;
+    TArray<UAITerritorialBehavior*> Behaviors = CreateBehaviors();
+    SimulateWar(Seed, Behaviors, Result);
+
+    for (UAITerritorialBehavior* Behavior : Behaviors)
+    {
+        Behavior->RemoveFromRoot();
+    }
+    return Result;
+}
+
+void FTerritorialWarSimulator::RunBatch(int32 BaseSeed, int32 NumRuns, TArray<FTerritorialWarSimResult>& OutResults, FTerritorialWarSimSummary& OutSummary) const
+{
+    check(IsInGameThread());
+
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    OutResults.Reset();
+    OutResults.SetNum(FMath::Max(0, NumRuns));
+
+    // Behaviors are UObjects and must be created here; the runs themselves touch no shared state
+    const int32 NumSlots = FMath::Min(FMath::Max(1, NumRuns), (FTaskGraphInterface::Get().GetNumWorkerThreads() + 1) * RunsPerWorkerSlot);
+    TArray<TArray<UAITerritorialBehavior*>> SlotBehaviors;
+    SlotBehaviors.Reserve(NumSlots);
+    for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+    {
+        SlotBehaviors.Add(CreateBehaviors());
+    }
+
+    for (int32 WaveStart = 0; WaveStart < NumRuns; WaveStart += NumSlots)
+    {
+        const int32 WaveCount = FMath::Min(NumSlots, NumRuns - WaveStart);
+        ParallelFor(WaveCount, [this, BaseSeed, WaveStart, &SlotBehaviors, &OutResults](int32 Slot)
+        {
+            const int32 RunIndex = WaveStart + Slot;
+            SimulateWar(BaseSeed + RunIndex, SlotBehaviors[Slot], OutResults[RunIndex]);
+        });
+    }
+
+    for (const TArray<UAITerritorialBehavior*>& Behaviors : SlotBehaviors)
+    {
+        for (UAITerritorialBehavior* Behavior : Behaviors)
+        {
+            Behavior->RemoveFromRoot();
+        }
+    }
+
+    Summarize(OutResults, OutSummary);
+    OutSummary.WallSeconds = FPlatformTime::Seconds() - StartSeconds;
+}
+
+static void RefreshTerritorialState(FTerritorialState& State)
+{
+    State.DominantFaction = UTerritorialManager::FindDominantFaction(State.FactionInfluences);
+    State.bIsContested = UTerritorialManager::DetermineIfContested(State.FactionInfluences);
+}
+
+// Same clamp and control rules as UTerritorialManager::UpdateTerritorialInfluence; returns true on a control change
+static bool ApplySimulatedInfluence(FTerritorialState& State, int32 FactionID, int32 InfluenceChange)
+{
+    if (InfluenceChange == 0)
+    {
+        return false;
+    }
+
+    int32& Influence = State.FactionInfluences.FindOrAdd(FactionID);
+    Influence = FMath::Clamp(Influence + InfluenceChange, 0, 100);
+
+    const int32 OldDominant = State.DominantFaction;
+    RefreshTerritorialState(State);
+    return OldDominant != State.DominantFaction;
+}
+
+void FTerritorialWarSimulator::SimulateWar(int32 Seed, const TArray<UAITerritorialBehavior*>& Behaviors, FTerritorialWarSimResult& OutResult) const
+{
+    FRandomStream Random(Seed);
+    const int32 NumFactions = Behaviors.Num();
+
+    OutResult = FTerritorialWarSimResult();
+    OutResult.Seed = Seed;
+    OutResult.Factions.SetNum(NumFactions);
+
+    // Slot-reused behaviors start every run clean
+    for (int32 Index = 0; Index < NumFactions; ++Index)
+    {
+        Behaviors[Index]->ResetThreatTable();
+        Behaviors[Index]->PendingDecisions.Reset();
+        OutResult.Factions[Index].FactionID = Behaviors[Index]->FactionID;
+    }
+
+    FTerritorialWorldState World;
+    World.TotalInfluenceByFaction.SetNumZeroed(TERRITORIAL_MAX_FACTIONS + 1);
+    World.RegionStates.Reserve(Config.NumRegions);
+    for (int32 RegionID = 1; RegionID <= Config.NumRegions; ++RegionID)
+    {
+        FTerritorialState& State = World.RegionStates.Add(RegionID);
+        State.TerritoryID = RegionID;
+        State.TerritoryType = ETerritoryType::Region;
+        for (const UAITerritorialBehavior* Behavior : Behaviors)
+        {
+            State.FactionInfluences.Add(Behavior->FactionID, Random.RandRange(Config.InitialInfluenceMin, Config.InitialInfluenceMax));
+        }
+        RefreshTerritorialState(State);
+    }
+
+    // Convoy economy state, one supply chain per faction
+    TArray<float> SupplyIntegrity;
+    SupplyIntegrity.Init(Config.IntegrityEquilibrium, NumFactions);
+    TArray<float> VictoryHeldHours;
+    VictoryHeldHours.Init(0.0f, NumFactions);
+    TArray<int32> RegionsHeld;
+    RegionsHeld.SetNumZeroed(NumFactions);
+    TArray<int32> HeldRegionIDs;
+
+    const float StepHours = Config.StepMinutes / 60.0f;
+    const int32 TotalSteps = FMath::CeilToInt(Config.SimulatedHours / StepHours);
+    const int32 DecisionEvery = FMath::Max(1, FMath::RoundToInt(Config.DecisionIntervalMinutes / Config.StepMinutes));
+    const int32 ConvoyEvery = FMath::Max(1, FMath::RoundToInt(Config.ConvoyIntervalMinutes / Config.StepMinutes));
+    const int32 StepsPerHour = FMath::Max(1, FMath::RoundToInt(60.0f / Config.StepMinutes));
+    const int32 VictoryRegions = FMath::Max(1, FMath::CeilToInt(Config.VictoryRegionShare * Config.NumRegions));
+
+    TArray<FTerritorialFactionEvaluation> Evaluations;
+    Evaluations.SetNum(NumFactions);
+
+    int32 Step = 0;
+    while (Step < TotalSteps && OutResult.WinnerFactionID == 0)
+    {
+        ++Step;
+
+        // Faction AI: every faction decides against the same state, then decisions resolve in faction order
+        if (Step % DecisionEvery == 0)
+        {
+            for (int32 Index = 0; Index < NumFactions; ++Index)
+            {
+                Behaviors[Index]->EvaluateWorldSnapshot(World, Evaluations[Index]);
+                Behaviors[Index]->ApplyEvaluation(MoveTemp(Evaluations[Index]));
+            }
+
+            for (int32 Index = 0; Index < NumFactions; ++Index)
+            {
+                UAITerritorialBehavior* Behavior = Behaviors[Index];
+                for (const FTerritorialDecision& Decision : Behavior->PendingDecisions)
+                {
+                    FTerritorialState* Target = World.RegionStates.Find(Decision.TargetTerritoryID);
+                    if (!Target)
+                    {
+                        continue;
+                    }
+                    OutResult.Factions[Index].Decisions++;
+
+                    // Supply integrity scales what a commitment achieves on the ground
+                    const float SupplyScale = 0.5f + SupplyIntegrity[Index];
+                    if (Decision.DecisionType == TEXT("defensive"))
+                    {
+                        const int32 Gain = FMath::RoundToInt(Decision.ResourcesCommitted * Config.DefenseEfficiency * Behavior->DefensiveBonus * SupplyScale);
+                        OutResult.ControlChanges += ApplySimulatedInfluence(*Target, Behavior->FactionID, Gain) ? 1 : 0;
+                    }
+                    else if (Decision.DecisionType == TEXT("expansion"))
+                    {
+                        const int32 Gain = FMath::RoundToInt(Decision.ResourcesCommitted * Config.ExpansionEfficiency * SupplyScale);
+                        const int32 Defender = Target->DominantFaction;
+                        OutResult.ControlChanges += ApplySimulatedInfluence(*Target, Behavior->FactionID, Gain) ? 1 : 0;
+                        if (Defender != 0 && Defender != Behavior->FactionID)
+                        {
+                            const int32 Loss = FMath::RoundToInt(Gain * Config.ExpansionDisplacement);
+                            OutResult.ControlChanges += ApplySimulatedInfluence(*Target, Defender, -Loss) ? 1 : 0;
+                        }
+                    }
+                }
+                Behavior->PendingDecisions.Reset();
+            }
+        }
+
+        // Convoys: each faction runs supplies from a held region to any region, raided by its most aggressive rival
+        if (Step % ConvoyEvery == 0)
+        {
+            for (int32 Index = 0; Index < NumFactions; ++Index)
+            {
+                const UAITerritorialBehavior* Behavior = Behaviors[Index];
+                HeldRegionIDs.Reset();
+                for (const auto& RegionPair : World.RegionStates)
+                {
+                    if (RegionPair.Value.DominantFaction == Behavior->FactionID)
+                    {
+                        HeldRegionIDs.Add(RegionPair.Key);
+                    }
+                }
+                if (HeldRegionIDs.Num() == 0)
+                {
+                    continue;
+                }
+
+                const int32 SourceID = HeldRegionIDs[Random.RandHelper(HeldRegionIDs.Num())];
+                const int32 DestinationID = Random.RandRange(1, Config.NumRegions);
+
+                float Security = 0.0f;
+                for (const int32 RegionID : { SourceID, DestinationID })
+                {
+                    const FTerritorialState& State = World.RegionStates.FindChecked(RegionID);
+                    Security += State.bIsContested ? 0.25f : (State.DominantFaction == Behavior->FactionID ? 1.0f : 0.5f);
+                }
+                Security *= 0.5f;
+
+                float RaidPressure = 0.0f;
+                for (const UAITerritorialBehavior* Rival : Behaviors)
+                {
+                    if (Rival != Behavior)
+                    {
+                        RaidPressure = FMath::Max(RaidPressure, Rival->AggressionLevel);
+                    }
+                }
+
+                const float SuccessChance = Config.ConvoyBaseSuccess * (0.5f + 0.5f * Security) * (1.0f - 0.25f * RaidPressure);
+                const bool bDelivered = Random.FRand() < SuccessChance;
+
+                SupplyIntegrity[Index] = UTGConvoyEconomySubsystem::ApplyConvoyOutcomeToIntegrity(SupplyIntegrity[Index], Config.ConvoyIntegrityDelta, bDelivered);
+
+                if (bDelivered)
+                {
+                    OutResult.Factions[Index].ConvoysDelivered++;
+                    const int32 Reward = FMath::RoundToInt(Config.ConvoyInfluenceReward * (0.5f + Behavior->EconomicFocus));
+                    OutResult.ControlChanges += ApplySimulatedInfluence(World.RegionStates.FindChecked(DestinationID), Behavior->FactionID, Reward) ? 1 : 0;
+                }
+                else
+                {
+                    OutResult.Factions[Index].ConvoysLost++;
+                }
+            }
+        }
+
+        // Same relaxation towards equilibrium as the live convoy economy
+        for (float& Integrity : SupplyIntegrity)
+        {
+            Integrity = UTGConvoyEconomySubsystem::DecayIntegrity(Integrity, Config.IntegrityEquilibrium, Config.IntegrityHalfLifeHours, StepHours);
+        }
+
+        // Hourly influence decay, at each territory's own rate
+        if (Step % StepsPerHour == 0 && Config.InfluenceDecayScale > 0.0f)
+        {
+            for (auto& RegionPair : World.RegionStates)
+            {
+                FTerritorialState& State = RegionPair.Value;
+                const int32 Decay = FMath::RoundToInt(State.InfluenceDecayRate * Config.InfluenceDecayScale);
+                for (const UAITerritorialBehavior* Behavior : Behaviors)
+                {
+                    OutResult.ControlChanges += ApplySimulatedInfluence(State, Behavior->FactionID, -Decay) ? 1 : 0;
+                }
+            }
+        }
+
+        // Control tally, contested time and victory
+        FMemory::Memzero(RegionsHeld.GetData(), RegionsHeld.Num() * sizeof(int32));
+        int32 ContestedRegions = 0;
+        for (const auto& RegionPair : World.RegionStates)
+        {
+            ContestedRegions += RegionPair.Value.bIsContested ? 1 : 0;
+            for (int32 Index = 0; Index < NumFactions; ++Index)
+            {
+                if (RegionPair.Value.DominantFaction == Behaviors[Index]->FactionID)
+                {
+                    RegionsHeld[Index]++;
+                    break;
+                }
+            }
+        }
+        World.ContestedTerritories = ContestedRegions;
+        OutResult.ContestedRegionHours += ContestedRegions * StepHours;
+
+        for (int32 Index = 0; Index < NumFactions; ++Index)
+        {
+            VictoryHeldHours[Index] = RegionsHeld[Index] >= VictoryRegions ? VictoryHeldHours[Index] + StepHours : 0.0f;
+            if (VictoryHeldHours[Index] >= Config.VictoryHoldHours && OutResult.WinnerFactionID == 0)
+            {
+                OutResult.WinnerFactionID = Behaviors[Index]->FactionID;
+            }
+        }
+    }
+
+    OutResult.EndHour = Step * StepHours;
+
+    for (int32 Index = 0; Index < NumFactions; ++Index)
+    {
+        FTerritorialWarSimFactionResult& FactionResult = OutResult.Factions[Index];
+        int32 TotalInfluence = 0;
+        for (const auto& RegionPair : World.RegionStates)
+        {
+            TotalInfluence += RegionPair.Value.FactionInfluences.FindRef(FactionResult.FactionID);
+        }
+        FactionResult.RegionsHeld = RegionsHeld[Index];
+        FactionResult.MeanInfluence = static_cast<float>(TotalInfluence) / Config.NumRegions;
+        FactionResult.SupplyIntegrity = SupplyIntegrity[Index];
+    }
+}
+
+void FTerritorialWarSimulator::Summarize(const TArray<FTerritorialWarSimResult>& Results, FTerritorialWarSimSummary& OutSummary)
+{
+    OutSummary = FTerritorialWarSimSummary();
+    OutSummary.Runs = Results.Num();
+    if (Results.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 NumFactions = Results[0].Factions.Num();
+    for (const FTerritorialWarSimFactionResult& Faction : Results[0].Factions)
+    {
+        OutSummary.FactionIDs.Add(Faction.FactionID);
+    }
+    OutSummary.Wins.SetNumZeroed(NumFactions);
+    OutSummary.MeanRegionsHeld.SetNumZeroed(NumFactions);
+    OutSummary.ConvoySuccessRate.SetNumZeroed(NumFactions);
+
+    TArray<int32> Delivered;
+    TArray<int32> Dispatched;
+    Delivered.SetNumZeroed(NumFactions);
+    Dispatched.SetNumZeroed(NumFactions);
+
+    for (const FTerritorialWarSimResult& Result : Results)
+    {
+        OutSummary.TotalSimulatedHours += Result.EndHour;
+        OutSummary.MeanEndHour += Result.EndHour;
+        OutSummary.MeanControlChanges += Result.ControlChanges;
+        OutSummary.Stalemates += Result.WinnerFactionID == 0 ? 1 : 0;
+
+        for (int32 Index = 0; Index < NumFactions; ++Index)
+        {
+            const FTerritorialWarSimFactionResult& Faction = Result.Factions[Index];
+            OutSummary.Wins[Index] += Result.WinnerFactionID == Faction.FactionID ? 1 : 0;
+            OutSummary.MeanRegionsHeld[Index] += Faction.RegionsHeld;
+            Delivered[Index] += Faction.ConvoysDelivered;
+            Dispatched[Index] += Faction.ConvoysDelivered + Faction.ConvoysLost;
+        }
+    }
+
+    const float InvRuns = 1.0f / Results.Num();
+    OutSummary.MeanEndHour *= InvRuns;
+    OutSummary.MeanControlChanges *= InvRuns;
+    for (int32 Index = 0; Index < NumFactions; ++Index)
+    {
+        OutSummary.MeanRegionsHeld[Index] *= InvRuns;
+        OutSummary.ConvoySuccessRate[Index] = Dispatched[Index] > 0 ? static_cast<float>(Delivered[Index]) / Dispatched[Index] : 0.0f;
+    }
+}
+
+bool FTerritorialWarSimulator::WriteResultsCsv(const FString& FilePath, const TArray<FTerritorialWarSimResult>& Results)
+{
+    FString Csv = TEXT("Seed,Winner,EndHour,ControlChanges,ContestedRegionHours");
+    if (Results.Num() > 0)
+    {
+        for (const FTerritorialWarSimFactionResult& Faction : Results[0].Factions)
+        {
+            Csv += FString::Printf(TEXT(",F%d_Regions,F%d_MeanInfluence,F%d_Integrity,F%d_ConvoysDelivered,F%d_ConvoysLost,F%d_Decisions"),
+                Faction.FactionID, Faction.FactionID, Faction.FactionID, Faction.FactionID, Faction.FactionID, Faction.FactionID);
+        }
+    }
+    Csv += LINE_TERMINATOR;
+
+    for (const FTerritorialWarSimResult& Result : Results)
+    {
+        Csv += FString::Printf(TEXT("%d,%d,%.2f,%d,%.2f"), Result.Seed, Result.WinnerFactionID, Result.EndHour, Result.ControlChanges, Result.ContestedRegionHours);
+        for (const FTerritorialWarSimFactionResult& Faction : Result.Factions)
+        {
+            Csv += FString::Printf(TEXT(",%d,%.2f,%.3f,%d,%d,%d"), Faction.RegionsHeld, Faction.MeanInfluence, Faction.SupplyIntegrity,
+                Faction.ConvoysDelivered, Faction.ConvoysLost, Faction.Decisions);
+        }
+        Csv += LINE_TERMINATOR;
+    }
+
+    return FFileHelper::SaveStringToFile(Csv, *FilePath);
+}
+
+bool FTerritorialWarSimulator::WriteSummaryJson(const FString& FilePath, const FTerritorialWarSimSummary& Summary, const FTerritorialWarSimConfig& Config)
+{
+    TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetObjectField(TEXT("config"), FJsonObjectConverter::UStructToJsonObject(Config));
+    Root->SetObjectField(TEXT("summary"), FJsonObjectConverter::UStructToJsonObject(Summary));
+
+    FString Json;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
+    {
+        return false;
+    }
+    return FFileHelper::SaveStringToFile(Json, *FilePath);
+}
@@ -5,8 +5,21 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "TerritorialTypes.h"
+#include "TerritorialThreatTable.h"
 #include "AITerritorialBehavior.generated.h"
 
+/**
+ * Mean influence-map value per faction over one territory
+ */
+USTRUCT(BlueprintType)
+struct TGTERRITORIAL_API FTerritorialInfluenceSample
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "World State")
+    TArray<float> FactionInfluence; // Index = FactionID, 0 unused
+};
+
 USTRUCT(BlueprintType)
 struct TGTERRITORIAL_API FTerritorialWorldState
 {
@@ -27,6 +40,14 @@ struct TGTERRITORIAL_API FTerritorialWorldState
     UPROPERTY(BlueprintReadWrite, Category = "World State")
     int32 ContestedTerritories;
 
+    // Spatial pressure from the influence map; empty when no map is running
+    UPROPERTY(BlueprintReadWrite, Category = "World State")
+    TMap<int32, FTerritorialInfluenceSample> RegionInfluence;
+
+    // Territory ID -> bitmask of factions (bit FactionID) whose minimum supply cut runs through it
+    UPROPERTY(BlueprintReadWrite, Category = "World State")
+    TMap<int32, int32> SupplyChokeFactionMasks;
+
     UPROPERTY(BlueprintReadWrite, Category = "World State")
     FDateTime LastUpdated;
 };
@@ -118,6 +139,19 @@ struct TGTERRITORIAL_API FTerritorialAction
     FString Description; // Human-readable action description
 };
 
+/**
+ * Output of one faction's evaluation pass over a world snapshot.
+ * Produced on worker threads, applied to the behavior on the game thread.
+ */
+struct TGTERRITORIAL_API FTerritorialFactionEvaluation
+{
+    int32 FactionID = 0;
+    TArray<FTerritorialThreat> Threats;
+    FTerritorialDecision Decision;
+    TMap<int32, float> TerritoryPriorities;
+    bool bFullPriorityRefresh = false; // false = TerritoryPriorities holds only changed regions
+};
+
 /**
  * Base class for faction AI territorial behavior
  * Each faction inherits from this to implement unique strategies
@@ -128,6 +162,7 @@ class TGTERRITORIAL_API UAITerritorialBehavior : public UObject
     GENERATED_BODY()
     
     friend class UAITerritorialManager;
+    friend class FTerritorialWarSimulator;
 
 public:
     UAITerritorialBehavior();
@@ -146,6 +181,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Territorial")
     void UpdateTerritorialAI(const FTerritorialWorldState& WorldState);
 
+    // Read-only evaluation against an immutable snapshot; safe to run on a worker thread
+    virtual void EvaluateWorldSnapshot(const FTerritorialWorldState& Snapshot, FTerritorialFactionEvaluation& OutEvaluation);
+
+    // Commits an evaluation to this behavior's state (game thread)
+    void ApplyEvaluation(FTerritorialFactionEvaluation&& Evaluation);
+
+    // Incremental threat table, maintained by UAITerritorialManager from territorial updates
+    void SetThreat(uint64 TerritoryKey, const FTerritorialThreat& Threat, float Score);
+    void ClearThreat(uint64 TerritoryKey);
+    void ResetThreatTable();
+    void GetTopThreats(int32 Count, TArray<FTerritorialThreat>& OutThreats);
+
+    // Marks a region whose priority must be recomputed on the next evaluation
+    void MarkPriorityDirty(int32 RegionID) { DirtyPriorityRegions.Add(RegionID); }
+
     UFUNCTION(BlueprintCallable, Category = "AI Territorial")
     TArray<FTerritorialThreat> AnalyzeThreats(const FTerritorialWorldState& WorldState);
 
@@ -211,6 +261,42 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "AI State")
     TMap<int32, float> TerritoryPriorities; // Territory ID -> Priority score
 
+    // Incremental state (touched only by this behavior's own evaluation or the game thread)
+    FTerritorialScoreHeap ThreatHeap;
+    TMap<uint64, FTerritorialThreat> ThreatTable;
+    bool bThreatTableActive = false;
+
+    // Threat ThreatenedFactionID faces at one territory, 0 if none; shared by the full scan and the incremental threat table
+    static float ScoreTerritoryThreat(int32 ThreatenedFactionID, uint64 Key, const FTrackedTerritoryState& State, FTerritorialThreat& OutThreat);
+
+    FTerritorialScoreHeap PriorityHeap;
+    TSet<int32> DirtyPriorityRegions;
+    bool bPrioritiesSeeded = false;
+
+    // Frontier pressure each region's cached priority was computed with
+    TMap<int32, float> PriorityFrontierPressure;
+
+    // Priority weight of influence-map pressure at a region's border
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Config")
+    float FrontierPressureWeight = 20.0f;
+
+    // Rival minus own share of a region's sampled influence, -1 (ours) to 1 (theirs); 0 without a sample
+    float GetFrontierPressure(int32 TerritoryID, const FTerritorialWorldState& WorldState) const;
+
+    // Priority weight of a region on a supply choke point: a rival's to cut, or our own to hold
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Config")
+    float SupplyChokeWeight = 15.0f;
+
+    // Supply choke masks the cached priorities were computed with
+    TMap<int32, int32> PrioritySupplyChokeMasks;
+
+    // Threats and expansion candidates considered per decision pass
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Config")
+    int32 TopThreatCount = 5;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Config")
+    int32 ExpansionCandidateCount = 8;
+
     // Decision-making helper functions
     virtual float CalculateTerritoryPriority(int32 TerritoryID, ETerritoryType TerritoryType, const FTerritorialWorldState& WorldState);
     virtual bool IsViableTerritorialTarget(int32 TerritoryID, ETerritoryType TerritoryType, const FTerritorialWorldState& WorldState);
@@ -325,6 +411,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "AI Management")
     UAITerritorialBehavior* GetFactionAI(int32 FactionID);
 
+    // Regions where the influence map is sampled for each decision pass
+    UFUNCTION(BlueprintCallable, Category = "AI Management")
+    void SetRegionLayout(const TArray<FTerritorialConfigRow>& ConfigRows);
+
+    // Samples the world's influence map over the region layout into WorldState.RegionInfluence
+    void SampleRegionInfluence(FTerritorialWorldState& WorldState) const;
+
 protected:
     // AI instances for each faction
     UPROPERTY(BlueprintReadOnly, Category = "AI Management")
@@ -340,6 +433,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Timing")
     float ThreatResponseInterval = 5.0f; // 5 seconds
 
+    // Evaluate factions on worker threads against a frozen snapshot
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Timing")
+    bool bParallelFactionEvaluation = true;
+
     // AI state
     UPROPERTY(BlueprintReadOnly, Category = "AI State")
     FDateTime LastStrategicUpdate;
@@ -353,6 +450,16 @@ private:
 
     TArray<FTerritorialAction> QueuedActions;
 
+    // Incremental influence model behind the per-faction threat tables
+    TMap<uint64, FTrackedTerritoryState> TrackedTerritories;
+    bool bThreatModelSeeded = false;
+
+    // Region positions and radii for sampling the influence map into each snapshot
+    TArray<FTerritorialInfo> RegionLayout;
+
+    void SeedThreatModel(const FTerritorialWorldState& WorldState);
+    void RescoreTerritory(uint64 TerritoryKey);
+
 private:
     void CreateFactionAI(int32 FactionID);
     void ProcessStrategicDecisions(const FTerritorialWorldState& WorldState);
@@ -25,6 +25,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -81,6 +82,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Territorial")
     int32 MaxPlayersForInfluence = 4; // Diminishing returns after this
 
+    // Peak strength this area contributes to the influence map, scaled by BaseInfluenceRate
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Territorial")
+    float InfluenceMapStrength = 100.0f;
+
     // Area boundaries
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boundaries")
     FVector AreaCenter = FVector::ZeroVector;
@@ -159,6 +164,8 @@ protected:
     UPROPERTY()
     float LastInfluenceUpdate = 0.0f;
 
+    int32 InfluenceSourceHandle = INDEX_NONE;
+
     // Internal functions
     void CheckPlayerProximity();
     void OnPlayerEntered(APawn* Player);
@@ -167,6 +174,8 @@ protected:
     EFactionID GetPlayerFaction(APawn* Player) const;
     float CalculateInfluenceMultiplier() const;
     void NotifyTerritorialManager(int32 InfluenceChange, const FString& Cause);
+    void RegisterInfluenceSource();
+    void UnregisterInfluenceSource();
 
     // Sphere component callbacks
     UFUNCTION()
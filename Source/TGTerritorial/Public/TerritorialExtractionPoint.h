@@ -40,6 +40,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     virtual void Tick(float DeltaTime) override;
@@ -121,6 +122,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Feedback")
     bool bShowTerritorialInfluence = true;
 
+    // Influence map source for the controlling faction; radius follows the contestation zone
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Territorial")
+    float InfluenceMapStrength = 60.0f;
+
     // Current state
     UPROPERTY(BlueprintReadOnly, Category = "State")
     EExtractionState CurrentState = EExtractionState::Available;
@@ -215,6 +220,8 @@ protected:
     void UpdateTerritorialBonuses();
     bool ValidateTerritorialState();
     void OnTerritorialControlChanged(int32 TerritoryID, EFactionID OldFaction, EFactionID NewFaction);
+    void RefreshInfluenceSource();
+    void UnregisterInfluenceSource();
 
     // Overlap handlers
     UFUNCTION()
@@ -253,4 +260,7 @@ private:
     
     UPROPERTY()
     float CachedTerritorialInfluenceMultiplier = 1.0f;
+
+    int32 InfluenceSourceHandle = INDEX_NONE;
+    EFactionID InfluenceSourceFaction = EFactionID::None;
 };
\ No newline at end of file
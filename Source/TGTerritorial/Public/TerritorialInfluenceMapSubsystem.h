@@ -0,0 +1,181 @@
+// Copyright Terminal Grounds. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "TerritorialTypes.h"
+#include "TerritorialInfluenceMapSubsystem.generated.h"
+
+struct FTerritorialWorldState;
+struct FTerritorialInfluenceSample;
+class APawn;
+class AController;
+class ATGCharacter;
+
+/**
+ * Territorial Influence Map Subsystem
+ * Keeps one 2D influence grid per faction over the playable area. Sources (players, capture
+ * nodes, control structures) are stamped into a per-faction source layer; each update runs a
+ * SIMD decay-and-propagate step over only the cells that are still changing, so a settled map
+ * costs nothing and a moved source only wakes the area around it. Pawns register themselves
+ * from world begin play and spawn, under the faction their character (or team id) names.
+ */
+UCLASS()
+class TGTERRITORIAL_API UTerritorialInfluenceMapSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // UWorldSubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTerritorialInfluenceMapSubsystem, STATGROUP_Tickables); }
+    virtual bool IsTickable() const override { return !IsTemplate(); }
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+    /** Resizes the grid to cover WorldBounds (XY, cm) at Resolution x Resolution cells; clears all influence */
+    UFUNCTION(BlueprintCallable, Category = "Influence Map")
+    void ConfigureGrid(const FBox2D& WorldBounds, int32 Resolution);
+
+    // Sources
+    /** Static source; returns a handle for MoveSource/RemoveSource */
+    UFUNCTION(BlueprintCallable, Category = "Influence Map")
+    int32 AddSource(int32 FactionID, const FVector& Location, float Strength, float Radius);
+
+    /** Source that follows an actor; re-stamped whenever the actor moves more than half a cell */
+    UFUNCTION(BlueprintCallable, Category = "Influence Map")
+    int32 AddActorSource(AActor* Actor, int32 FactionID, float Strength, float Radius);
+
+    UFUNCTION(BlueprintCallable, Category = "Influence Map")
+    void MoveSource(int32 SourceHandle, const FVector& NewLocation);
+
+    UFUNCTION(BlueprintCallable, Category = "Influence Map")
+    void SetSourceStrength(int32 SourceHandle, float Strength);
+
+    UFUNCTION(BlueprintCallable, Category = "Influence Map")
+    void RemoveSource(int32 SourceHandle);
+
+    // Sampling
+    /** Bilinear influence of one faction at a world location */
+    UFUNCTION(BlueprintPure, Category = "Influence Map")
+    float GetInfluenceAt(int32 FactionID, const FVector& Location) const;
+
+    /** Faction with the highest influence at a location, 0 if none */
+    UFUNCTION(BlueprintPure, Category = "Influence Map")
+    int32 GetDominantFactionAt(const FVector& Location, float& OutInfluence) const;
+
+    /** Mean influence per faction over a territory's control radius */
+    void SampleTerritory(const FTerritorialInfo& Territory, FTerritorialInfluenceSample& OutSample) const;
+
+    /** Fills WorldState.RegionInfluence for the faction AI from the given region layout */
+    void FillWorldStateInfluence(const TArray<FTerritorialInfo>& Regions, FTerritorialWorldState& WorldState) const;
+
+    /** One pixel per cell: dominant faction colour, alpha by strength relative to HeatmapFullStrength */
+    void BuildHeatmapPixels(const TMap<int32, FLinearColor>& FactionColors, TArray<FColor>& OutPixels) const;
+
+    UFUNCTION(BlueprintPure, Category = "Influence Map")
+    int32 GetResolution() const { return Resolution; }
+
+    /** Bumped whenever cell values may have changed; equal revisions mean an identical map */
+    uint32 GetRevision() const { return Revision; }
+
+    // Configuration
+    /** Seconds between propagation steps */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Influence Map|Config", meta = (ClampMin = "0.0"))
+    float UpdateInterval = 0.1f;
+
+    /** Fraction of a cell's influence that reaches its neighbours per step */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Influence Map|Config", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float PropagationDecay = 0.9f;
+
+    /** How far a cell moves towards its propagated target per step (1 = instant) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Influence Map|Config", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float Momentum = 0.35f;
+
+    /** Cells changing by less than this are considered settled and drop out of the active area */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Influence Map|Config", meta = (ClampMin = "0.0"))
+    float SettleThreshold = 0.01f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Influence Map|Config", meta = (ClampMin = "0.001"))
+    float HeatmapFullStrength = 100.0f;
+
+    /** Source strength of each pawn whose team maps to a faction */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Influence Map|Config", meta = (ClampMin = "0.0"))
+    float PawnInfluenceStrength = 25.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Influence Map|Config", meta = (ClampMin = "0.0"))
+    float PawnInfluenceRadius = 1500.0f;
+
+    // Stats
+    double GetLastUpdateTimeMs() const { return LastUpdateTimeMs; }
+    int32 GetLastActiveCellCount() const { return LastActiveCells; }
+
+private:
+    struct FInfluenceSource
+    {
+        int32 FactionID = 0;
+        FVector2D Location = FVector2D::ZeroVector;
+        float Strength = 0.0f;
+        float Radius = 0.0f;
+        TWeakObjectPtr<AActor> TrackedActor;
+    };
+
+    struct FInfluenceLayer
+    {
+        TArray<float> Values;
+        TArray<float> Stamp;        // Max of source falloffs; propagation never drops below it
+        FIntRect ActiveRect;        // Cells that changed last step (exclusive max), or empty
+        bool bActive = false;
+        TArray<float> ScratchA;     // Pre-update copies of the current and previous row
+        TArray<float> ScratchB;
+    };
+
+    FBox2D GridBounds = FBox2D(FVector2D(-50000.0f), FVector2D(50000.0f));
+    int32 Resolution = 256;
+    float CellSize = 0.0f;
+
+    // Index = FactionID - 1
+    TArray<FInfluenceLayer> Layers;
+    TArray<float> ZeroRow;
+
+    TMap<int32, FInfluenceSource> Sources;
+    int32 NextSourceHandle = 1;
+
+    // Pawns are registered automatically; faction changes re-register them under the new faction
+    TMap<TWeakObjectPtr<APawn>, int32> PawnSources;
+    FDelegateHandle ActorSpawnedHandle;
+
+    uint32 Revision = 0;
+    float TimeAccumulator = 0.0f;
+    double LastUpdateTimeMs = 0.0;
+    int32 LastActiveCells = 0;
+
+    FIntRect GetSourceRect(const FInfluenceSource& Source) const;
+    void RestampRect(int32 FactionID, const FIntRect& Rect);
+    void PropagateLayer(FInfluenceLayer& Layer) const;
+    void RefreshTrackedSources();
+    float SampleLayer(const FInfluenceLayer& Layer, const FVector2D& Location) const;
+
+    void HandleActorSpawned(AActor* Actor);
+    void RegisterPawn(APawn* Pawn);
+    void RefreshPawnSource(APawn* Pawn);
+
+    UFUNCTION()
+    void HandlePawnControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+    UFUNCTION()
+    void HandlePawnEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+    UFUNCTION()
+    void HandleCharacterFactionChanged(ATGCharacter* Character);
+
+    /** Faction of a Terminal Grounds character, else the pawn's or its controller's generic team id (team ids follow EFactionID); 0 if none */
+    static int32 ResolvePawnFaction(const APawn* Pawn);
+};
@@ -9,6 +9,9 @@
 #include "TerritorialTypes.h"
 #include "TerritorialManager.generated.h"
 
+class UAITerritorialManager;
+class UDataTable;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnTerritorialControlChanged, int32, TerritoryID, ETerritoryType, TerritoryType, int32, OldFaction, int32, NewFaction);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnTerritoryContestedCore, int32, TerritoryID, ETerritoryType, TerritoryType, const TArray<int32>&, ContestingFactions);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FOnPlayerTerritorialAction, int32, PlayerID, int32, FactionID, const FString&, ActionType, int32, InfluenceGained, int32, TerritoryID);
@@ -45,6 +48,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Territorial")
     bool IsTerritoryContested(int32 TerritoryID, ETerritoryType TerritoryType);
 
+    // Influence rules, shared with the headless war simulation
+    static bool DetermineIfContested(const TMap<int32, int32>& FactionInfluences);
+    static int32 FindDominantFaction(const TMap<int32, int32>& FactionInfluences);
+
     // Territorial hierarchy queries
     UFUNCTION(BlueprintPure, Category = "Territorial")
     TArray<int32> GetDistrictsInRegion(int32 RegionID);
@@ -122,8 +129,6 @@ private:
 
     // Influence calculation helpers
     int32 CalculateNewInfluence(int32 CurrentInfluence, int32 Change, float FactionModifier);
-    bool DetermineIfContested(const TMap<int32, int32>& FactionInfluences);
-    int32 FindDominantFaction(const TMap<int32, int32>& FactionInfluences);
 
     // Performance optimization
     FDateTime LastCacheUpdate;
@@ -133,7 +138,7 @@ private:
 /**
  * Singleton access to territorial manager
  */
-UCLASS(BlueprintType)
+UCLASS(BlueprintType, Config = Game)
 class TGTERRITORIAL_API UTerritorialSubsystem : public UWorldSubsystem
 {
     GENERATED_BODY()
@@ -141,11 +146,27 @@ class TGTERRITORIAL_API UTerritorialSubsystem : public UWorldSubsystem
 public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 
     UFUNCTION(BlueprintPure, Category = "Territorial")
     static UTerritorialManager* GetTerritorialManager(const UObject* WorldContext);
 
+    UFUNCTION(BlueprintPure, Category = "Territorial")
+    UAITerritorialManager* GetAIManager() const { return AIManager; }
+
+    // Lays out the map's territories: sizes the influence map to the level and the territories,
+    // and gives the faction AI the regions it samples pressure over
+    UFUNCTION(BlueprintCallable, Category = "Territorial")
+    void ConfigureTerritories(const UDataTable* ConfigTable);
+
+    // FTerritorialConfigRow table applied at world begin play
+    UPROPERTY(Config, EditAnywhere, Category = "Territorial")
+    TSoftObjectPtr<UDataTable> TerritorialConfigTable;
+
 protected:
     UPROPERTY()
     UTerritorialManager* TerritorialManager;
+
+    UPROPERTY()
+    UAITerritorialManager* AIManager;
 };
\ No newline at end of file
@@ -0,0 +1,68 @@
+// Copyright Terminal Grounds. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TerritorialTypes.h"
+
+/** Packs territory type and ID into one key so region and district IDs cannot collide */
+FORCEINLINE uint64 MakeTerritoryKey(ETerritoryType TerritoryType, int32 TerritoryID)
+{
+    return (static_cast<uint64>(TerritoryType) << 32) | static_cast<uint32>(TerritoryID);
+}
+
+FORCEINLINE int32 GetTerritoryKeyID(uint64 Key) { return static_cast<int32>(Key & 0xFFFFFFFFu); }
+FORCEINLINE ETerritoryType GetTerritoryKeyType(uint64 Key) { return static_cast<ETerritoryType>(Key >> 32); }
+
+/**
+ * Keyed max-heap with lazy deletion.
+ * Set/Remove are O(log n); stale heap entries are discarded when they surface in GetTop,
+ * so reading the top k costs O((k + discarded) log n) instead of a scan of every key.
+ */
+class TGTERRITORIAL_API FTerritorialScoreHeap
+{
+public:
+    void Set(uint64 Key, float Score);
+    void Remove(uint64 Key);
+    void Reset();
+
+    bool Contains(uint64 Key) const { return Current.Contains(Key); }
+    int32 Num() const { return Current.Num(); }
+
+    /** Highest scores first; ties broken by lower key for deterministic output */
+    void GetTop(int32 Count, TArray<TPair<uint64, float>>& OutTop);
+
+private:
+    struct FEntry
+    {
+        float Score;
+        uint64 Key;
+        uint32 Version;
+    };
+
+    struct FEntryOrder
+    {
+        bool operator()(const FEntry& A, const FEntry& B) const
+        {
+            return A.Score > B.Score || (A.Score == B.Score && A.Key < B.Key);
+        }
+    };
+
+    TArray<FEntry> Heap;
+    TMap<uint64, TPair<float, uint32>> Current; // Key -> (score, live version)
+    uint32 NextVersion = 1;
+
+    bool IsLive(const FEntry& Entry) const;
+    void CompactIfNeeded();
+};
+
+/** Influence snapshot of one territory, maintained from FTerritorialUpdate deltas */
+struct TGTERRITORIAL_API FTrackedTerritoryState
+{
+    int32 Influence[TERRITORIAL_MAX_FACTIONS + 1] = {}; // Index 0 unused, 1-7 for factions
+    int32 DominantFaction = 0;
+    bool bIsContested = false;
+
+    /** Recomputes dominance and contest state through UTerritorialManager's shared influence rules */
+    void Refresh();
+};
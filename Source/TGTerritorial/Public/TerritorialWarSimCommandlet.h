@@ -0,0 +1,26 @@
+// Copyright Terminal Grounds. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TerritorialWarSimCommandlet.generated.h"
+
+/**
+ * Headless balance sweep over the territorial war simulation.
+ *
+ * UnrealEditor-Cmd <Project> -run=TerritorialWarSim -Runs=1000 -Seed=1 -Output=Saved/WarSim/run
+ *     [-<FTerritorialWarSimConfig property>=<value> ...] [-VerifyDeterminism]
+ *
+ * Writes <Output>.csv (one row per seed) and <Output>.json (config and aggregate statistics).
+ */
+UCLASS()
+class TGTERRITORIAL_API UTerritorialWarSimCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UTerritorialWarSimCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,232 @@
+// Copyright Terminal Grounds. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AITerritorialBehavior.h"
+#include "TerritorialWarSimulation.generated.h"
+
+/**
+ * One AI faction taking part in a simulated war.
+ * Negative tuning values keep the behavior class defaults.
+ */
+USTRUCT(BlueprintType)
+struct TGTERRITORIAL_API FTerritorialWarSimFaction
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim")
+    TSubclassOf<UAITerritorialBehavior> BehaviorClass;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim")
+    float AggressionLevel = -1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim")
+    float DefensiveBonus = -1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim")
+    float EconomicFocus = -1.0f;
+};
+
+/**
+ * Balance parameters for a headless war simulation run.
+ * Every property can be overridden from the TerritorialWarSim commandlet command line by name.
+ */
+USTRUCT(BlueprintType)
+struct TGTERRITORIAL_API FTerritorialWarSimConfig
+{
+    GENERATED_BODY()
+
+    /** Empty = Directorate, Free77 and Nomad Clans with their class defaults */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim")
+    TArray<FTerritorialWarSimFaction> Factions;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "2"))
+    int32 NumRegions = TERRITORIAL_MAX_REGIONS;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    int32 InitialInfluenceMin = 10;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    int32 InitialInfluenceMax = 40;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "1"))
+    float SimulatedHours = 168.0f;
+
+    /** Simulation step in game minutes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "1"))
+    float StepMinutes = 5.0f;
+
+    /** Game minutes between faction AI decision passes (matches the manager's strategic interval) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "1"))
+    float DecisionIntervalMinutes = 5.0f;
+
+    /** Multiplier on each territory's InfluenceDecayRate, applied once per simulated hour */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    float InfluenceDecayScale = 1.0f;
+
+    /** Influence gained per committed resource point by a successful defensive decision */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    float DefenseEfficiency = 0.1f;
+
+    /** Influence gained per committed resource point by a successful expansion decision */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    float ExpansionEfficiency = 0.12f;
+
+    /** Share of an expansion's gain taken from the target's current owner */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0", ClampMax = "1"))
+    float ExpansionDisplacement = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "1"))
+    float ConvoyIntervalMinutes = 30.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0", ClampMax = "1"))
+    float ConvoyBaseSuccess = 0.75f;
+
+    /** Supply integrity gained or lost per convoy outcome */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    float ConvoyIntegrityDelta = 0.05f;
+
+    /** Destination influence from a delivered convoy, scaled by the faction's economic focus */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    int32 ConvoyInfluenceReward = 4;
+
+    /** Supply integrity relaxes towards this value with the half-life below, as in the live convoy economy */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0", ClampMax = "1"))
+    float IntegrityEquilibrium = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    float IntegrityHalfLifeHours = 6.0f;
+
+    /** A faction wins by holding this share of regions for VictoryHoldHours */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0", ClampMax = "1"))
+    float VictoryRegionShare = 0.75f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Sim", meta = (ClampMin = "0"))
+    float VictoryHoldHours = 12.0f;
+};
+
+/** Per-faction outcome of one run */
+USTRUCT(BlueprintType)
+struct TGTERRITORIAL_API FTerritorialWarSimFactionResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 FactionID = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 RegionsHeld = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    float MeanInfluence = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    float SupplyIntegrity = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 ConvoysDelivered = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 ConvoysLost = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 Decisions = 0;
+};
+
+/** Outcome of one seeded run */
+USTRUCT(BlueprintType)
+struct TGTERRITORIAL_API FTerritorialWarSimResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 Seed = 0;
+
+    /** 0 when no faction reached the victory condition in time */
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 WinnerFactionID = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    float EndHour = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 ControlChanges = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    float ContestedRegionHours = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    TArray<FTerritorialWarSimFactionResult> Factions;
+
+    bool operator==(const FTerritorialWarSimResult& Other) const;
+};
+
+/** Aggregate statistics over a batch of runs */
+USTRUCT(BlueprintType)
+struct TGTERRITORIAL_API FTerritorialWarSimSummary
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 Runs = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    int32 Stalemates = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    float MeanEndHour = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    float MeanControlChanges = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    double TotalSimulatedHours = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    double WallSeconds = 0.0;
+
+    // Per-faction, in config order
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    TArray<int32> FactionIDs;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    TArray<int32> Wins;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    TArray<float> MeanRegionsHeld;
+
+    UPROPERTY(BlueprintReadOnly, Category = "War Sim")
+    TArray<float> ConvoySuccessRate;
+};
+
+/**
+ * Headless fast-forward territorial war.
+ * Runs the real faction AI behaviors and territorial influence rules against a plain world state,
+ * with a stripped-down convoy economy and no actors, worlds or rendering. Each run owns its state
+ * and random stream, so a seed always reproduces the same war and runs parallelise across cores.
+ */
+class TGTERRITORIAL_API FTerritorialWarSimulator
+{
+public:
+    explicit FTerritorialWarSimulator(const FTerritorialWarSimConfig& InConfig);
+
+    /** Runs NumRuns wars seeded BaseSeed, BaseSeed + 1, ... Must be called on the game thread. */
+    void RunBatch(int32 BaseSeed, int32 NumRuns, TArray<FTerritorialWarSimResult>& OutResults, FTerritorialWarSimSummary& OutSummary) const;
+
+    /** Runs a single war. Must be called on the game thread. */
+    FTerritorialWarSimResult RunSingle(int32 Seed) const;
+
+    const FTerritorialWarSimConfig& GetConfig() const { return Config; }
+
+    static bool WriteResultsCsv(const FString& FilePath, const TArray<FTerritorialWarSimResult>& Results);
+    static bool WriteSummaryJson(const FString& FilePath, const FTerritorialWarSimSummary& Summary, const FTerritorialWarSimConfig& Config);
+
+private:
+    FTerritorialWarSimConfig Config;
+
+    TArray<UAITerritorialBehavior*> CreateBehaviors() const;
+    void SimulateWar(int32 Seed, const TArray<UAITerritorialBehavior*>& Behaviors, FTerritorialWarSimResult& OutResult) const;
+
+    static void Summarize(const TArray<FTerritorialWarSimResult>& Results, FTerritorialWarSimSummary& OutSummary);
+};
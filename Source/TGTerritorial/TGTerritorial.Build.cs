@@ -41,7 +41,9 @@ public class TGTerritorial : ModuleRules
                 "Slate",
                 "SlateCore",
                 "RenderCore",
-                "RHI"
+                "RHI",
+                "AIModule",
+                "TGWorld"
             }
         );
         
@@ -19,6 +19,8 @@ void UTGInventoryWidget::InitializeInventory(UTGExosuitComponent *ExosuitComp) {
       this, &UTGInventoryWidget::OnAugmentInstalled);
   ExosuitComponent->OnAugmentRemoved.AddDynamic(
       this, &UTGInventoryWidget::OnAugmentRemoved);
+  ExosuitComponent->OnExosuitStatsChanged.AddDynamic(
+      this, &UTGInventoryWidget::OnExosuitStatsChanged);
 
   UpdateExosuitDisplay(ExosuitComponent->GetExosuitData(),
                        ExosuitComponent->GetCurrentDamageStage());
@@ -66,6 +68,10 @@ void UTGInventoryWidget::OnAugmentRemoved(UTGAugmentData *AugmentData) {
                                       : TArray<UTGAugmentData *>{});
 }
 
+void UTGInventoryWidget::OnExosuitStatsChanged(const FExosuitStats &NewStats) {
+  UpdateExosuitStats(NewStats);
+}
+
 void UTGInventoryWidget::OnAugmentSlotButtonClicked(int32 SlotIndex) {
   OnAugmentSlotClicked.Broadcast(SlotIndex);
 }
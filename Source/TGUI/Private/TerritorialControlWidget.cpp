@@ -6,6 +6,9 @@
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "TGTerritorial/Public/TerritorialManager.h"
+#include "TGTerritorial/Public/TerritorialInfluenceMapSubsystem.h"
+#include "Engine/Texture2D.h"
+#include "RenderingThread.h"
 #include "TGTerritorial/Public/PhaseGateComponent.h"
 #include "TGTerritorial/Public/DominanceMeterComponent.h"
 #include "TGTerritorial/Public/TicketPoolComponent.h"
@@ -41,6 +44,12 @@ void UTerritorialControlWidget::NativeConstruct()
 void UTerritorialControlWidget::NativeDestruct()
 {
     Super::NativeDestruct();
+
+    // The render thread may still be reading HeatmapPixels
+    if (*bHeatmapUploadPending)
+    {
+        FlushRenderingCommands();
+    }
     
     TerritorialManager = nullptr;
     PlayerPawn = nullptr;
@@ -56,6 +65,7 @@ void UTerritorialControlWidget::NativeTick(const FGeometry& MyGeometry, float In
     if (LastUpdateTime >= UpdateInterval)
     {
         RefreshTerritorialData();
+        RefreshInfluenceHeatmap();
         LastUpdateTime = 0.0f;
     }
 }
@@ -106,6 +116,55 @@ void UTerritorialControlWidget::RefreshTerritorialData()
     UpdateTerritorialDisplay();
 }
 
+void UTerritorialControlWidget::RefreshInfluenceHeatmap()
+{
+    UWorld* World = GetWorld();
+    UTerritorialInfluenceMapSubsystem* InfluenceMap = World ? World->GetSubsystem<UTerritorialInfluenceMapSubsystem>() : nullptr;
+    if (!bShowInfluenceHeatmap || !InfluenceMap)
+    {
+        return;
+    }
+
+    // Still uploading the last map; try again next interval rather than touch the buffer
+    if (*bHeatmapUploadPending)
+    {
+        return;
+    }
+
+    const int32 Resolution = InfluenceMap->GetResolution();
+    if (!InfluenceHeatmap || InfluenceHeatmap->GetSizeX() != Resolution)
+    {
+        InfluenceHeatmap = UTexture2D::CreateTransient(Resolution, Resolution, PF_B8G8R8A8);
+        if (!InfluenceHeatmap)
+        {
+            return;
+        }
+        InfluenceHeatmap->Filter = TF_Bilinear;
+        InfluenceHeatmap->UpdateResource();
+        bHeatmapUploaded = false;
+    }
+
+    if (bHeatmapUploaded && UploadedHeatmapRevision == InfluenceMap->GetRevision())
+    {
+        return;
+    }
+    UploadedHeatmapRevision = InfluenceMap->GetRevision();
+    bHeatmapUploaded = true;
+
+    InfluenceMap->BuildHeatmapPixels(FactionColorMap, HeatmapPixels);
+
+    HeatmapRegion = FUpdateTextureRegion2D(0, 0, 0, 0, Resolution, Resolution);
+    *bHeatmapUploadPending = true;
+    InfluenceHeatmap->UpdateTextureRegions(0, 1, &HeatmapRegion, Resolution * sizeof(FColor), sizeof(FColor),
+        reinterpret_cast<uint8*>(HeatmapPixels.GetData()),
+        [UploadPending = bHeatmapUploadPending](uint8*, const FUpdateTextureRegion2D*)
+        {
+            *UploadPending = false;
+        });
+
+    OnInfluenceHeatmapUpdated(InfluenceHeatmap);
+}
+
 void UTerritorialControlWidget::UpdateTerritorialDisplay()
 {
     // Fire Blueprint event for UI updates
@@ -4,6 +4,7 @@
 #include "TGCore/Public/TGCaptureNode.h"
 #include "Widgets/TGScoreWidget.h"
 #include "TGAI/Public/TGEnemyGrunt.h"
+#include "TGAI/Public/TGCrowdSubsystem.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "Components/InputComponent.h"
@@ -197,6 +198,7 @@ void UTGPlaytestMenu::SpawnTestEnemies()
 	}
 
 	FVector PlayerLocation = PlayerPawn->GetActorLocation();
+	UTGCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UTGCrowdSubsystem>();
 	
 	// Spawn 5 test enemies around the player
 	for (int32 i = 0; i < 5; i++)
@@ -207,7 +209,10 @@ void UTGPlaytestMenu::SpawnTestEnemies()
 			100.0f
 		);
 
-		if (ATGEnemyGrunt* Enemy = GetWorld()->SpawnActor<ATGEnemyGrunt>(ATGEnemyGrunt::StaticClass(), SpawnLocation, FRotator::ZeroRotator))
+		ATGEnemyGrunt* Enemy = Crowd
+			? Crowd->SpawnEnemy(SpawnLocation, FRotator::ZeroRotator, ATGEnemyGrunt::StaticClass(), this)
+			: GetWorld()->SpawnActor<ATGEnemyGrunt>(ATGEnemyGrunt::StaticClass(), SpawnLocation, FRotator::ZeroRotator);
+		if (Enemy)
 		{
 			UE_LOG(LogTemp, Log, TEXT("Spawned test enemy at %s"), *SpawnLocation.ToString());
 		}
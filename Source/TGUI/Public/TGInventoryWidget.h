@@ -135,6 +135,9 @@ private:
     UFUNCTION()
     void OnAugmentRemoved(UTGAugmentData* AugmentData);
 
+    UFUNCTION()
+    void OnExosuitStatsChanged(const FExosuitStats& NewStats);
+
     UFUNCTION()
     void OnAugmentSlotButtonClicked(int32 SlotIndex);
 
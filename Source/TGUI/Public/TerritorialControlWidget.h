@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "RHI.h"
+#include "HAL/ThreadSafeBool.h"
 #include "TGTerritorial/Public/TerritorialTypes.h"
 #include "TGTerritorial/Public/PhaseGateComponent.h"
 #include "TerritorialControlWidget.generated.h"
@@ -110,6 +112,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Territorial Widget")
     int32 MaxTerritoriesToShow = 8;
 
+    // Off by default; the heatmap costs a full-grid rebuild and texture upload whenever the map changes
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Territorial Widget")
+    bool bShowInfluenceHeatmap = false;
+
     // Faction color mapping
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Faction Colors")
     TMap<int32, FLinearColor> FactionColorMap;
@@ -121,6 +127,10 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Territorial Data")
     FTerritorialDisplayData CurrentPlayerTerritory;
 
+    // One texel per influence-map cell, coloured by the locally dominant faction
+    UPROPERTY(BlueprintReadOnly, Category = "Territorial Data")
+    class UTexture2D* InfluenceHeatmap = nullptr;
+
     // Events
     UPROPERTY(BlueprintAssignable, Category = "Territorial Events")
     FOnTerritorialDisplayUpdate OnTerritorialDisplayUpdate;
@@ -141,6 +151,12 @@ protected:
     UFUNCTION(BlueprintImplementableEvent, Category = "Territorial Widget")
     void OnTerritorialDataUpdated(const TArray<FTerritorialDisplayData>& NewTerritorialData);
 
+    UFUNCTION(BlueprintCallable, Category = "Territorial Widget")
+    void RefreshInfluenceHeatmap();
+
+    UFUNCTION(BlueprintImplementableEvent, Category = "Territorial Widget")
+    void OnInfluenceHeatmapUpdated(class UTexture2D* Heatmap);
+
     UFUNCTION(BlueprintImplementableEvent, Category = "Territorial Widget")
     void OnTerritoryControlChanged(const FTerritorialDisplayData& TerritoryData);
 
@@ -223,6 +239,13 @@ private:
     // Siege display data
     FSiegeDisplayData CurrentSiegeData;
 
+    // Uploaded straight from HeatmapPixels; the render thread reads both until the pending flag clears
+    TArray<FColor> HeatmapPixels;
+    FUpdateTextureRegion2D HeatmapRegion;
+    TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> bHeatmapUploadPending = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+    uint32 UploadedHeatmapRevision = 0;
+    bool bHeatmapUploaded = false;
+
     // Internal data processing
     void InitializeFactionColors();
     void GetPlayerCurrentTerritory();
@@ -6,6 +6,6 @@ public class TGUI : ModuleRules
     {
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
     PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "UMG", "Slate", "SlateCore", "EnhancedInput", "TGCombat", "TGTerritorial", "TGWorld", "TGCore" });
-        PrivateDependencyModuleNames.AddRange(new string[] { });
+        PrivateDependencyModuleNames.AddRange(new string[] { "RenderCore", "RHI" });
     }
 }
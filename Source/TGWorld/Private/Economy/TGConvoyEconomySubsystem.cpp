@@ -7,6 +7,176 @@
 #include "Algo/MinElement.h"
 #include "Misc/CString.h"
 
+DECLARE_CYCLE_STAT(TEXT("TG Convoy Route Work"), STAT_TGConvoyRouteWork, STATGROUP_Game);
+
+struct UTGConvoyEconomySubsystem::FRouteGenerationJob
+{
+    struct FResult
+    {
+        TArray<int32> Path;   // Prefilled from the path cache, or found by the job
+        float PathCost = 0.0f;
+        bool bSearched = false; // Path came from a search and should be cached on commit
+        bool bSuccess = false;
+        FConvoyRoute Route;
+    };
+
+    TSharedRef<const FTGConvoyRouteGraph, ESPMode::ThreadSafe> Graph;
+    int32 GraphVersion = 0;
+    int32 FactionId = INDEX_NONE; // INDEX_NONE for a single GenerateRoutesBetweenTerritories request
+    uint32 Serial = 0;
+    int32 Retry = 0; // Earlier runs of these requests overtaken by graph changes
+    TArray<FRouteGenerationParameters> Requests;
+    TArray<FResult> Results;
+    bool bCancelled = false;
+
+    explicit FRouteGenerationJob(const TSharedRef<const FTGConvoyRouteGraph, ESPMode::ThreadSafe>& InGraph)
+        : Graph(InGraph)
+    {
+    }
+};
+
+// Territories closer than this multiple of the larger influence radius are directly connected
+static constexpr float DirectConnectionRadiusScale = 1.5f;
+
+// Route scoring reads only the graph, so generation jobs can run it on a snapshot
+namespace TGConvoyRouteScoring
+{
+    // Connection security from the control state of both endpoints
+    static float ScoreConnection(const FTGConvoyRouteGraph& Graph, int32 FromNode, int32 ToNode)
+    {
+        const int32 FromController = Graph.GetController(FromNode);
+        const int32 ToController = Graph.GetController(ToNode);
+        
+        // Calculate security based on territorial control
+        float SecurityLevel = 1.0f;
+        
+        // Reduce security for contested territories
+        if (Graph.IsContested(FromNode) || Graph.IsContested(ToNode))
+        {
+            SecurityLevel *= 0.3f;
+        }
+        
+        // Reduce security for connections between different factions
+        if (FromController != ToController && FromController != 0 && ToController != 0)
+        {
+            SecurityLevel *= 0.1f; // Very dangerous to cross faction lines
+        }
+        
+        // Bonus security for same-faction controlled territories
+        if (FromController == ToController && FromController != 0)
+        {
+            SecurityLevel *= 1.2f;
+        }
+        
+        return FMath::Clamp(SecurityLevel, 0.0f, 1.0f);
+    }
+    
+    static float ScoreSecurity(const FTGConvoyRouteGraph& Graph, const TArray<int32>& TerritorialPath)
+    {
+        if (TerritorialPath.Num() < 2)
+        {
+            return 0.0f;
+        }
+        
+        float TotalSecurity = 0.0f;
+        int32 ConnectionCount = 0;
+        
+        // Calculate average security of all connections in path
+        for (int32 i = 0; i < TerritorialPath.Num() - 1; i++)
+        {
+            const int32 FromNode = Graph.FindNode(TerritorialPath[i]);
+            const int32 ToNode = Graph.FindNode(TerritorialPath[i + 1]);
+            const int32 Edge = (FromNode != INDEX_NONE && ToNode != INDEX_NONE) ? Graph.FindEdge(FromNode, ToNode) : INDEX_NONE;
+            if (Edge != INDEX_NONE)
+            {
+                TotalSecurity += Graph.GetEdgeSecurity(Edge);
+                ConnectionCount++;
+            }
+        }
+        
+        return ConnectionCount > 0 ? (TotalSecurity / ConnectionCount) : 0.0f;
+    }
+
+    static float ScoreProfitability(const FTGConvoyRouteGraph& Graph, const TArray<int32>& TerritorialPath, float TotalDistance, float SecurityRating)
+    {
+        if (TerritorialPath.Num() < 2)
+        {
+            return 0.0f;
+        }
+        
+        float BaseProfitability = 1.0f;
+        
+        // Calculate profitability based on route characteristics
+        float DistanceFactor = FMath::Clamp(10000.0f / FMath::Max(TotalDistance, 1.0f), 0.1f, 2.0f);
+        float SecurityFactor = SecurityRating * 2.0f;
+        
+        // Strategic value bonus for connecting high-value territories
+        float StrategicValueBonus = 0.0f;
+        for (int32 TerritoryId : TerritorialPath)
+        {
+            const int32 Node = Graph.FindNode(TerritoryId);
+            if (Node != INDEX_NONE)
+            {
+                StrategicValueBonus += Graph.GetStrategicWeight(Node);
+            }
+        }
+        StrategicValueBonus /= TerritorialPath.Num(); // Average strategic value
+        
+        float TotalProfitability = BaseProfitability * DistanceFactor * SecurityFactor * (1.0f + StrategicValueBonus * 0.1f);
+        
+        return FMath::Clamp(TotalProfitability, 0.0f, 10.0f);
+    }
+
+    // Everything but RouteId and RouteHash; false if the path is too short or the route is not secure enough
+    static bool BuildRoute(const FTGConvoyRouteGraph& Graph, const FRouteGenerationParameters& Parameters, const TArray<int32>& Path, FConvoyRoute& OutRoute)
+    {
+        if (Path.Num() < 2)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("No viable path found between territories %d and %d"), 
+                   Parameters.SourceTerritoryId, Parameters.DestinationTerritoryId);
+            return false;
+        }
+        
+        OutRoute.RouteName = FString::Printf(TEXT("Route_%d_%d_to_%d"), 
+                                           Parameters.RequestingFactionId,
+                                           Parameters.SourceTerritoryId, 
+                                           Parameters.DestinationTerritoryId);
+        OutRoute.TerritorialPath = Path;
+        OutRoute.ControllingFactionId = Parameters.RequestingFactionId;
+        OutRoute.LastValidated = FDateTime::Now();
+        
+        // Generate waypoints from territorial path before scoring, profitability depends on distance
+        OutRoute.Waypoints.Reset(Path.Num());
+        OutRoute.TotalDistance = 0.0f;
+        for (int32 i = 0; i < Path.Num(); i++)
+        {
+            const int32 Node = Graph.FindNode(Path[i]);
+            const FVector2D Center = Node != INDEX_NONE ? Graph.GetCenter(Node) : FVector2D::ZeroVector;
+            OutRoute.Waypoints.Add(FVector(Center.X, Center.Y, 0.0f));
+            
+            if (i > 0)
+            {
+                OutRoute.TotalDistance += FVector::Distance(OutRoute.Waypoints[i - 1], OutRoute.Waypoints[i]);
+            }
+        }
+        
+        // Calculate route metrics
+        OutRoute.SecurityRating = ScoreSecurity(Graph, Path);
+        OutRoute.ProfitabilityScore = ScoreProfitability(Graph, Path, OutRoute.TotalDistance, OutRoute.SecurityRating);
+        
+        // Validate route meets security threshold
+        if (OutRoute.SecurityRating < Parameters.MinSecurityThreshold)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Route security %.2f below threshold %.2f"), 
+                   OutRoute.SecurityRating, Parameters.MinSecurityThreshold);
+            return false;
+        }
+        
+        OutRoute.bIsActive = true;
+        return true;
+    }
+}
+
 UTGConvoyEconomySubsystem::UTGConvoyEconomySubsystem()
     : IntegrityIndex(0.5f)
     , TerritorialManager(nullptr)
@@ -18,10 +188,10 @@ void UTGConvoyEconomySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     
-    // Get reference to territorial manager
+    // Get reference to territorial manager, initialized first so its territories seed the connections
     if (UWorld* World = GetWorld())
     {
-        TerritorialManager = World->GetSubsystem<UTGTerritorialManager>();
+        TerritorialManager = Collection.InitializeDependency<UTGTerritorialManager>();
         if (TerritorialManager)
         {
             // Bind to territorial events for real-time route adaptation
@@ -63,16 +233,27 @@ void UTGConvoyEconomySubsystem::Deinitialize()
     FScopeLock Lock(&RouteDataMutex);
     FactionRouteCache.Empty();
     RouteHashToIdCache.Empty();
-    TerritorialConnections.Empty();
+    TerritoryRouteIndex.Empty();
+    RouteScoreCache.Empty();
+    PathCache.Reset();
+    PendingPathRecomputes.Empty();
+    PendingFactionRegenerations.Empty();
+    FactionJobSerials.Empty();
+    FactionJobRetries.Empty();
+    
+    // Running generation jobs keep their own graph reference and stop at the version bump
+    RouteGraph = MakeShared<FTGConvoyRouteGraph, ESPMode::ThreadSafe>();
+    RouteGraphVersion->Increment();
+    ++ConnectionSetVersion;
+    OnConnectionSecurityChanged.Clear();
     
     Super::Deinitialize();
 }
 
 void UTGConvoyEconomySubsystem::ApplyConvoyOutcome(float Delta, FName RouteId, EJobType JobType, bool bSuccess)
 {
-    const float SignedDelta = bSuccess ? FMath::Abs(Delta) : -FMath::Abs(Delta);
     const float Old = IntegrityIndex;
-    IntegrityIndex = FMath::Clamp(IntegrityIndex + SignedDelta, 0.f, 1.f);
+    IntegrityIndex = ApplyConvoyOutcomeToIntegrity(IntegrityIndex, Delta, bSuccess);
     
     // Update route performance metrics
     if (!RouteId.IsNone())
@@ -102,25 +283,151 @@ void UTGConvoyEconomySubsystem::SetIntegrityIndex(float NewValue)
 
 void UTGConvoyEconomySubsystem::AdvanceDecay(float DeltaSeconds)
 {
-    if (DecayHalfLifeSeconds <= 0.f)
+    if (!bEnableIntegrityDecay || IntegrityDecayHalfLifeSeconds <= 0.f)
     {
         return;
     }
-    const float Lambda = FMath::Loge(2.0f) / DecayHalfLifeSeconds;
     const float Old = IntegrityIndex;
-    IntegrityIndex = Equilibrium + (IntegrityIndex - Equilibrium) * FMath::Exp(-Lambda * DeltaSeconds);
+    IntegrityIndex = DecayIntegrity(IntegrityIndex, IntegrityEquilibrium, IntegrityDecayHalfLifeSeconds, DeltaSeconds);
     if (!FMath::IsNearlyEqual(Old, IntegrityIndex))
     {
         BroadcastChange(Old, IntegrityIndex);
     }
 }
 
+float UTGConvoyEconomySubsystem::ApplyConvoyOutcomeToIntegrity(float Integrity, float Delta, bool bSuccess)
+{
+    const float SignedDelta = bSuccess ? FMath::Abs(Delta) : -FMath::Abs(Delta);
+    return FMath::Clamp(Integrity + SignedDelta, 0.f, 1.f);
+}
+
+float UTGConvoyEconomySubsystem::DecayIntegrity(float Integrity, float EquilibriumValue, float HalfLife, float Elapsed)
+{
+    if (HalfLife <= 0.f)
+    {
+        return Integrity;
+    }
+    
+    // Exponential relaxation towards equilibrium
+    const float Lambda = FMath::Loge(2.0f) / HalfLife;
+    return EquilibriumValue + (Integrity - EquilibriumValue) * FMath::Exp(-Lambda * Elapsed);
+}
+
 void UTGConvoyEconomySubsystem::BroadcastChange(float OldIndex, float NewIndex)
 {
     const float Delta = NewIndex - OldIndex;
     OnIntegrityIndexChanged.Broadcast(NewIndex, Delta);
 }
 
+void UTGConvoyEconomySubsystem::RegisterConvoyRoute(const FConvoyRoute& Route)
+{
+    if (Route.RouteId.IsNone())
+    {
+        return;
+    }
+    
+    FScopeLock Lock(&RouteDataMutex);
+    
+    // Re-registering replaces the old path in the territory index
+    RemoveRouteLocked(Route.RouteId);
+    
+    RegisteredRoutes.Add(Route.RouteId, Route);
+    if (Route.RouteHash != 0)
+    {
+        RouteHashToIdCache.Add(Route.RouteHash, Route.RouteId);
+    }
+    FactionRouteCache.FindOrAdd(Route.ControllingFactionId).AddUnique(Route.RouteId);
+    IndexRouteTerritories(Route);
+}
+
+void UTGConvoyEconomySubsystem::RemoveConvoyRoute(FName RouteId)
+{
+    FScopeLock Lock(&RouteDataMutex);
+    RemoveRouteLocked(RouteId);
+}
+
+void UTGConvoyEconomySubsystem::RemoveRouteLocked(FName RouteId)
+{
+    const FConvoyRoute* Route = RegisteredRoutes.Find(RouteId);
+    if (!Route)
+    {
+        return;
+    }
+    
+    // Remove from hash cache, unless another route has since taken the hash
+    if (const FName* HashedRouteId = RouteHashToIdCache.Find(Route->RouteHash))
+    {
+        if (*HashedRouteId == RouteId)
+        {
+            RouteHashToIdCache.Remove(Route->RouteHash);
+        }
+    }
+    
+    // Remove from faction cache
+    if (TArray<FName>* FactionRoutes = FactionRouteCache.Find(Route->ControllingFactionId))
+    {
+        FactionRoutes->Remove(RouteId);
+    }
+    
+    UnindexRouteTerritories(*Route);
+    RouteScoreCache.Remove(RouteId);
+    
+    // Remove from main registry
+    RegisteredRoutes.Remove(RouteId);
+}
+
+void UTGConvoyEconomySubsystem::IndexRouteTerritories(const FConvoyRoute& Route)
+{
+    ++RouteSetVersion;
+    for (const int32 TerritoryId : Route.TerritorialPath)
+    {
+        TerritoryRouteIndex.FindOrAdd(TerritoryId).AddUnique(Route.RouteId);
+    }
+}
+
+void UTGConvoyEconomySubsystem::UnindexRouteTerritories(const FConvoyRoute& Route)
+{
+    ++RouteSetVersion;
+    for (const int32 TerritoryId : Route.TerritorialPath)
+    {
+        if (TArray<FName>* RouteIds = TerritoryRouteIndex.Find(TerritoryId))
+        {
+            RouteIds->RemoveSingleSwap(Route.RouteId, EAllowShrinking::No);
+            if (RouteIds->Num() == 0)
+            {
+                TerritoryRouteIndex.Remove(TerritoryId);
+            }
+        }
+    }
+}
+
+const UTGConvoyEconomySubsystem::FRouteScores& UTGConvoyEconomySubsystem::GetRouteScoresLocked(const FConvoyRoute& Route)
+{
+    if (const FRouteScores* Scores = RouteScoreCache.Find(Route.RouteId))
+    {
+        return *Scores;
+    }
+    
+    FRouteScores Scores;
+    Scores.SecurityRating = CalculateRouteSecurityRating(Route.TerritorialPath);
+    Scores.ProfitabilityScore = TGConvoyRouteScoring::ScoreProfitability(*RouteGraph, Route.TerritorialPath, Route.TotalDistance, Scores.SecurityRating);
+    return RouteScoreCache.Add(Route.RouteId, Scores);
+}
+
+void UTGConvoyEconomySubsystem::InvalidateRouteScores(int32 TerritoryId)
+{
+    FScopeLock Lock(&RouteDataMutex);
+    
+    // Scores read only the path's own territories and the connections between them
+    if (const TArray<FName>* RouteIds = TerritoryRouteIndex.Find(TerritoryId))
+    {
+        for (const FName& RouteId : *RouteIds)
+        {
+            RouteScoreCache.Remove(RouteId);
+        }
+    }
+}
+
 // Dynamic Route Generation - Performance Critical Implementation
 void UTGConvoyEconomySubsystem::GenerateRoutesBetweenTerritories(const FRouteGenerationParameters& Parameters)
 {
@@ -146,6 +453,12 @@ void UTGConvoyEconomySubsystem::GenerateRoutesBetweenTerritories(const FRouteGen
         }
     }
     
+    if (bEnableAsyncRouteGeneration)
+    {
+        DispatchRouteGenerationJob(INDEX_NONE, {Parameters});
+        return;
+    }
+    
     // Find optimal path using A* with territorial considerations
     TArray<int32> OptimalPath = FindOptimalPath(
         Parameters.SourceTerritoryId,
@@ -154,87 +467,53 @@ void UTGConvoyEconomySubsystem::GenerateRoutesBetweenTerritories(const FRouteGen
         Parameters.MaxHops
     );
     
-    if (OptimalPath.Num() < 2)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("No viable path found between territories %d and %d"), 
-               Parameters.SourceTerritoryId, Parameters.DestinationTerritoryId);
-        OnRouteGenerated.Broadcast(NAME_None, false);
-        return;
-    }
-    
     // Create new route with performance metrics
     FConvoyRoute NewRoute;
-    NewRoute.RouteId = GenerateUniqueRouteId(Parameters.RequestingFactionId, 
-                                           Parameters.SourceTerritoryId, 
-                                           Parameters.DestinationTerritoryId);
-    NewRoute.RouteName = FString::Printf(TEXT("Route_%d_%d_to_%d"), 
-                                       Parameters.RequestingFactionId,
-                                       Parameters.SourceTerritoryId, 
-                                       Parameters.DestinationTerritoryId);
-    NewRoute.TerritorialPath = OptimalPath;
-    NewRoute.ControllingFactionId = Parameters.RequestingFactionId;
-    NewRoute.RouteHash = RouteHash;
-    NewRoute.LastValidated = FDateTime::Now();
-    
-    // Calculate route metrics
-    NewRoute.SecurityRating = CalculateRouteSecurityRating(OptimalPath);
-    NewRoute.ProfitabilityScore = CalculateRouteProfitability(NewRoute);
-    
-    // Validate route meets security threshold
-    if (NewRoute.SecurityRating < Parameters.MinSecurityThreshold)
+    if (!TGConvoyRouteScoring::BuildRoute(*RouteGraph, Parameters, OptimalPath, NewRoute))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Route security %.2f below threshold %.2f"), 
-               NewRoute.SecurityRating, Parameters.MinSecurityThreshold);
         OnRouteGenerated.Broadcast(NAME_None, false);
         return;
     }
     
-    // Generate waypoints from territorial path
-    NewRoute.Waypoints.Empty();
-    NewRoute.TotalDistance = 0.0f;
-    
-    for (int32 i = 0; i < OptimalPath.Num(); i++)
-    {
-        FTGTerritoryData TerritoryData = TerritorialManager->GetTerritoryData(OptimalPath[i]);
-        FVector TerritoryCenter(TerritoryData.Bounds.CenterPoint.X, TerritoryData.Bounds.CenterPoint.Y, 0.0f);
-        NewRoute.Waypoints.Add(TerritoryCenter);
-        
-        if (i > 0)
-        {
-            float SegmentDistance = FVector::Distance(
-                NewRoute.Waypoints[i-1], 
-                NewRoute.Waypoints[i]
-            );
-            NewRoute.TotalDistance += SegmentDistance;
-        }
-    }
-    
-    NewRoute.bIsActive = true;
+    NewRoute.RouteHash = RouteHash;
+    RegisterGeneratedRoute(NewRoute);
+}
+
+bool UTGConvoyEconomySubsystem::RegisterGeneratedRoute(FConvoyRoute& Route)
+{
+    Route.RouteId = GenerateUniqueRouteId(Route.ControllingFactionId, 
+                                          Route.TerritorialPath[0], 
+                                          Route.TerritorialPath.Last());
     
     // Thread-safe route registration
     {
         FScopeLock Lock(&RouteDataMutex);
         
         // Check faction route limits
-        TArray<FName>& FactionRoutes = FactionRouteCache.FindOrAdd(Parameters.RequestingFactionId);
+        TArray<FName>& FactionRoutes = FactionRouteCache.FindOrAdd(Route.ControllingFactionId);
         if (FactionRoutes.Num() >= MaxRoutesPerFaction)
         {
             UE_LOG(LogTemp, Warning, TEXT("Faction %d at route limit (%d)"), 
-                   Parameters.RequestingFactionId, MaxRoutesPerFaction);
+                   Route.ControllingFactionId, MaxRoutesPerFaction);
             OnRouteGenerated.Broadcast(NAME_None, false);
-            return;
+            return false;
         }
         
         // Register route
-        RegisteredRoutes.Add(NewRoute.RouteId, NewRoute);
-        RouteHashToIdCache.Add(RouteHash, NewRoute.RouteId);
-        FactionRoutes.Add(NewRoute.RouteId);
+        RegisteredRoutes.Add(Route.RouteId, Route);
+        RouteHashToIdCache.Add(Route.RouteHash, Route.RouteId);
+        FactionRoutes.Add(Route.RouteId);
+        IndexRouteTerritories(Route);
+        
+        // Scored against the current graph, so the scores are valid until a territory on the path changes
+        RouteScoreCache.Add(Route.RouteId, {Route.SecurityRating, Route.ProfitabilityScore});
     }
     
     UE_LOG(LogTemp, Log, TEXT("Generated route %s: Security %.2f, Profit %.2f, Distance %.0f"),
-           *NewRoute.RouteId.ToString(), NewRoute.SecurityRating, NewRoute.ProfitabilityScore, NewRoute.TotalDistance);
+           *Route.RouteId.ToString(), Route.SecurityRating, Route.ProfitabilityScore, Route.TotalDistance);
     
-    OnRouteGenerated.Broadcast(NewRoute.RouteId, true);
+    OnRouteGenerated.Broadcast(Route.RouteId, true);
+    return true;
 }
 
 void UTGConvoyEconomySubsystem::RegenerateAllFactionRoutes(int32 FactionId)
@@ -244,39 +523,47 @@ void UTGConvoyEconomySubsystem::RegenerateAllFactionRoutes(int32 FactionId)
         return;
     }
     
-    // Get all territories controlled by faction
-    TArray<FTGTerritoryData> AllTerritories = TerritorialManager->GetAllTerritories();
+    // Territories controlled by faction, as of the last connection update
+    const FTGConvoyRouteGraph& Graph = *RouteGraph;
     TArray<int32> ControlledTerritories;
-    
-    for (const FTGTerritoryData& Territory : AllTerritories)
+    for (int32 Node = 0; Node < Graph.NumNodes(); Node++)
     {
-        if (Territory.CurrentControllerFactionId == FactionId)
+        if (Graph.GetController(Node) == FactionId)
         {
-            ControlledTerritories.Add(Territory.TerritoryId);
+            ControlledTerritories.Add(Graph.GetTerritoryId(Node));
         }
     }
     
-    // Clear existing routes for faction
-    InvalidateRouteCache(FactionId);
-    
-    // Generate routes between all controlled territories
-    int32 RoutesGenerated = 0;
-    for (int32 i = 0; i < ControlledTerritories.Num() && RoutesGenerated < RouteGenerationBatchSize; i++)
+    // Routes between controlled territories, one batch per regeneration
+    TArray<FRouteGenerationParameters> Requests;
+    for (int32 i = 0; i < ControlledTerritories.Num() && Requests.Num() < RouteGenerationBatchSize; i++)
     {
-        for (int32 j = i + 1; j < ControlledTerritories.Num() && RoutesGenerated < RouteGenerationBatchSize; j++)
+        for (int32 j = i + 1; j < ControlledTerritories.Num() && Requests.Num() < RouteGenerationBatchSize; j++)
         {
-            FRouteGenerationParameters Params;
+            FRouteGenerationParameters& Params = Requests.AddDefaulted_GetRef();
             Params.RequestingFactionId = FactionId;
             Params.SourceTerritoryId = ControlledTerritories[i];
             Params.DestinationTerritoryId = ControlledTerritories[j];
             Params.MinSecurityThreshold = MinRouteSecurityThreshold;
             Params.bRequireDirectControl = false;
-            
-            GenerateRoutesBetweenTerritories(Params);
-            RoutesGenerated++;
         }
     }
     
+    // Existing routes stay live until the job's replacements are committed
+    if (bEnableAsyncRouteGeneration)
+    {
+        DispatchRouteGenerationJob(FactionId, MoveTemp(Requests));
+        return;
+    }
+    
+    // Clear existing routes for faction
+    InvalidateRouteCache(FactionId);
+    
+    for (const FRouteGenerationParameters& Params : Requests)
+    {
+        GenerateRoutesBetweenTerritories(Params);
+    }
+    
     // Update faction route statistics
     float TotalProfitability = GetFactionTotalProfitability(FactionId);
     int32 ActiveRouteCount = GetActiveRouteCount(FactionId);
@@ -284,7 +571,171 @@ void UTGConvoyEconomySubsystem::RegenerateAllFactionRoutes(int32 FactionId)
     OnRoutesUpdated.Broadcast(FactionId, ActiveRouteCount, TotalProfitability);
     
     UE_LOG(LogTemp, Log, TEXT("Regenerated %d routes for faction %d (Total Active: %d, Profit: %.2f)"),
-           RoutesGenerated, FactionId, ActiveRouteCount, TotalProfitability);
+           Requests.Num(), FactionId, ActiveRouteCount, TotalProfitability);
+}
+
+void UTGConvoyEconomySubsystem::DispatchRouteGenerationJob(int32 FactionId, TArray<FRouteGenerationParameters>&& Requests, int32 Retry)
+{
+    TSharedRef<FRouteGenerationJob, ESPMode::ThreadSafe> Job = MakeShared<FRouteGenerationJob, ESPMode::ThreadSafe>(RouteGraph);
+    Job->GraphVersion = RouteGraphVersion->GetValue();
+    Job->FactionId = FactionId;
+    Job->Serial = ++NextJobSerial;
+    Job->Retry = FactionId != INDEX_NONE ? FactionJobRetries.FindRef(FactionId) : Retry;
+    Job->Requests = MoveTemp(Requests);
+    Job->Results.SetNum(Job->Requests.Num());
+    
+    if (FactionId != INDEX_NONE)
+    {
+        FactionJobSerials.Add(FactionId, Job->Serial);
+    }
+    
+    // Fresh cached paths were found on this graph version; the job only searches the rest
+    for (int32 Index = 0; Index < Job->Requests.Num(); Index++)
+    {
+        const FRouteGenerationParameters& Params = Job->Requests[Index];
+        const FTGConvoyPathKey Key{Params.RequestingFactionId, Params.SourceTerritoryId, Params.DestinationTerritoryId};
+        if (const FTGConvoyCachedPath* Cached = PathCache.Find(Key, Params.MaxHops))
+        {
+            Job->Results[Index].Path = Cached->Path;
+        }
+    }
+    
+    InFlightRouteJobs++;
+    
+    TWeakObjectPtr<UTGConvoyEconomySubsystem> WeakThis(this);
+    TSharedRef<FThreadSafeCounter, ESPMode::ThreadSafe> Version = RouteGraphVersion;
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, Job, Version]()
+    {
+        FTGConvoyPathfinder JobPathfinder;
+        for (int32 Index = 0; Index < Job->Requests.Num(); Index++)
+        {
+            // The graph moved on; whatever is left would be committed against stale control data
+            if (Version->GetValue() != Job->GraphVersion)
+            {
+                Job->bCancelled = true;
+                break;
+            }
+            
+            const FRouteGenerationParameters& Params = Job->Requests[Index];
+            FRouteGenerationJob::FResult& Result = Job->Results[Index];
+            if (Result.Path.Num() == 0)
+            {
+                JobPathfinder.FindPath(*Job->Graph, Params.SourceTerritoryId, Params.DestinationTerritoryId, Params.RequestingFactionId, Params.MaxHops, Result.Path);
+                Result.PathCost = JobPathfinder.GetLastPathCost();
+                Result.bSearched = true;
+            }
+            Result.bSuccess = TGConvoyRouteScoring::BuildRoute(*Job->Graph, Params, Result.Path, Result.Route);
+        }
+        
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Job]()
+        {
+            if (UTGConvoyEconomySubsystem* Subsystem = WeakThis.Get())
+            {
+                Subsystem->CommitRouteGenerationJob(Job);
+            }
+        });
+    });
+}
+
+void UTGConvoyEconomySubsystem::CommitRouteGenerationJob(const TSharedRef<FRouteGenerationJob, ESPMode::ThreadSafe>& Job)
+{
+    InFlightRouteJobs--;
+    
+    // A newer regeneration for the faction was started after this one
+    const bool bFactionJob = Job->FactionId != INDEX_NONE;
+    if (bFactionJob && FactionJobSerials.FindRef(Job->FactionId) != Job->Serial)
+    {
+        return;
+    }
+    
+    // Built against an older graph; start over from the current one, unless graph changes keep
+    // overtaking these requests, in which case the paths found so far are rescored and committed
+    const bool bStale = Job->bCancelled || Job->GraphVersion != RouteGraphVersion->GetValue();
+    if (bStale && Job->Retry < MaxRouteGenerationRetries)
+    {
+        if (bFactionJob)
+        {
+            FactionJobSerials.Remove(Job->FactionId);
+            FactionJobRetries.Add(Job->FactionId, Job->Retry + 1);
+            PendingFactionRegenerations.AddUnique(Job->FactionId);
+        }
+        else
+        {
+            DispatchRouteGenerationJob(INDEX_NONE, MoveTemp(Job->Requests), Job->Retry + 1);
+        }
+        return;
+    }
+    
+    if (bFactionJob)
+    {
+        FactionJobSerials.Remove(Job->FactionId);
+        FactionJobRetries.Remove(Job->FactionId);
+        
+        // Clear existing routes for faction
+        InvalidateRouteCache(Job->FactionId);
+    }
+    
+    for (int32 Index = 0; Index < Job->Requests.Num(); Index++)
+    {
+        const FRouteGenerationParameters& Params = Job->Requests[Index];
+        FRouteGenerationJob::FResult& Result = Job->Results[Index];
+        
+        if (bStale)
+        {
+            // Requests the cancelled job never reached are searched here; the rest keep their
+            // older path, which is still a route, just scored on the current control state
+            if (Result.Path.Num() == 0 && !Result.bSearched)
+            {
+                Result.Path = FindOptimalPath(Params.SourceTerritoryId, Params.DestinationTerritoryId, Params.RequestingFactionId, Params.MaxHops);
+            }
+            Result.bSuccess = TGConvoyRouteScoring::BuildRoute(*RouteGraph, Params, Result.Path, Result.Route);
+        }
+        // Same graph version, so searched paths are as good as ones FindOptimalPath would cache
+        else if (Result.bSearched)
+        {
+            const FTGConvoyPathKey Key{Params.RequestingFactionId, Params.SourceTerritoryId, Params.DestinationTerritoryId};
+            if (Result.Path.Num() > 0)
+            {
+                PathCache.Store(Key, Params.MaxHops, Result.Path, Result.PathCost);
+            }
+            else
+            {
+                PathCache.Remove(Key);
+            }
+        }
+        
+        if (!Result.bSuccess)
+        {
+            OnRouteGenerated.Broadcast(NAME_None, false);
+            continue;
+        }
+        
+        // An identical request may have been committed while this one was running
+        Result.Route.RouteHash = GenerateRouteHash(Params);
+        if (const FName* ExistingRouteId = RouteHashToIdCache.Find(Result.Route.RouteHash))
+        {
+            const FConvoyRoute* ExistingRoute = RegisteredRoutes.Find(*ExistingRouteId);
+            if (ExistingRoute && ExistingRoute->bIsActive)
+            {
+                OnRouteGenerated.Broadcast(*ExistingRouteId, true);
+                continue;
+            }
+        }
+        
+        RegisterGeneratedRoute(Result.Route);
+    }
+    
+    if (bFactionJob)
+    {
+        // Update faction route statistics
+        float TotalProfitability = GetFactionTotalProfitability(Job->FactionId);
+        int32 ActiveRouteCount = GetActiveRouteCount(Job->FactionId);
+        
+        OnRoutesUpdated.Broadcast(Job->FactionId, ActiveRouteCount, TotalProfitability);
+        
+        UE_LOG(LogTemp, Log, TEXT("Regenerated %d routes for faction %d (Total Active: %d, Profit: %.2f)"),
+               Job->Requests.Num(), Job->FactionId, ActiveRouteCount, TotalProfitability);
+    }
 }
 
 void UTGConvoyEconomySubsystem::InvalidateRoutesInTerritory(int32 TerritoryId)
@@ -295,12 +746,15 @@ void UTGConvoyEconomySubsystem::InvalidateRoutesInTerritory(int32 TerritoryId)
         FScopeLock Lock(&RouteDataMutex);
         
         // Find all routes passing through this territory
-        for (auto& RouteEntry : RegisteredRoutes)
+        if (const TArray<FName>* RouteIds = TerritoryRouteIndex.Find(TerritoryId))
         {
-            FConvoyRoute& Route = RouteEntry.Value;
-            if (Route.TerritorialPath.Contains(TerritoryId) && Route.bIsActive)
+            for (const FName& RouteId : *RouteIds)
             {
-                RoutesToInvalidate.Add(Route.RouteId);
+                const FConvoyRoute* Route = RegisteredRoutes.Find(RouteId);
+                if (Route && Route->bIsActive)
+                {
+                    RoutesToInvalidate.Add(RouteId);
+                }
             }
         }
         
@@ -330,6 +784,9 @@ void UTGConvoyEconomySubsystem::InvalidateRoutesInTerritory(int32 TerritoryId)
         OnRouteInvalidated.Broadcast(RouteId, FString::Printf(TEXT("Territory %d control changed"), TerritoryId));
     }
     
+    LastInvalidatedRouteCount = RoutesToInvalidate.Num();
+    TotalInvalidatedRouteCount += RoutesToInvalidate.Num();
+    
     UE_LOG(LogTemp, Log, TEXT("Invalidated %d routes in territory %d"), RoutesToInvalidate.Num(), TerritoryId);
 }
 
@@ -350,6 +807,16 @@ TArray<FConvoyRoute> UTGConvoyEconomySubsystem::GetActiveRoutes() const
     return ActiveRoutes;
 }
 
+void UTGConvoyEconomySubsystem::ForEachRoute(TFunctionRef<void(const FConvoyRoute&)> Visitor) const
+{
+    FScopeLock Lock(&RouteDataMutex);
+    
+    for (const auto& RouteEntry : RegisteredRoutes)
+    {
+        Visitor(RouteEntry.Value);
+    }
+}
+
 float UTGConvoyEconomySubsystem::GetFactionTotalProfitability(int32 FactionId) const
 {
     FScopeLock Lock(&RouteDataMutex);
@@ -397,6 +864,17 @@ int32 UTGConvoyEconomySubsystem::GetActiveRouteCount(int32 FactionId) const
 }
 
 // Performance-Critical Route Calculation Functions
+FTGConvoyRouteGraph& UTGConvoyEconomySubsystem::GetMutableRouteGraph()
+{
+    // Generation jobs may still be reading the current graph; write to a copy instead
+    if (!RouteGraph.IsUnique())
+    {
+        RouteGraph = MakeShared<FTGConvoyRouteGraph, ESPMode::ThreadSafe>(*RouteGraph);
+    }
+    RouteGraphVersion->Increment();
+    return *RouteGraph;
+}
+
 void UTGConvoyEconomySubsystem::InitializeTerritorialConnections()
 {
     if (!TerritorialManager)
@@ -405,49 +883,176 @@ void UTGConvoyEconomySubsystem::InitializeTerritorialConnections()
     }
     
     TArray<FTGTerritoryData> AllTerritories = TerritorialManager->GetAllTerritories();
+    const int32 NumTerritories = AllTerritories.Num();
     
-    // Clear existing connections
-    TerritorialConnections.Empty();
+    // Build into a fresh graph; cached paths refer to the old one
+    TSharedRef<FTGConvoyRouteGraph, ESPMode::ThreadSafe> NewGraph = MakeShared<FTGConvoyRouteGraph, ESPMode::ThreadSafe>();
+    PathCache.Reset();
+    PendingPathRecomputes.Reset();
     
-    // Calculate connections between all territories (adjacency matrix approach)
-    for (int32 i = 0; i < AllTerritories.Num(); i++)
+    float CellSize = 1.0f;
+    for (const FTGTerritoryData& Territory : AllTerritories)
+    {
+        const int32 Node = NewGraph->AddNode(Territory.TerritoryId, Territory.Bounds.CenterPoint, Territory.CurrentControllerFactionId,
+                                             Territory.StrategicValue * Territory.ResourceMultiplier);
+        NewGraph->SetContested(Node, Territory.bContested);
+        CellSize = FMath::Max(CellSize, Territory.Bounds.InfluenceRadius * DirectConnectionRadiusScale);
+    }
+    
+    // Bucket territories into a grid no finer than the largest connection range, so every
+    // connection candidate lies in the same or one of the eight surrounding cells
+    auto GetCell = [CellSize](const FVector2D& Point)
+    {
+        return FIntPoint(FMath::FloorToInt(Point.X / CellSize), FMath::FloorToInt(Point.Y / CellSize));
+    };
+    
+    TMap<FIntPoint, TArray<int32>> Cells;
+    for (int32 i = 0; i < NumTerritories; i++)
+    {
+        Cells.FindOrAdd(GetCell(AllTerritories[i].Bounds.CenterPoint)).Add(i);
+    }
+    
+    // Clusters of connected territories, as a union-find over graph nodes
+    TArray<int32> ClusterParents;
+    ClusterParents.SetNumUninitialized(NumTerritories);
+    for (int32 i = 0; i < NumTerritories; i++)
+    {
+        ClusterParents[i] = i;
+    }
+    auto FindCluster = [&ClusterParents](int32 Node)
+    {
+        while (ClusterParents[Node] != Node)
+        {
+            ClusterParents[Node] = ClusterParents[ClusterParents[Node]];
+            Node = ClusterParents[Node];
+        }
+        return Node;
+    };
+    int32 NumClusters = NumTerritories;
+    
+    // Connect territories with overlapping influence; AllTerritories index == graph node index
+    for (int32 i = 0; i < NumTerritories; i++)
     {
         const FTGTerritoryData& TerritoryA = AllTerritories[i];
-        TMap<int32, FTerritorialConnection>& ConnectionsFromA = TerritorialConnections.FindOrAdd(TerritoryA.TerritoryId);
+        const FIntPoint Cell = GetCell(TerritoryA.Bounds.CenterPoint);
         
-        for (int32 j = i + 1; j < AllTerritories.Num(); j++)
+        for (int32 DY = -1; DY <= 1; DY++)
         {
-            const FTGTerritoryData& TerritoryB = AllTerritories[j];
-            
-            // Calculate distance between territory centers
-            float Distance = FVector2D::Distance(TerritoryA.Bounds.CenterPoint, TerritoryB.Bounds.CenterPoint);
-            
-            // Check if territories are adjacent (overlapping influence radius)
-            float MaxConnectionDistance = FMath::Max(TerritoryA.Bounds.InfluenceRadius, TerritoryB.Bounds.InfluenceRadius) * 1.5f;
-            bool bDirectConnection = Distance <= MaxConnectionDistance;
-            
-            // Create bidirectional connections
-            FTerritorialConnection ConnectionAB;
-            ConnectionAB.FromTerritoryId = TerritoryA.TerritoryId;
-            ConnectionAB.ToTerritoryId = TerritoryB.TerritoryId;
-            ConnectionAB.Distance = Distance;
-            ConnectionAB.bDirectConnection = bDirectConnection;
-            ConnectionAB.SecurityLevel = 0.5f; // Default security, updated dynamically
-            
-            FTerritorialConnection ConnectionBA;
-            ConnectionBA.FromTerritoryId = TerritoryB.TerritoryId;
-            ConnectionBA.ToTerritoryId = TerritoryA.TerritoryId;
-            ConnectionBA.Distance = Distance;
-            ConnectionBA.bDirectConnection = bDirectConnection;
-            ConnectionBA.SecurityLevel = 0.5f;
+            for (int32 DX = -1; DX <= 1; DX++)
+            {
+                const TArray<int32>* Candidates = Cells.Find(Cell + FIntPoint(DX, DY));
+                if (!Candidates)
+                {
+                    continue;
+                }
+                
+                for (const int32 j : *Candidates)
+                {
+                    // Each pair once
+                    if (j <= i)
+                    {
+                        continue;
+                    }
+                    
+                    const FTGTerritoryData& TerritoryB = AllTerritories[j];
+                    const float Distance = FVector2D::Distance(TerritoryA.Bounds.CenterPoint, TerritoryB.Bounds.CenterPoint);
+                    const float MaxConnectionDistance = FMath::Max(TerritoryA.Bounds.InfluenceRadius, TerritoryB.Bounds.InfluenceRadius) * DirectConnectionRadiusScale;
+                    if (Distance <= MaxConnectionDistance)
+                    {
+                        NewGraph->AddEdge(i, j, Distance, true);
+                        NewGraph->AddEdge(j, i, Distance, true);
+                        
+                        const int32 ClusterA = FindCluster(i);
+                        const int32 ClusterB = FindCluster(j);
+                        if (ClusterA != ClusterB)
+                        {
+                            ClusterParents[ClusterB] = ClusterA;
+                            NumClusters--;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    
+    // Every territory must stay reachable from every other, so each round links every cluster to
+    // its nearest other cluster with an indirect connection; an isolated territory is a cluster of
+    // one, and each round at least halves the cluster count
+    TArray<int32> NearestFrom;
+    TArray<int32> NearestTo;
+    TArray<float> NearestDistSquared;
+    while (NumClusters > 1)
+    {
+        NearestFrom.Init(INDEX_NONE, NumTerritories);
+        NearestTo.Init(INDEX_NONE, NumTerritories);
+        NearestDistSquared.Init(MAX_flt, NumTerritories);
+        for (int32 i = 0; i < NumTerritories; i++)
+        {
+            const int32 ClusterA = FindCluster(i);
+            for (int32 j = i + 1; j < NumTerritories; j++)
+            {
+                const int32 ClusterB = FindCluster(j);
+                if (ClusterA == ClusterB)
+                {
+                    continue;
+                }
+                
+                const float DistSquared = FVector2D::DistSquared(AllTerritories[i].Bounds.CenterPoint, AllTerritories[j].Bounds.CenterPoint);
+                if (DistSquared < NearestDistSquared[ClusterA])
+                {
+                    NearestFrom[ClusterA] = i;
+                    NearestTo[ClusterA] = j;
+                    NearestDistSquared[ClusterA] = DistSquared;
+                }
+                if (DistSquared < NearestDistSquared[ClusterB])
+                {
+                    NearestFrom[ClusterB] = j;
+                    NearestTo[ClusterB] = i;
+                    NearestDistSquared[ClusterB] = DistSquared;
+                }
+            }
+        }
+        
+        for (int32 Cluster = 0; Cluster < NumTerritories; Cluster++)
+        {
+            // Two clusters that are each other's nearest would otherwise be linked twice
+            const int32 From = NearestFrom[Cluster];
+            const int32 To = NearestTo[Cluster];
+            if (From == INDEX_NONE || FindCluster(From) == FindCluster(To))
+            {
+                continue;
+            }
             
-            ConnectionsFromA.Add(TerritoryB.TerritoryId, ConnectionAB);
-            TerritorialConnections.FindOrAdd(TerritoryB.TerritoryId).Add(TerritoryA.TerritoryId, ConnectionBA);
+            const float Distance = FMath::Sqrt(NearestDistSquared[Cluster]);
+            NewGraph->AddEdge(From, To, Distance, false);
+            NewGraph->AddEdge(To, From, Distance, false);
+            ClusterParents[FindCluster(To)] = FindCluster(From);
+            NumClusters--;
         }
     }
     
+    NewGraph->Finalize();
+    
+    // Initial security from the control state captured above
+    for (int32 FromNode = 0; FromNode < NewGraph->NumNodes(); FromNode++)
+    {
+        for (int32 Edge = NewGraph->GetEdgeBegin(FromNode); Edge < NewGraph->GetEdgeEnd(FromNode); Edge++)
+        {
+            NewGraph->SetEdgeSecurity(Edge, TGConvoyRouteScoring::ScoreConnection(*NewGraph, FromNode, NewGraph->GetEdgeTarget(Edge)));
+        }
+    }
+    
+    RouteGraph = NewGraph;
+    RouteGraphVersion->Increment();
+    ++ConnectionSetVersion;
+    
+    {
+        FScopeLock Lock(&RouteDataMutex);
+        RouteScoreCache.Reset();
+    }
+    
     UE_LOG(LogTemp, Log, TEXT("Initialized territorial connections: %d territories, %d total connections"),
-           AllTerritories.Num(), TerritorialConnections.Num());
+           RouteGraph->NumNodes(), RouteGraph->NumEdges());
 }
 
 void UTGConvoyEconomySubsystem::UpdateTerritorialConnections()
@@ -457,45 +1062,90 @@ void UTGConvoyEconomySubsystem::UpdateTerritorialConnections()
         return;
     }
     
-    // Update security levels for all connections based on current territorial control
-    for (auto& TerritoryConnectionsEntry : TerritorialConnections)
+    // Periodic resync for changes that arrived without an event, economic attributes included;
+    // only territories whose control state or strategic weight differs touch the graph
+    LastConnectionUpdateEdgeCount = 0;
+    const int32 NumNodes = RouteGraph->NumNodes();
+    for (int32 Node = 0; Node < NumNodes; Node++)
+    {
+        LastConnectionUpdateEdgeCount += RefreshTerritoryConnections(RouteGraph->GetTerritoryId(Node), true);
+    }
+}
+
+int32 UTGConvoyEconomySubsystem::RefreshTerritoryConnections(int32 TerritoryId, bool bRefreshAttributes)
+{
+    const int32 Node = RouteGraph->FindNode(TerritoryId);
+    if (!TerritorialManager || Node == INDEX_NONE)
+    {
+        return 0;
+    }
+    
+    int32 Controller = 0;
+    bool bContested = false;
+    float StrategicWeight = RouteGraph->GetStrategicWeight(Node);
+    if (bRefreshAttributes)
+    {
+        // One locked copy per territory event; scoring then reads the graph's packed attributes
+        const FTGTerritoryData TerritoryData = TerritorialManager->GetTerritoryData(TerritoryId);
+        Controller = TerritoryData.CurrentControllerFactionId;
+        bContested = TerritoryData.bContested;
+        StrategicWeight = TerritoryData.StrategicValue * TerritoryData.ResourceMultiplier;
+    }
+    else
+    {
+        Controller = TerritorialManager->GetControllingFaction(TerritoryId);
+        bContested = TerritorialManager->IsTerritoryContested(TerritoryId);
+    }
+    
+    const bool bWeightChanged = RouteGraph->GetStrategicWeight(Node) != StrategicWeight;
+    const bool bControlChanged = RouteGraph->GetController(Node) != Controller || RouteGraph->IsContested(Node) != bContested;
+    if (!bWeightChanged && !bControlChanged)
     {
-        int32 FromTerritoryId = TerritoryConnectionsEntry.Key;
-        int32 FromController = TerritorialManager->GetControllingFaction(FromTerritoryId);
-        bool bFromContested = TerritorialManager->IsTerritoryContested(FromTerritoryId);
+        return 0;
+    }
+    
+    // Only copy and re-version the graph when something actually changed, so routine refreshes
+    // do not cancel generation jobs
+    FTGConvoyRouteGraph& Graph = GetMutableRouteGraph();
+    Graph.SetStrategicWeight(Node, StrategicWeight);
+    InvalidateRouteScores(TerritoryId);
+    if (!bControlChanged)
+    {
+        return 0;
+    }
+    
+    const int32 PreviousController = Graph.GetController(Node);
+    Graph.SetController(Node, Controller);
+    Graph.SetContested(Node, bContested);
+    
+    // Security depends only on the endpoints, so just the connections to and from this territory change
+    int32 EdgesTouched = 0;
+    bool bSecurityRose = false;
+    auto RescoreEdge = [&Graph, &EdgesTouched, &bSecurityRose](int32 Edge, int32 From, int32 To)
+    {
+        const float Security = TGConvoyRouteScoring::ScoreConnection(Graph, From, To);
+        bSecurityRose |= Security > Graph.GetEdgeSecurity(Edge);
+        Graph.SetEdgeSecurity(Edge, Security);
+        EdgesTouched++;
+    };
+    
+    for (int32 Edge = Graph.GetEdgeBegin(Node); Edge < Graph.GetEdgeEnd(Node); Edge++)
+    {
+        const int32 Neighbor = Graph.GetEdgeTarget(Edge);
+        RescoreEdge(Edge, Node, Neighbor);
         
-        for (auto& ConnectionEntry : TerritoryConnectionsEntry.Value)
+        const int32 ReverseEdge = Graph.FindEdge(Neighbor, Node);
+        if (ReverseEdge != INDEX_NONE)
         {
-            int32 ToTerritoryId = ConnectionEntry.Key;
-            FTerritorialConnection& Connection = ConnectionEntry.Value;
-            
-            int32 ToController = TerritorialManager->GetControllingFaction(ToTerritoryId);
-            bool bToContested = TerritorialManager->IsTerritoryContested(ToTerritoryId);
-            
-            // Calculate security based on territorial control
-            float SecurityLevel = 1.0f;
-            
-            // Reduce security for contested territories
-            if (bFromContested || bToContested)
-            {
-                SecurityLevel *= 0.3f;
-            }
-            
-            // Reduce security for connections between different factions
-            if (FromController != ToController && FromController != 0 && ToController != 0)
-            {
-                SecurityLevel *= 0.1f; // Very dangerous to cross faction lines
-            }
-            
-            // Bonus security for same-faction controlled territories
-            if (FromController == ToController && FromController != 0)
-            {
-                SecurityLevel *= 1.2f;
-            }
-            
-            Connection.SecurityLevel = FMath::Clamp(SecurityLevel, 0.0f, 1.0f);
+            RescoreEdge(ReverseEdge, Neighbor, Node);
         }
     }
+    
+    // Edge costs through this territory change, whether an event or the periodic resync noticed it
+    MarkTerritoryPathsStale(TerritoryId, PreviousController, bSecurityRose);
+    OnConnectionSecurityChanged.Broadcast(TerritoryId);
+    
+    return EdgesTouched;
 }
 
 void UTGConvoyEconomySubsystem::ProcessRouteUpdates()
@@ -508,8 +1158,12 @@ void UTGConvoyEconomySubsystem::ProcessRouteUpdates()
         return;
     }
     
+    const float ElapsedSinceUpdate = CurrentTime - LastRouteUpdate;
     LastRouteUpdate = CurrentTime;
     
+    // Integrity relaxes towards equilibrium between updates, as in the war simulation
+    AdvanceDecay(ElapsedSinceUpdate);
+    
     // Update territorial connections
     UpdateTerritorialConnections();
     
@@ -540,18 +1194,19 @@ void UTGConvoyEconomySubsystem::ProcessRouteUpdates()
         {
             if (FConvoyRoute* Route = RegisteredRoutes.Find(RouteId))
             {
-                float NewSecurityRating = CalculateRouteSecurityRating(Route->TerritorialPath);
+                // Memoized unless a territory on the path changed since the last scoring
+                const FRouteScores& Scores = GetRouteScoresLocked(*Route);
                 
                 // If security dropped too low, invalidate route
-                if (NewSecurityRating < MinRouteSecurityThreshold)
+                if (Scores.SecurityRating < MinRouteSecurityThreshold)
                 {
                     Route->bIsActive = false;
                     OnRouteInvalidated.Broadcast(RouteId, TEXT("Security threshold breach"));
                 }
                 else
                 {
-                    Route->SecurityRating = NewSecurityRating;
-                    Route->ProfitabilityScore = CalculateRouteProfitability(*Route);
+                    Route->SecurityRating = Scores.SecurityRating;
+                    Route->ProfitabilityScore = Scores.ProfitabilityScore;
                     Route->LastValidated = FDateTime::Now();
                 }
             }
@@ -567,127 +1222,221 @@ TArray<int32> UTGConvoyEconomySubsystem::FindOptimalPath(int32 SourceTerritoryId
         return {SourceTerritoryId};
     }
     
-    // A* pathfinding with territorial considerations
-    struct FPathNode
+    const FTGConvoyPathKey Key{FactionId, SourceTerritoryId, DestinationTerritoryId};
+    if (const FTGConvoyCachedPath* Cached = PathCache.Find(Key, MaxHops))
     {
-        int32 TerritoryId;
-        float GScore; // Cost from start
-        float FScore; // Total estimated cost
-        int32 ParentId;
-        int32 Depth;
-        
-        FPathNode(int32 InTerritoryId, float InGScore, float InFScore, int32 InParentId, int32 InDepth)
-            : TerritoryId(InTerritoryId), GScore(InGScore), FScore(InFScore), ParentId(InParentId), Depth(InDepth) {}
-    };
+        return Cached->Path;
+    }
+    
+    // Heap-ordered A* over the compiled graph; controllers and security come from the last connection update
+    TArray<int32> Path;
+    if (Pathfinder.FindPath(*RouteGraph, SourceTerritoryId, DestinationTerritoryId, FactionId, MaxHops, Path))
+    {
+        PathCache.Store(Key, MaxHops, Path, Pathfinder.GetLastPathCost());
+    }
+    else
+    {
+        PathCache.Remove(Key);
+    }
+    return Path;
+}
+
+float UTGConvoyEconomySubsystem::CalculateRouteProfitability(const FConvoyRoute& Route) const
+{
+    return TGConvoyRouteScoring::ScoreProfitability(*RouteGraph, Route.TerritorialPath, Route.TotalDistance, Route.SecurityRating);
+}
+
+float UTGConvoyEconomySubsystem::CalculateRouteSecurityRating(const TArray<int32>& TerritorialPath) const
+{
+    return TGConvoyRouteScoring::ScoreSecurity(*RouteGraph, TerritorialPath);
+}
+
+uint32 UTGConvoyEconomySubsystem::GenerateRouteHash(const FRouteGenerationParameters& Parameters) const
+{
+    // Create deterministic hash for route parameters
+    uint32 Hash = 0;
+    Hash = HashCombine(Hash, GetTypeHash(Parameters.RequestingFactionId));
+    Hash = HashCombine(Hash, GetTypeHash(Parameters.SourceTerritoryId));
+    Hash = HashCombine(Hash, GetTypeHash(Parameters.DestinationTerritoryId));
+    Hash = HashCombine(Hash, GetTypeHash(Parameters.bRequireDirectControl));
+    
+    return Hash;
+}
+
+FName UTGConvoyEconomySubsystem::GenerateUniqueRouteId(int32 FactionId, int32 SourceId, int32 DestinationId) const
+{
+    static int32 RouteCounter = 0;
+    RouteCounter++;
+    
+    FString RouteIdString = FString::Printf(TEXT("R_%d_%d_%d_%d"), 
+                                          FactionId, SourceId, DestinationId, RouteCounter);
+    return FName(*RouteIdString);
+}
+
+// Territorial Event Handlers
+void UTGConvoyEconomySubsystem::OnTerritoryControlChanged(int32 TerritoryId, int32 OldControllerFactionId, int32 NewControllerFactionId)
+{
+    UE_LOG(LogTemp, Log, TEXT("Territory %d control changed: %d -> %d"), TerritoryId, OldControllerFactionId, NewControllerFactionId);
+    
+    // Refresh connections first: it marks paths through the territory stale, and the queued
+    // recomputes and regeneration read the refreshed connections
+    LastConnectionUpdateEdgeCount = RefreshTerritoryConnections(TerritoryId, true);
     
-    TArray<FPathNode> OpenSet;
-    TSet<int32> ClosedSet;
-    TMap<int32, FPathNode> NodeMap;
+    // Invalidate routes passing through this territory
+    InvalidateRoutesInTerritory(TerritoryId);
     
-    // Get destination territory for heuristic calculation
-    FTGTerritoryData DestinationData = TerritorialManager->GetTerritoryData(DestinationTerritoryId);
+    // Regenerate routes for both old and new controlling factions over the next frames;
+    // hub pairs whose paths avoid this territory come straight from the path cache
+    if (OldControllerFactionId != 0)
+    {
+        PendingFactionRegenerations.AddUnique(OldControllerFactionId);
+    }
     
-    // Initialize with source territory
-    FTGTerritoryData SourceData = TerritorialManager->GetTerritoryData(SourceTerritoryId);
-    float HeuristicCost = FVector2D::Distance(SourceData.Bounds.CenterPoint, DestinationData.Bounds.CenterPoint);
+    if (NewControllerFactionId != 0)
+    {
+        PendingFactionRegenerations.AddUnique(NewControllerFactionId);
+    }
+}
+
+void UTGConvoyEconomySubsystem::OnTerritoryContested(int32 TerritoryId, bool bContested)
+{
+    UE_LOG(LogTemp, Log, TEXT("Territory %d contested status changed: %s"), TerritoryId, bContested ? TEXT("Contested") : TEXT("Secure"));
     
-    FPathNode StartNode(SourceTerritoryId, 0.0f, HeuristicCost, -1, 0);
-    OpenSet.Add(StartNode);
-    NodeMap.Add(SourceTerritoryId, StartNode);
+    // Update territorial connections (contested territories have lower security)
+    LastConnectionUpdateEdgeCount = RefreshTerritoryConnections(TerritoryId, true);
     
-    while (OpenSet.Num() > 0)
+    // If territory is now contested, reduce security of routes passing through
+    LastRescoredRouteCount = 0;
+    if (bContested)
     {
-        // Find node with lowest F score
-        int32 CurrentIndex = 0;
-        for (int32 i = 1; i < OpenSet.Num(); i++)
+        FScopeLock Lock(&RouteDataMutex);
+        
+        const TArray<FName>* RouteIds = TerritoryRouteIndex.Find(TerritoryId);
+        for (int32 Index = 0; RouteIds && Index < RouteIds->Num(); Index++)
         {
-            if (OpenSet[i].FScore < OpenSet[CurrentIndex].FScore)
+            FConvoyRoute* Route = RegisteredRoutes.Find((*RouteIds)[Index]);
+            if (Route && Route->bIsActive)
             {
-                CurrentIndex = i;
+                // Recalculate security rating; the refresh above dropped this route's memoized scores
+                Route->SecurityRating = GetRouteScoresLocked(*Route).SecurityRating;
+                Route->LastValidated = FDateTime::Now();
+                LastRescoredRouteCount++;
+                
+                // If security dropped too low, invalidate route
+                if (Route->SecurityRating < MinRouteSecurityThreshold)
+                {
+                    Route->bIsActive = false;
+                    OnRouteInvalidated.Broadcast(Route->RouteId, TEXT("Territory contested - security breach"));
+                }
             }
         }
-        
-        FPathNode CurrentNode = OpenSet[CurrentIndex];
-        OpenSet.RemoveAt(CurrentIndex);
-        ClosedSet.Add(CurrentNode.TerritoryId);
-        
-        // Check if we reached destination
-        if (CurrentNode.TerritoryId == DestinationTerritoryId)
+        TotalRescoredRouteCount += LastRescoredRouteCount;
+    }
+}
+
+// Cache Management
+void UTGConvoyEconomySubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_TGConvoyRouteWork);
+    ProcessPendingRouteWork(RouteWorkBudgetMs / 1000.0);
+}
+
+void UTGConvoyEconomySubsystem::MarkTerritoryPathsStale(int32 TerritoryId, int32 PreviousController, bool bSecurityRose)
+{
+    // Paths through the territory; newly stale ones are recomputed in the background
+    PathCache.MarkTerritoryStale(TerritoryId, PendingPathRecomputes);
+    
+    const int32 Controller = RouteGraph->GetController(RouteGraph->FindNode(TerritoryId));
+    if (!bSecurityRose && Controller == PreviousController)
+    {
+        return;
+    }
+    
+    // Paths elsewhere can only be shortened if the territory got cheaper to cross for their faction:
+    // safer connections help everyone, losing a hostile controller only those it was hostile to
+    PathCache.MarkDetoursStale(*RouteGraph, TerritoryId, [bSecurityRose, PreviousController, Controller](int32 FactionId)
+    {
+        const bool bWasHostile = PreviousController != 0 && PreviousController != FactionId;
+        const bool bIsHostile = Controller != 0 && Controller != FactionId;
+        return bSecurityRose || (bWasHostile && !bIsHostile);
+    }, PendingPathRecomputes);
+}
+
+void UTGConvoyEconomySubsystem::ProcessPendingRouteWork(double BudgetSeconds)
+{
+    // Always make some progress so a tiny budget cannot stall the queue
+    const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+    do
+    {
+        if (PendingPathRecomputes.Num() > 0)
         {
-            // Reconstruct path
-            TArray<int32> Path;
-            int32 PathNode = DestinationTerritoryId;
+            const FTGConvoyPathKey Key = PendingPathRecomputes.Pop(EAllowShrinking::No);
             
-            while (PathNode != -1)
+            // Skip paths already refreshed on demand or dropped since they were queued
+            const FTGConvoyCachedPath* Entry = PathCache.FindEntry(Key);
+            if (Entry && Entry->bStale)
             {
-                Path.Insert(PathNode, 0);
-                PathNode = NodeMap[PathNode].ParentId;
+                FindOptimalPath(Key.SourceTerritoryId, Key.DestinationTerritoryId, Key.FactionId, Entry->MaxHops);
             }
-            
-            return Path;
         }
-        
-        // Don't exceed max hops
-        if (CurrentNode.Depth >= MaxHops)
+        else if (PendingFactionRegenerations.Num() > 0)
         {
-            continue;
+            const int32 FactionId = PendingFactionRegenerations[0];
+            PendingFactionRegenerations.RemoveAt(0, 1, EAllowShrinking::No);
+            RegenerateAllFactionRoutes(FactionId);
         }
-        
-        // Explore neighbors
-        if (const TMap<int32, FTerritorialConnection>* Connections = TerritorialConnections.Find(CurrentNode.TerritoryId))
+        else
+        {
+            break;
+        }
+    }
+    while (FPlatformTime::Seconds() < Deadline);
+}
+
+void UTGConvoyEconomySubsystem::InvalidateRouteCache(int32 FactionId)
+{
+    FScopeLock Lock(&RouteDataMutex);
+    
+    if (TArray<FName>* FactionRoutes = FactionRouteCache.Find(FactionId))
+    {
+        // Remove all faction routes from main registry; RemoveRouteLocked edits the faction list
+        const TArray<FName> RouteIds = MoveTemp(*FactionRoutes);
+        for (const FName& RouteId : RouteIds)
+        {
+            RemoveRouteLocked(RouteId);
+        }
+    }
+}
+
+void UTGConvoyEconomySubsystem::CleanupInactiveRoutes()
+{
+    FScopeLock Lock(&RouteDataMutex);
+    
+    TArray<FName> RoutesToRemove;
+    FDateTime CurrentTime = FDateTime::Now();
+    
+    // Find routes that have been inactive for more than 5 minutes
+    for (const auto& RouteEntry : RegisteredRoutes)
+    {
+        const FConvoyRoute& Route = RouteEntry.Value;
+        if (!Route.bIsActive)
         {
-            for (const auto& ConnectionEntry : *Connections)
+            FTimespan InactiveTime = CurrentTime - Route.LastValidated;
+            if (InactiveTime.GetTotalMinutes() > 5.0)
             {
-                int32 NeighborId = ConnectionEntry.Key;
-                const FTerritorialConnection& Connection = ConnectionEntry.Value;
-                
-                if (ClosedSet.Contains(NeighborId))
-                {
-                    continue;
-                }
-                
-                // Calculate movement cost with territorial considerations
-                float MovementCost = Connection.Distance;
-                
-                // Apply faction-specific modifiers
-                int32 NeighborController = TerritorialManager->GetControllingFaction(NeighborId);
-                if (NeighborController != FactionId && NeighborController != 0)
-                {
-                    MovementCost *= 3.0f; // High cost for enemy territory
-                }
-                
-                // Apply security cost
-                MovementCost *= (2.0f - Connection.SecurityLevel); // Lower security = higher cost
-                
-                float TentativeGScore = CurrentNode.GScore + MovementCost;
-                
-                // Calculate heuristic for neighbor
-                FTGTerritoryData NeighborData = TerritorialManager->GetTerritoryData(NeighborId);
-                float NeighborHeuristic = FVector2D::Distance(NeighborData.Bounds.CenterPoint, DestinationData.Bounds.CenterPoint);
-                float TentativeFScore = TentativeGScore + NeighborHeuristic;
-                
-                // Check if this is a better path to neighbor
-                bool bBetterPath = true;
-                if (FPathNode* ExistingNode = NodeMap.Find(NeighborId))
-                {
-                    if (TentativeGScore >= ExistingNode->GScore)
-                    {
-                        bBetterPath = false;
-                    }
-                }
-                
-                if (bBetterPath)
-                {
-                    FPathNode NeighborNode(NeighborId, TentativeGScore, TentativeFScore, CurrentNode.TerritoryId, CurrentNode.Depth + 1);
-                    NodeMap.Add(NeighborId, NeighborNode);
-                    
-                    // Add to open set if not already there
-                    bool bFoundInOpenSet = false;
-                    for (int32 i = 0; i < OpenSet.Num(); i++)
-                    {
-                        if (OpenSet[i].TerritoryId == NeighborId)
-                        {
-                            OpenSet[i] = NeighborNode;
-                            bFoundInOpenSet = true;
-                            break;
-                        }\n                    }\n                    \n                    if (!bFoundInOpenSet)\n                    {\n                        OpenSet.Add(NeighborNode);\n                    }\n                }\n            }\n        }\n    }\n    \n    return TArray<int32>(); // No path found\n}\n\nfloat UTGConvoyEconomySubsystem::CalculateRouteProfitability(const FConvoyRoute& Route) const\n{\n    if (!TerritorialManager || Route.TerritorialPath.Num() < 2)\n    {\n        return 0.0f;\n    }\n    \n    float BaseProfitability = 1.0f;\n    \n    // Calculate profitability based on route characteristics\n    float DistanceFactor = FMath::Clamp(10000.0f / FMath::Max(Route.TotalDistance, 1.0f), 0.1f, 2.0f);\n    float SecurityFactor = Route.SecurityRating * 2.0f;\n    \n    // Strategic value bonus for connecting high-value territories\n    float StrategicValueBonus = 0.0f;\n    for (int32 TerritoryId : Route.TerritorialPath)\n    {\n        FTGTerritoryData TerritoryData = TerritorialManager->GetTerritoryData(TerritoryId);\n        StrategicValueBonus += TerritoryData.StrategicValue * TerritoryData.ResourceMultiplier;\n    }\n    StrategicValueBonus /= Route.TerritorialPath.Num(); // Average strategic value\n    \n    float TotalProfitability = BaseProfitability * DistanceFactor * SecurityFactor * (1.0f + StrategicValueBonus * 0.1f);\n    \n    return FMath::Clamp(TotalProfitability, 0.0f, 10.0f);\n}\n\nfloat UTGConvoyEconomySubsystem::CalculateRouteSecurityRating(const TArray<int32>& TerritorialPath) const\n{\n    if (TerritorialPath.Num() < 2)\n    {\n        return 0.0f;\n    }\n    \n    float TotalSecurity = 0.0f;\n    int32 ConnectionCount = 0;\n    \n    // Calculate average security of all connections in path\n    for (int32 i = 0; i < TerritorialPath.Num() - 1; i++)\n    {\n        int32 FromTerritoryId = TerritorialPath[i];\n        int32 ToTerritoryId = TerritorialPath[i + 1];\n        \n        if (const TMap<int32, FTerritorialConnection>* Connections = TerritorialConnections.Find(FromTerritoryId))\n        {\n            if (const FTerritorialConnection* Connection = Connections->Find(ToTerritoryId))\n            {\n                TotalSecurity += Connection->SecurityLevel;\n                ConnectionCount++;\n            }\n        }\n    }\n    \n    return ConnectionCount > 0 ? (TotalSecurity / ConnectionCount) : 0.0f;\n}\n\nuint32 UTGConvoyEconomySubsystem::GenerateRouteHash(const FRouteGenerationParameters& Parameters) const\n{\n    // Create deterministic hash for route parameters\n    uint32 Hash = 0;\n    Hash = HashCombine(Hash, GetTypeHash(Parameters.RequestingFactionId));\n    Hash = HashCombine(Hash, GetTypeHash(Parameters.SourceTerritoryId));\n    Hash = HashCombine(Hash, GetTypeHash(Parameters.DestinationTerritoryId));\n    Hash = HashCombine(Hash, GetTypeHash(Parameters.bRequireDirectControl));\n    \n    return Hash;\n}\n\nFName UTGConvoyEconomySubsystem::GenerateUniqueRouteId(int32 FactionId, int32 SourceId, int32 DestinationId) const\n{\n    static int32 RouteCounter = 0;\n    RouteCounter++;\n    \n    FString RouteIdString = FString::Printf(TEXT(\"R_%d_%d_%d_%d\"), \n                                          FactionId, SourceId, DestinationId, RouteCounter);\n    return FName(*RouteIdString);\n}\n\n// Territorial Event Handlers\nvoid UTGConvoyEconomySubsystem::OnTerritoryControlChanged(int32 TerritoryId, int32 OldControllerFactionId, int32 NewControllerFactionId)\n{\n    UE_LOG(LogTemp, Log, TEXT(\"Territory %d control changed: %d -> %d\"), TerritoryId, OldControllerFactionId, NewControllerFactionId);\n    \n    // Invalidate routes passing through this territory\n    InvalidateRoutesInTerritory(TerritoryId);\n    \n    // Regenerate routes for both old and new controlling factions\n    if (OldControllerFactionId != 0)\n    {\n        RegenerateAllFactionRoutes(OldControllerFactionId);\n    }\n    \n    if (NewControllerFactionId != 0)\n    {\n        RegenerateAllFactionRoutes(NewControllerFactionId);\n    }\n    \n    // Update territorial connections to reflect new control state\n    UpdateTerritorialConnections();\n}\n\nvoid UTGConvoyEconomySubsystem::OnTerritoryContested(int32 TerritoryId, bool bContested)\n{\n    UE_LOG(LogTemp, Log, TEXT(\"Territory %d contested status changed: %s\"), TerritoryId, bContested ? TEXT(\"Contested\") : TEXT(\"Secure\"));\n    \n    // Update territorial connections (contested territories have lower security)\n    UpdateTerritorialConnections();\n    \n    // If territory is now contested, reduce security of routes passing through\n    if (bContested)\n    {\n        FScopeLock Lock(&RouteDataMutex);\n        \n        for (auto& RouteEntry : RegisteredRoutes)\n        {\n            FConvoyRoute& Route = RouteEntry.Value;\n            if (Route.bIsActive && Route.TerritorialPath.Contains(TerritoryId))\n            {\n                // Recalculate security rating\n                Route.SecurityRating = CalculateRouteSecurityRating(Route.TerritorialPath);\n                Route.LastValidated = FDateTime::Now();\n                \n                // If security dropped too low, invalidate route\n                if (Route.SecurityRating < MinRouteSecurityThreshold)\n                {\n                    Route.bIsActive = false;\n                    OnRouteInvalidated.Broadcast(Route.RouteId, TEXT(\"Territory contested - security breach\"));\n                }\n            }\n        }\n    }\n}\n\n// Cache Management\nvoid UTGConvoyEconomySubsystem::InvalidateRouteCache(int32 FactionId)\n{\n    FScopeLock Lock(&RouteDataMutex);\n    \n    if (TArray<FName>* FactionRoutes = FactionRouteCache.Find(FactionId))\n    {\n        // Remove all faction routes from main registry\n        for (const FName& RouteId : *FactionRoutes)\n        {\n            if (FConvoyRoute* Route = RegisteredRoutes.Find(RouteId))\n            {\n                RouteHashToIdCache.Remove(Route->RouteHash);\n                RegisteredRoutes.Remove(RouteId);\n            }\n        }\n        \n        // Clear faction cache\n        FactionRoutes->Empty();\n    }\n}\n\nvoid UTGConvoyEconomySubsystem::CleanupInactiveRoutes()\n{\n    FScopeLock Lock(&RouteDataMutex);\n    \n    TArray<FName> RoutesToRemove;\n    FDateTime CurrentTime = FDateTime::Now();\n    \n    // Find routes that have been inactive for more than 5 minutes\n    for (const auto& RouteEntry : RegisteredRoutes)\n    {\n        const FConvoyRoute& Route = RouteEntry.Value;\n        if (!Route.bIsActive)\n        {\n            FTimespan InactiveTime = CurrentTime - Route.LastValidated;\n            if (InactiveTime.GetTotalMinutes() > 5.0)\n            {\n                RoutesToRemove.Add(Route.RouteId);\n            }\n        }\n    }\n    \n    // Remove old inactive routes\n    for (const FName& RouteId : RoutesToRemove)\n    {\n        if (const FConvoyRoute* Route = RegisteredRoutes.Find(RouteId))\n        {\n            // Remove from hash cache\n            RouteHashToIdCache.Remove(Route->RouteHash);\n            \n            // Remove from faction cache\n            if (TArray<FName>* FactionRoutes = FactionRouteCache.Find(Route->ControllingFactionId))\n            {\n                FactionRoutes->Remove(RouteId);\n            }\n            \n            // Remove from main registry\n            RegisteredRoutes.Remove(RouteId);\n        }\n    }\n    \n    if (RoutesToRemove.Num() > 0)\n    {\n        UE_LOG(LogTemp, Log, TEXT(\"Cleaned up %d inactive routes\"), RoutesToRemove.Num());\n    }\n}
+                RoutesToRemove.Add(Route.RouteId);
+            }
+        }
+    }
+    
+    // Remove old inactive routes
+    for (const FName& RouteId : RoutesToRemove)
+    {
+        RemoveRouteLocked(RouteId);
+    }
+    
+    if (RoutesToRemove.Num() > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Cleaned up %d inactive routes"), RoutesToRemove.Num());
+    }
+}
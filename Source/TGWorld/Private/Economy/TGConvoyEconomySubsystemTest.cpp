@@ -0,0 +1,78 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Economy/TGConvoyEconomySubsystem.h"
+#include "Economy/TGConvoyRouteGraph.h"
+#include "TGTerritorialManager.h"
+#include "TGTestWorld.h"
+#include "Engine/World.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTGConvoyClusterConnectionTest, "TerminalGrounds.World.ConvoyRouting.DistantClustersConnected", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTGConvoyClusterConnectionTest::RunTest(const FString& Parameters)
+{
+    FTGScopedTestWorld TestWorld(TEXT("TGConvoyClusterConnectionTest"));
+    UWorld* World = TestWorld.Get();
+
+    UTGTerritorialManager* TerritorialManager = World->GetSubsystem<UTGTerritorialManager>();
+    UTGConvoyEconomySubsystem* ConvoyEconomy = World->GetSubsystem<UTGConvoyEconomySubsystem>();
+    TestNotNull(TEXT("Territorial manager exists in game worlds"), TerritorialManager);
+    TestNotNull(TEXT("Convoy economy subsystem exists in game worlds"), ConvoyEconomy);
+    if (!TerritorialManager || !ConvoyEconomy)
+    {
+        return false;
+    }
+
+    // Two clusters of overlapping territories, far out of connection range of each other and of the sample territory
+    auto AddTerritory = [TerritorialManager](int32 TerritoryId, float X)
+    {
+        FTGTerritoryData Territory;
+        Territory.TerritoryId = TerritoryId;
+        Territory.Bounds.CenterPoint = FVector2D(X, 0.0f);
+        Territory.Bounds.InfluenceRadius = 1000.0f;
+        TerritorialManager->SetTerritoryData(Territory);
+    };
+    AddTerritory(20, 100000.0f);
+    AddTerritory(21, 101000.0f);
+    AddTerritory(22, 102000.0f);
+    AddTerritory(30, 200000.0f);
+    AddTerritory(31, 201000.0f);
+    ConvoyEconomy->InitializeTerritorialConnections();
+
+    const FTGConvoyRouteGraph& Graph = ConvoyEconomy->GetRouteGraph();
+    const int32 StartNode = Graph.FindNode(20);
+    TestNotEqual(TEXT("The territories are in the route graph"), StartNode, (int32)INDEX_NONE);
+    if (StartNode != INDEX_NONE)
+    {
+        TBitArray<> Reached(false, Graph.NumNodes());
+        TArray<int32> Pending;
+        Pending.Add(StartNode);
+        Reached[StartNode] = true;
+        while (Pending.Num() > 0)
+        {
+            const int32 Node = Pending.Pop(EAllowShrinking::No);
+            for (int32 Edge = Graph.GetEdgeBegin(Node); Edge < Graph.GetEdgeEnd(Node); Edge++)
+            {
+                const int32 Neighbor = Graph.GetEdgeTarget(Edge);
+                if (!Reached[Neighbor])
+                {
+                    Reached[Neighbor] = true;
+                    Pending.Add(Neighbor);
+                }
+            }
+        }
+
+        for (int32 Node = 0; Node < Graph.NumNodes(); Node++)
+        {
+            TestTrue(FString::Printf(TEXT("Territory %d is reachable from the other cluster"), Graph.GetTerritoryId(Node)), Reached[Node]);
+        }
+
+        // Inside a cluster territories stay directly connected
+        const int32 Edge = Graph.FindEdge(StartNode, Graph.FindNode(21));
+        TestTrue(TEXT("Overlapping territories keep their direct connection"), Edge != INDEX_NONE && Graph.IsDirectConnection(Edge));
+    }
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
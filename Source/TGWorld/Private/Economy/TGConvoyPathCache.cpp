@@ -0,0 +1,132 @@
+#include "Economy/TGConvoyPathCache.h"
+#include "Economy/TGConvoyRouteGraph.h"
+
+const FTGConvoyCachedPath* FTGConvoyPathCache::Find(const FTGConvoyPathKey& Key, int32 MaxHops) const
+{
+    const FTGConvoyCachedPath* Entry = Entries.Find(Key);
+    return (Entry && !Entry->bStale && Entry->MaxHops == MaxHops) ? Entry : nullptr;
+}
+
+void FTGConvoyPathCache::Store(const FTGConvoyPathKey& Key, int32 MaxHops, const TArray<int32>& Path, float Cost)
+{
+    if (!Entries.Contains(Key))
+    {
+        FactionPaths.FindOrAdd(Key.FactionId).Add(Key);
+    }
+
+    FTGConvoyCachedPath& Entry = Entries.FindOrAdd(Key);
+    RemoveDependencies(Key, Entry.Path);
+
+    Entry.Path = Path;
+    Entry.Cost = Cost;
+    Entry.MaxHops = MaxHops;
+    Entry.bStale = false;
+
+    for (const int32 TerritoryId : Entry.Path)
+    {
+        Dependents.FindOrAdd(TerritoryId).Add(Key);
+    }
+}
+
+void FTGConvoyPathCache::Remove(const FTGConvoyPathKey& Key)
+{
+    if (const FTGConvoyCachedPath* Entry = Entries.Find(Key))
+    {
+        RemoveDependencies(Key, Entry->Path);
+        Entries.Remove(Key);
+
+        if (TArray<FTGConvoyPathKey>* Keys = FactionPaths.Find(Key.FactionId))
+        {
+            Keys->RemoveSingleSwap(Key, EAllowShrinking::No);
+            if (Keys->Num() == 0)
+            {
+                FactionPaths.Remove(Key.FactionId);
+            }
+        }
+    }
+}
+
+void FTGConvoyPathCache::MarkTerritoryStale(int32 TerritoryId, TArray<FTGConvoyPathKey>& OutNewlyStale)
+{
+    const TArray<FTGConvoyPathKey>* Keys = Dependents.Find(TerritoryId);
+    if (!Keys)
+    {
+        return;
+    }
+
+    for (const FTGConvoyPathKey& Key : *Keys)
+    {
+        FTGConvoyCachedPath* Entry = Entries.Find(Key);
+        if (Entry && !Entry->bStale)
+        {
+            Entry->bStale = true;
+            OutNewlyStale.Add(Key);
+        }
+    }
+}
+
+void FTGConvoyPathCache::MarkDetoursStale(const FTGConvoyRouteGraph& Graph, int32 TerritoryId, TFunctionRef<bool(int32 FactionId)> BecameCheaperFor, TArray<FTGConvoyPathKey>& OutNewlyStale)
+{
+    const int32 Node = Graph.FindNode(TerritoryId);
+    if (Node == INDEX_NONE)
+    {
+        return;
+    }
+
+    const FVector2D& Via = Graph.GetCenter(Node);
+    for (const TPair<int32, TArray<FTGConvoyPathKey>>& FactionPair : FactionPaths)
+    {
+        // A territory that got no cheaper for this faction cannot pull its paths through it
+        if (!BecameCheaperFor(FactionPair.Key))
+        {
+            continue;
+        }
+
+        for (const FTGConvoyPathKey& Key : FactionPair.Value)
+        {
+            FTGConvoyCachedPath* Entry = Entries.Find(Key);
+            if (!Entry || Entry->bStale)
+            {
+                continue;
+            }
+
+            const int32 SourceNode = Graph.FindNode(Key.SourceTerritoryId);
+            const int32 DestinationNode = Graph.FindNode(Key.DestinationTerritoryId);
+            if (SourceNode == INDEX_NONE || DestinationNode == INDEX_NONE)
+            {
+                continue;
+            }
+
+            // Edge costs never undercut straight-line distance (the search heuristic relies on it),
+            // so a path whose detour bound already exceeds its cost cannot be beaten through here
+            const float DetourBound = FVector2D::Distance(Graph.GetCenter(SourceNode), Via) + FVector2D::Distance(Via, Graph.GetCenter(DestinationNode));
+            if (DetourBound < Entry->Cost)
+            {
+                Entry->bStale = true;
+                OutNewlyStale.Add(Key);
+            }
+        }
+    }
+}
+
+void FTGConvoyPathCache::Reset()
+{
+    Entries.Reset();
+    Dependents.Reset();
+    FactionPaths.Reset();
+}
+
+void FTGConvoyPathCache::RemoveDependencies(const FTGConvoyPathKey& Key, const TArray<int32>& Path)
+{
+    for (const int32 TerritoryId : Path)
+    {
+        if (TArray<FTGConvoyPathKey>* Keys = Dependents.Find(TerritoryId))
+        {
+            Keys->RemoveSingleSwap(Key, EAllowShrinking::No);
+            if (Keys->Num() == 0)
+            {
+                Dependents.Remove(TerritoryId);
+            }
+        }
+    }
+}
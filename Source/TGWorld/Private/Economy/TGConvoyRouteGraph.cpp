@@ -0,0 +1,235 @@
+#include "Economy/TGConvoyRouteGraph.h"
+
+// Cost multiplier for moving into territory held by another faction
+static constexpr float EnemyTerritoryCostMultiplier = 3.0f;
+
+void FTGConvoyRouteGraph::Reset()
+{
+    NodeIndices.Reset();
+    TerritoryIds.Reset();
+    Centers.Reset();
+    Controllers.Reset();
+    StrategicWeights.Reset();
+    ContestedFlags.Reset();
+    RowOffsets.Reset();
+    EdgeTargets.Reset();
+    EdgeDistances.Reset();
+    EdgeSecurity.Reset();
+    bEdgeDirect.Reset();
+    PendingEdges.Reset();
+}
+
+int32 FTGConvoyRouteGraph::AddNode(int32 TerritoryId, const FVector2D& Center, int32 ControllerFactionId, float StrategicWeight)
+{
+    if (const int32* Existing = NodeIndices.Find(TerritoryId))
+    {
+        Centers[*Existing] = Center;
+        Controllers[*Existing] = ControllerFactionId;
+        StrategicWeights[*Existing] = StrategicWeight;
+        return *Existing;
+    }
+
+    const int32 Node = TerritoryIds.Add(TerritoryId);
+    Centers.Add(Center);
+    Controllers.Add(ControllerFactionId);
+    StrategicWeights.Add(StrategicWeight);
+    ContestedFlags.Add(false);
+    NodeIndices.Add(TerritoryId, Node);
+    return Node;
+}
+
+void FTGConvoyRouteGraph::AddEdge(int32 FromNode, int32 ToNode, float Distance, bool bDirectConnection, float SecurityLevel)
+{
+    FPendingEdge& Edge = PendingEdges.AddDefaulted_GetRef();
+    Edge.From = FromNode;
+    Edge.To = ToNode;
+    Edge.Distance = Distance;
+    Edge.SecurityLevel = SecurityLevel;
+    Edge.bDirectConnection = bDirectConnection;
+}
+
+void FTGConvoyRouteGraph::Finalize()
+{
+    const int32 NodeCount = TerritoryIds.Num();
+
+    PendingEdges.Sort([](const FPendingEdge& A, const FPendingEdge& B)
+    {
+        return A.From < B.From || (A.From == B.From && A.To < B.To);
+    });
+
+    RowOffsets.Reset(NodeCount + 1);
+    RowOffsets.AddZeroed(NodeCount + 1);
+    EdgeTargets.Reset(PendingEdges.Num());
+    EdgeDistances.Reset(PendingEdges.Num());
+    EdgeSecurity.Reset(PendingEdges.Num());
+    bEdgeDirect.Reset(PendingEdges.Num());
+
+    for (int32 Index = 0; Index < PendingEdges.Num(); ++Index)
+    {
+        const FPendingEdge& Edge = PendingEdges[Index];
+
+        // Later duplicates of the same connection win, matching TMap::Add replacement
+        if (Index + 1 < PendingEdges.Num() && PendingEdges[Index + 1].From == Edge.From && PendingEdges[Index + 1].To == Edge.To)
+        {
+            continue;
+        }
+
+        EdgeTargets.Add(Edge.To);
+        EdgeDistances.Add(Edge.Distance);
+        EdgeSecurity.Add(Edge.SecurityLevel);
+        bEdgeDirect.Add(Edge.bDirectConnection);
+        ++RowOffsets[Edge.From + 1];
+    }
+
+    for (int32 Node = 0; Node < NodeCount; ++Node)
+    {
+        RowOffsets[Node + 1] += RowOffsets[Node];
+    }
+
+    PendingEdges.Empty();
+}
+
+int32 FTGConvoyRouteGraph::FindEdge(int32 FromNode, int32 ToNode) const
+{
+    // Rows are sorted by target
+    int32 Low = RowOffsets[FromNode];
+    int32 High = RowOffsets[FromNode + 1];
+    while (Low < High)
+    {
+        const int32 Mid = Low + (High - Low) / 2;
+        if (EdgeTargets[Mid] < ToNode)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+    return (Low < RowOffsets[FromNode + 1] && EdgeTargets[Low] == ToNode) ? Low : INDEX_NONE;
+}
+
+void FTGConvoyPathfinder::PrepareScratch(int32 NumNodes)
+{
+    if (GScores.Num() != NumNodes)
+    {
+        GScores.SetNumUninitialized(NumNodes);
+        Parents.SetNumUninitialized(NumNodes);
+        Depths.SetNumUninitialized(NumNodes);
+        OpenStamps.Reset();
+        OpenStamps.AddZeroed(NumNodes);
+        ClosedStamps.Reset();
+        ClosedStamps.AddZeroed(NumNodes);
+        SearchGeneration = 0;
+    }
+
+    // Stamps from 2^32 searches ago would alias the new generation
+    if (++SearchGeneration == 0)
+    {
+        FMemory::Memzero(OpenStamps.GetData(), OpenStamps.Num() * sizeof(uint32));
+        FMemory::Memzero(ClosedStamps.GetData(), ClosedStamps.Num() * sizeof(uint32));
+        SearchGeneration = 1;
+    }
+
+    OpenHeap.Reset();
+}
+
+bool FTGConvoyPathfinder::FindPath(const FTGConvoyRouteGraph& Graph, int32 SourceTerritoryId, int32 DestinationTerritoryId, int32 FactionId, int32 MaxHops, TArray<int32>& OutPath)
+{
+    OutPath.Reset();
+    LastPathCost = 0.0f;
+    LastExpandedCount = 0;
+
+    const int32 Source = Graph.FindNode(SourceTerritoryId);
+    const int32 Destination = Graph.FindNode(DestinationTerritoryId);
+    if (Source == INDEX_NONE || Destination == INDEX_NONE)
+    {
+        return false;
+    }
+    if (Source == Destination)
+    {
+        OutPath.Add(SourceTerritoryId);
+        return true;
+    }
+
+    PrepareScratch(Graph.NumNodes());
+    const uint32 Generation = SearchGeneration;
+    const FVector2D DestinationCenter = Graph.GetCenter(Destination);
+
+    GScores[Source] = 0.0f;
+    Parents[Source] = INDEX_NONE;
+    Depths[Source] = 0;
+    OpenStamps[Source] = Generation;
+    OpenHeap.HeapPush({FVector2D::Distance(Graph.GetCenter(Source), DestinationCenter), Source}, FOpenOrder());
+
+    while (OpenHeap.Num() > 0)
+    {
+        FOpenEntry Current;
+        OpenHeap.HeapPop(Current, FOpenOrder(), EAllowShrinking::No);
+
+        // Improved nodes are pushed again rather than re-keyed; skip the superseded entries
+        const int32 Node = Current.Node;
+        if (ClosedStamps[Node] == Generation)
+        {
+            continue;
+        }
+        ClosedStamps[Node] = Generation;
+        ++LastExpandedCount;
+
+        if (Node == Destination)
+        {
+            int32 Length = 0;
+            for (int32 PathNode = Destination; PathNode != INDEX_NONE; PathNode = Parents[PathNode])
+            {
+                ++Length;
+            }
+            OutPath.SetNumUninitialized(Length);
+            for (int32 PathNode = Destination; PathNode != INDEX_NONE; PathNode = Parents[PathNode])
+            {
+                OutPath[--Length] = Graph.GetTerritoryId(PathNode);
+            }
+            LastPathCost = GScores[Destination];
+            return true;
+        }
+
+        if (Depths[Node] >= MaxHops)
+        {
+            continue;
+        }
+
+        const float NodeGScore = GScores[Node];
+        const int32 EdgeEnd = Graph.GetEdgeEnd(Node);
+        for (int32 Edge = Graph.GetEdgeBegin(Node); Edge < EdgeEnd; ++Edge)
+        {
+            const int32 Neighbor = Graph.GetEdgeTarget(Edge);
+            if (ClosedStamps[Neighbor] == Generation)
+            {
+                continue;
+            }
+
+            float MovementCost = Graph.GetEdgeDistance(Edge);
+            const int32 NeighborController = Graph.GetController(Neighbor);
+            if (NeighborController != FactionId && NeighborController != 0)
+            {
+                MovementCost *= EnemyTerritoryCostMultiplier;
+            }
+            MovementCost *= (2.0f - Graph.GetEdgeSecurity(Edge)); // Lower security = higher cost
+
+            const float TentativeGScore = NodeGScore + MovementCost;
+            if (OpenStamps[Neighbor] == Generation && TentativeGScore >= GScores[Neighbor])
+            {
+                continue;
+            }
+
+            GScores[Neighbor] = TentativeGScore;
+            Parents[Neighbor] = Node;
+            Depths[Neighbor] = Depths[Node] + 1;
+            OpenStamps[Neighbor] = Generation;
+
+            const float Heuristic = FVector2D::Distance(Graph.GetCenter(Neighbor), DestinationCenter);
+            OpenHeap.HeapPush({TentativeGScore + Heuristic, Neighbor}, FOpenOrder());
+        }
+    }
+
+    return false;
+}
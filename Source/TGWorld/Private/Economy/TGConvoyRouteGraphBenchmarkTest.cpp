@@ -0,0 +1,239 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Economy/TGConvoyRouteGraph.h"
+#include "Math/RandomStream.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTGConvoyRouteGraphBenchmarkTest, "TerminalGrounds.World.ConvoyRouting.AStar2000Territories", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+namespace TGConvoyRouteBenchmark
+{
+    struct FLegacyConnection
+    {
+        float Distance = 0.0f;
+        float SecurityLevel = 0.5f;
+    };
+
+    struct FLegacyGraph
+    {
+        TMap<int32, TMap<int32, FLegacyConnection>> Connections;
+        TMap<int32, FVector2D> Centers;
+        TMap<int32, int32> Controllers;
+    };
+
+    static float EdgeCost(float Distance, float SecurityLevel, int32 NeighborController, int32 FactionId)
+    {
+        float Cost = Distance;
+        if (NeighborController != FactionId && NeighborController != 0)
+        {
+            Cost *= 3.0f;
+        }
+        return Cost * (2.0f - SecurityLevel);
+    }
+
+    // The search FindOptimalPath used before the CSR graph: linear open-list scans and nested map lookups
+    static float LegacyFindPathCost(const FLegacyGraph& Graph, int32 Source, int32 Destination, int32 FactionId, int32 MaxHops)
+    {
+        struct FPathNode
+        {
+            int32 TerritoryId;
+            float GScore;
+            float FScore;
+            int32 ParentId;
+            int32 Depth;
+        };
+
+        TArray<FPathNode> OpenSet;
+        TSet<int32> ClosedSet;
+        TMap<int32, FPathNode> NodeMap;
+
+        const FVector2D DestinationCenter = Graph.Centers.FindRef(Destination);
+        const FPathNode StartNode{Source, 0.0f, FVector2D::Distance(Graph.Centers.FindRef(Source), DestinationCenter), -1, 0};
+        OpenSet.Add(StartNode);
+        NodeMap.Add(Source, StartNode);
+
+        while (OpenSet.Num() > 0)
+        {
+            int32 CurrentIndex = 0;
+            for (int32 i = 1; i < OpenSet.Num(); i++)
+            {
+                if (OpenSet[i].FScore < OpenSet[CurrentIndex].FScore)
+                {
+                    CurrentIndex = i;
+                }
+            }
+
+            const FPathNode CurrentNode = OpenSet[CurrentIndex];
+            OpenSet.RemoveAt(CurrentIndex);
+            ClosedSet.Add(CurrentNode.TerritoryId);
+
+            if (CurrentNode.TerritoryId == Destination)
+            {
+                return CurrentNode.GScore;
+            }
+            if (CurrentNode.Depth >= MaxHops)
+            {
+                continue;
+            }
+
+            if (const TMap<int32, FLegacyConnection>* Connections = Graph.Connections.Find(CurrentNode.TerritoryId))
+            {
+                for (const TPair<int32, FLegacyConnection>& Connection : *Connections)
+                {
+                    const int32 NeighborId = Connection.Key;
+                    if (ClosedSet.Contains(NeighborId))
+                    {
+                        continue;
+                    }
+
+                    const float TentativeGScore = CurrentNode.GScore + EdgeCost(Connection.Value.Distance, Connection.Value.SecurityLevel, Graph.Controllers.FindRef(NeighborId), FactionId);
+                    if (const FPathNode* Existing = NodeMap.Find(NeighborId))
+                    {
+                        if (TentativeGScore >= Existing->GScore)
+                        {
+                            continue;
+                        }
+                    }
+
+                    const FPathNode NeighborNode{NeighborId, TentativeGScore, TentativeGScore + FVector2D::Distance(Graph.Centers.FindRef(NeighborId), DestinationCenter), CurrentNode.TerritoryId, CurrentNode.Depth + 1};
+                    NodeMap.Add(NeighborId, NeighborNode);
+
+                    bool bFoundInOpenSet = false;
+                    for (FPathNode& OpenNode : OpenSet)
+                    {
+                        if (OpenNode.TerritoryId == NeighborId)
+                        {
+                            OpenNode = NeighborNode;
+                            bFoundInOpenSet = true;
+                            break;
+                        }
+                    }
+                    if (!bFoundInOpenSet)
+                    {
+                        OpenSet.Add(NeighborNode);
+                    }
+                }
+            }
+        }
+
+        return -1.0f;
+    }
+}
+
+bool FTGConvoyRouteGraphBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace TGConvoyRouteBenchmark;
+
+    constexpr int32 GridWidth = 50;
+    constexpr int32 GridHeight = 40; // 2,000 territories
+    constexpr float Spacing = 1000.0f;
+    constexpr float LinkRadius = Spacing * 1.6f; // Roughly 8-connected after jitter
+    constexpr int32 NumQueries = 200;
+    constexpr int32 MaxHops = GridWidth * GridHeight;
+
+    FRandomStream Random(1337);
+
+    // Jittered grid of territories split between three factions and neutral ground
+    const int32 NumTerritories = GridWidth * GridHeight;
+    TArray<FVector2D> Centers;
+    TArray<int32> Controllers;
+    for (int32 Index = 0; Index < NumTerritories; Index++)
+    {
+        const float X = (Index % GridWidth) * Spacing + Random.FRandRange(-0.25f, 0.25f) * Spacing;
+        const float Y = (Index / GridWidth) * Spacing + Random.FRandRange(-0.25f, 0.25f) * Spacing;
+        Centers.Add(FVector2D(X, Y));
+        Controllers.Add(Random.RandRange(0, 3));
+    }
+
+    FTGConvoyRouteGraph Graph;
+    FLegacyGraph LegacyGraph;
+    for (int32 Index = 0; Index < NumTerritories; Index++)
+    {
+        const int32 TerritoryId = 100 + Index;
+        Graph.AddNode(TerritoryId, Centers[Index], Controllers[Index]);
+        LegacyGraph.Centers.Add(TerritoryId, Centers[Index]);
+        LegacyGraph.Controllers.Add(TerritoryId, Controllers[Index]);
+    }
+
+    for (int32 A = 0; A < NumTerritories; A++)
+    {
+        const int32 Column = A % GridWidth;
+        const int32 Row = A / GridWidth;
+        for (int32 DY = 0; DY <= 2; DY++)
+        {
+            for (int32 DX = -2; DX <= 2; DX++)
+            {
+                const int32 X = Column + DX;
+                const int32 Y = Row + DY;
+                const int32 B = Y * GridWidth + X;
+                if (X < 0 || X >= GridWidth || Y >= GridHeight || B <= A)
+                {
+                    continue;
+                }
+
+                const float Distance = FVector2D::Distance(Centers[A], Centers[B]);
+                if (Distance > LinkRadius)
+                {
+                    continue;
+                }
+
+                const float Security = Random.FRandRange(0.2f, 1.0f);
+                Graph.AddEdge(A, B, Distance, true, Security);
+                Graph.AddEdge(B, A, Distance, true, Security);
+                LegacyGraph.Connections.FindOrAdd(100 + A).Add(100 + B, {Distance, Security});
+                LegacyGraph.Connections.FindOrAdd(100 + B).Add(100 + A, {Distance, Security});
+            }
+        }
+    }
+    Graph.Finalize();
+
+    TArray<FIntVector> Queries;
+    for (int32 Query = 0; Query < NumQueries; Query++)
+    {
+        Queries.Add(FIntVector(100 + Random.RandRange(0, NumTerritories - 1), 100 + Random.RandRange(0, NumTerritories - 1), Random.RandRange(1, 3)));
+    }
+
+    // Baseline
+    TArray<float> LegacyCosts;
+    const double LegacyStart = FPlatformTime::Seconds();
+    for (const FIntVector& Query : Queries)
+    {
+        LegacyCosts.Add(LegacyFindPathCost(LegacyGraph, Query.X, Query.Y, Query.Z, MaxHops));
+    }
+    const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+    // CSR + heap, one warm-up search so scratch sizing is not timed
+    FTGConvoyPathfinder Pathfinder;
+    TArray<int32> Path;
+    Path.Reserve(NumTerritories);
+    Pathfinder.FindPath(Graph, Queries[0].X, Queries[0].Y, Queries[0].Z, MaxHops, Path);
+
+    TArray<float> Costs;
+    int64 ExpandedTotal = 0;
+    const double Start = FPlatformTime::Seconds();
+    for (const FIntVector& Query : Queries)
+    {
+        const bool bFound = Pathfinder.FindPath(Graph, Query.X, Query.Y, Query.Z, MaxHops, Path);
+        Costs.Add(bFound ? Pathfinder.GetLastPathCost() : -1.0f);
+        ExpandedTotal += Pathfinder.GetLastExpandedCount();
+    }
+    const double Seconds = FPlatformTime::Seconds() - Start;
+
+    int32 Mismatches = 0;
+    for (int32 Query = 0; Query < NumQueries; Query++)
+    {
+        if (!FMath::IsNearlyEqual(Costs[Query], LegacyCosts[Query], FMath::Max(1.0f, FMath::Abs(LegacyCosts[Query]) * 1e-4f)))
+        {
+            Mismatches++;
+        }
+    }
+    TestEqual(TEXT("CSR heap search finds paths of the same cost as the list search"), Mismatches, 0);
+
+    AddInfo(FString::Printf(TEXT("%d territories, %d edges, %d queries: list A* %.3f ms/query, CSR heap A* %.3f ms/query (%.0f nodes expanded/query)"),
+        Graph.NumNodes(), Graph.NumEdges(), NumQueries,
+        LegacySeconds * 1000.0 / NumQueries, Seconds * 1000.0 / NumQueries, double(ExpandedTotal) / NumQueries));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
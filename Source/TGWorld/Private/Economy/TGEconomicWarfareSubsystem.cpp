@@ -1,7 +1,38 @@
 #include "Economy/TGEconomicWarfareSubsystem.h"
+#include "Economy/TGConvoyEconomySubsystem.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 
+DECLARE_CYCLE_STAT(TEXT("TG Economic Warfare Tick"), STAT_TGEconomicWarfareTick, STATGROUP_Game);
+
+// Placeholder blockade income per unit of tax rate per second, until convoy traffic feeds blockades
+static constexpr float BlockadeRevenuePerTaxSecond = 10.0f;
+
+// Stale expiry entries tolerated beyond the live timed disruptions before the heap is rebuilt
+static constexpr int32 MaxStaleDisruptionExpiries = 64;
+
+// Security of a route leg the convoy route graph does not know, as for a default territorial connection
+static constexpr float DefaultConnectionSecurity = 0.5f;
+
+static float GetDisruptionExpiryTime(const FRouteDisruption& Disruption)
+{
+    return Disruption.StartTime + Disruption.DurationMinutes * 60.0f;
+}
+
+static bool IsDisruptionActive(const FRouteDisruption& Disruption, float CurrentTime)
+{
+    return Disruption.bPermanent || CurrentTime < GetDisruptionExpiryTime(Disruption);
+}
+
+// A connection carries one unit of supply at full security, however many routes run along it
+static float GetConnectionCapacity(const FTGConvoyRouteGraph& Graph, int32 FromTerritoryId, int32 ToTerritoryId)
+{
+    const int32 FromNode = Graph.FindNode(FromTerritoryId);
+    const int32 ToNode = Graph.FindNode(ToTerritoryId);
+    const int32 Edge = FromNode != INDEX_NONE && ToNode != INDEX_NONE ? Graph.FindEdge(FromNode, ToNode) : INDEX_NONE;
+    return Edge != INDEX_NONE ? Graph.GetEdgeSecurity(Edge) : DefaultConnectionSecurity;
+}
+
 void UTGEconomicWarfareSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
@@ -9,6 +40,12 @@ void UTGEconomicWarfareSubsystem::Initialize(FSubsystemCollectionBase& Collectio
     // Initialize faction specializations with default values
     InitializeFactionSpecializations();
     
+    // Control and contest changes rescore convoy connections, and with them the supply legs along them
+    if (UTGConvoyEconomySubsystem* ConvoyEconomy = Collection.InitializeDependency<UTGConvoyEconomySubsystem>())
+    {
+        ConvoyEconomy->OnConnectionSecurityChanged.AddUObject(this, &UTGEconomicWarfareSubsystem::RefreshSupplyConnections);
+    }
+    
     LastUpdateTime = GetWorld()->GetTimeSeconds();
     LastRecoveryTime = GetWorld()->GetTimeSeconds();
     
@@ -17,7 +54,18 @@ void UTGEconomicWarfareSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 
 void UTGEconomicWarfareSubsystem::Deinitialize()
 {
-    // Clean up any active timers or delegates
+    if (UTGConvoyEconomySubsystem* ConvoyEconomy = GetWorld()->GetSubsystem<UTGConvoyEconomySubsystem>())
+    {
+        ConvoyEconomy->OnConnectionSecurityChanged.RemoveAll(this);
+    }
+    
+    DisruptionExpiryHeap.Empty();
+    NumTimedDisruptions = 0;
+    BlockadeRevenueAccounts.Empty();
+    SupplyNetworks.Empty();
+    SupplyRoutes.Empty();
+    bSupplyNetworksBuilt = false;
+
     Super::Deinitialize();
 }
 
@@ -33,13 +81,12 @@ void UTGEconomicWarfareSubsystem::Tick(float DeltaTime)
         return;
     }
 
+    SCOPE_CYCLE_COUNTER(STAT_TGEconomicWarfareTick);
+
     float CurrentTime = GetWorld()->GetTimeSeconds();
     
-    // Process route disruptions (check for expiration)
-    ProcessRouteDisruptions(DeltaTime);
-    
-    // Update territorial blockades
-    UpdateTerritorialBlockades(DeltaTime);
+    // Only disruptions whose expiry has passed are touched; blockade revenue accrues lazily
+    ProcessExpiredDisruptions(CurrentTime);
     
     // Update faction economic power every 30 seconds
     if (CurrentTime - LastUpdateTime >= 30.0f)
@@ -51,7 +98,7 @@ void UTGEconomicWarfareSubsystem::Tick(float DeltaTime)
     // Process supply chain recovery every minute
     if (CurrentTime - LastRecoveryTime >= 60.0f)
     {
-        ProcessSupplyChainRecovery(DeltaTime);
+        ProcessSupplyChainRecovery(CurrentTime - LastRecoveryTime);
         LastRecoveryTime = CurrentTime;
     }
 }
@@ -73,11 +120,14 @@ void UTGEconomicWarfareSubsystem::DisruptRoute(FName RouteId, ERouteDisruptionTy
     Disruption.bPermanent = (DisruptionType == ERouteDisruptionType::Sabotage || DisruptionType == ERouteDisruptionType::BridgeOut);
 
     // Add to route disruptions
-    if (!RouteDisruptions.Contains(RouteId))
+    RouteDisruptions.FindOrAdd(RouteId).Disruptions.Add(Disruption);
+
+    if (!Disruption.bPermanent)
     {
-        RouteDisruptions.Add(RouteId, TArray<FRouteDisruption>());
+        DisruptionExpiryHeap.HeapPush({GetDisruptionExpiryTime(Disruption), RouteId}, FDisruptionExpiryOrder());
+        ++NumTimedDisruptions;
     }
-    RouteDisruptions[RouteId].Add(Disruption);
+    RefreshSupplyRoute(RouteId);
 
     // Update faction economic damage tracking
     if (ResponsibleFactionID >= 0)
@@ -103,19 +153,25 @@ void UTGEconomicWarfareSubsystem::RepairRouteDisruption(FName RouteId, int32 Rep
         return;
     }
 
-    TArray<FRouteDisruption>& Disruptions = RouteDisruptions[RouteId];
+    TArray<FRouteDisruption>& Disruptions = RouteDisruptions[RouteId].Disruptions;
     
-    // Remove non-permanent disruptions (can be repaired)
-    Disruptions.RemoveAll([](const FRouteDisruption& Disruption)
+    // Remove non-permanent disruptions (can be repaired); their expiry entries go stale
+    NumTimedDisruptions -= Disruptions.RemoveAll([](const FRouteDisruption& Disruption)
     {
         return !Disruption.bPermanent;
     });
 
+    if (DisruptionExpiryHeap.Num() > NumTimedDisruptions + MaxStaleDisruptionExpiries)
+    {
+        RebuildDisruptionExpiryHeap();
+    }
+
     // If no disruptions remain, remove the route from the map
     if (Disruptions.Num() == 0)
     {
         RouteDisruptions.Remove(RouteId);
     }
+    RefreshSupplyRoute(RouteId);
 
     BroadcastEconomicEvent(TEXT("RouteRepaired"), RepairingFactionID, RepairCost);
     
@@ -129,18 +185,12 @@ bool UTGEconomicWarfareSubsystem::IsRouteDisrupted(FName RouteId) const
         return false;
     }
 
-    const TArray<FRouteDisruption>& Disruptions = RouteDisruptions[RouteId];
+    const TArray<FRouteDisruption>& Disruptions = RouteDisruptions[RouteId].Disruptions;
     float CurrentTime = GetWorld()->GetTimeSeconds();
 
     for (const FRouteDisruption& Disruption : Disruptions)
     {
-        if (Disruption.bPermanent)
-        {
-            return true;
-        }
-
-        float ElapsedMinutes = (CurrentTime - Disruption.StartTime) / 60.0f;
-        if (ElapsedMinutes < Disruption.DurationMinutes)
+        if (IsDisruptionActive(Disruption, CurrentTime))
         {
             return true;
         }
@@ -158,19 +208,13 @@ TArray<FRouteDisruption> UTGEconomicWarfareSubsystem::GetActiveDisruptions(FName
         return ActiveDisruptions;
     }
 
-    const TArray<FRouteDisruption>& Disruptions = RouteDisruptions[RouteId];
+    const TArray<FRouteDisruption>& Disruptions = RouteDisruptions[RouteId].Disruptions;
     float CurrentTime = GetWorld()->GetTimeSeconds();
 
     for (const FRouteDisruption& Disruption : Disruptions)
     {
-        if (Disruption.bPermanent)
-        {
-            ActiveDisruptions.Add(Disruption);
-            continue;
-        }
-
-        float ElapsedMinutes = (CurrentTime - Disruption.StartTime) / 60.0f;
-        if (ElapsedMinutes < Disruption.DurationMinutes)
+        // Expired entries linger until the next tick pops them
+        if (IsDisruptionActive(Disruption, CurrentTime))
         {
             ActiveDisruptions.Add(Disruption);
         }
@@ -237,6 +281,12 @@ bool UTGEconomicWarfareSubsystem::EstablishTerritorialBlockade(int32 TerritoryID
 
     TerritorialBlockades.Add(TerritoryID, Blockade);
 
+    FBlockadeRevenueAccount& Account = BlockadeRevenueAccounts.FindOrAdd(BlockadingFactionID);
+    SettleBlockadeRevenue(Account, Blockade.EstablishedTime);
+    Account.TaxRateSum += TaxRate;
+
+    RefreshSupplyBlockade(TerritoryID);
+
     // Broadcast event
     OnTerritorialBlockadeEstablished.Broadcast(TerritoryID, BlockadingFactionID, TaxRate);
 
@@ -248,12 +298,19 @@ bool UTGEconomicWarfareSubsystem::EstablishTerritorialBlockade(int32 TerritoryID
 
 void UTGEconomicWarfareSubsystem::RemoveTerritorialBlockade(int32 TerritoryID, int32 RemovingFactionID)
 {
-    if (!TerritorialBlockades.Contains(TerritoryID))
+    FTerritorialBlockade Blockade;
+    if (!TerritorialBlockades.RemoveAndCopyValue(TerritoryID, Blockade))
     {
         return;
     }
 
-    TerritorialBlockades.Remove(TerritoryID);
+    if (FBlockadeRevenueAccount* Account = BlockadeRevenueAccounts.Find(Blockade.BlockadingFactionID))
+    {
+        SettleBlockadeRevenue(*Account, GetWorld()->GetTimeSeconds());
+        Account->TaxRateSum = FMath::Max(0.0f, Account->TaxRateSum - Blockade.TaxRate);
+    }
+
+    RefreshSupplyBlockade(TerritoryID);
     
     // Broadcast event
     OnTerritorialBlockadeRemoved.Broadcast(TerritoryID);
@@ -268,9 +325,9 @@ bool UTGEconomicWarfareSubsystem::CanEstablishBlockade(int32 TerritoryID, int32
 
 FTerritorialBlockade UTGEconomicWarfareSubsystem::GetTerritorialBlockade(int32 TerritoryID) const
 {
-    if (TerritorialBlockades.Contains(TerritoryID))
+    if (const FTerritorialBlockade* Blockade = TerritorialBlockades.Find(TerritoryID))
     {
-        return TerritorialBlockades[TerritoryID];
+        return WithAccruedRevenue(*Blockade, GetWorld()->GetTimeSeconds());
     }
     return FTerritorialBlockade(); // Return default (empty) blockade
 }
@@ -278,15 +335,30 @@ FTerritorialBlockade UTGEconomicWarfareSubsystem::GetTerritorialBlockade(int32 T
 TArray<FTerritorialBlockade> UTGEconomicWarfareSubsystem::GetActiveTerritorialBlockades() const
 {
     TArray<FTerritorialBlockade> ActiveBlockades;
+    ActiveBlockades.Reserve(TerritorialBlockades.Num());
     
+    const float CurrentTime = GetWorld()->GetTimeSeconds();
     for (const auto& Pair : TerritorialBlockades)
     {
-        ActiveBlockades.Add(Pair.Value);
+        ActiveBlockades.Add(WithAccruedRevenue(Pair.Value, CurrentTime));
     }
     
     return ActiveBlockades;
 }
 
+float UTGEconomicWarfareSubsystem::GetFactionBlockadeRevenue(int32 FactionID) const
+{
+    const FBlockadeRevenueAccount* Account = BlockadeRevenueAccounts.Find(FactionID);
+    if (!Account)
+    {
+        return 0.0f;
+    }
+
+    FBlockadeRevenueAccount Settled = *Account;
+    SettleBlockadeRevenue(Settled, GetWorld()->GetTimeSeconds());
+    return Settled.SettledRevenue;
+}
+
 float UTGEconomicWarfareSubsystem::ExecuteEconomicWarfareAction(const FEconomicWarfareAction& Action)
 {
     float SuccessChance = CalculateActionSuccessChance(Action);
@@ -575,6 +647,9 @@ float UTGEconomicWarfareSubsystem::CalculateSupplyChainEfficiency(int32 FactionI
         BaseEfficiency -= FMath::Clamp(DamageRatio, 0.0f, 0.8f); // Max 80% efficiency loss
     }
     
+    // Factor in supply that disruptions and blockades keep from getting through
+    BaseEfficiency *= GetSupplyNetworkEfficiency(FactionID);
+    
     // Factor in specialization bonuses
     if (FactionSpecializations.Contains(FactionID))
     {
@@ -587,16 +662,68 @@ float UTGEconomicWarfareSubsystem::CalculateSupplyChainEfficiency(int32 FactionI
 
 TArray<int32> UTGEconomicWarfareSubsystem::GetVulnerableSupplyRoutes(int32 FactionID) const
 {
-    // This would integrate with convoy economy subsystem to identify vulnerable routes
-    // For now, return placeholder data
-    TArray<int32> VulnerableRoutes;
+    TArray<int32> ChokeTerritories;
+    const FFactionSupplyNetwork* Supply = FindSupplyNetwork(FactionID);
+    if (!Supply)
+    {
+        return ChokeTerritories;
+    }
+    
+    TArray<int32> CutEdges;
+    Supply->Network.GetMinCutEdges(CutEdges);
+    for (const int32 Edge : CutEdges)
+    {
+        // Terminal edges outweigh every leg, so each cut edge is a leg; a blockade on the territory it enters taxes it
+        ChokeTerritories.AddUnique(Supply->Network.GetTerritoryId(Supply->Network.GetEdgeTo(Edge)));
+    }
+    
+    return ChokeTerritories;
+}
+
+TArray<FName> UTGEconomicWarfareSubsystem::GetSupplyChokeRoutes(int32 FactionID) const
+{
+    TArray<FName> ChokeRoutes;
+    const FFactionSupplyNetwork* Supply = FindSupplyNetwork(FactionID);
+    if (!Supply)
+    {
+        return ChokeRoutes;
+    }
+    
+    TArray<int32> CutEdges;
+    Supply->Network.GetMinCutEdges(CutEdges);
+    for (const int32 Edge : CutEdges)
+    {
+        for (const FName RouteId : Supply->EdgeRoutes[Edge])
+        {
+            ChokeRoutes.AddUnique(RouteId);
+        }
+    }
+    
+    return ChokeRoutes;
+}
+
+float UTGEconomicWarfareSubsystem::GetSupplyNetworkEfficiency(int32 FactionID) const
+{
+    const FFactionSupplyNetwork* Supply = FindSupplyNetwork(FactionID);
+    if (!Supply || Supply->NominalMaxFlow <= 0.0f)
+    {
+        return 1.0f; // No supply network to disrupt
+    }
     
-    // Implementation would analyze:
-    // - Routes with low protection
-    // - Routes through contested territory
-    // - Routes with recent disruption history
+    return FMath::Clamp(Supply->Network.GetMaxFlow() / Supply->NominalMaxFlow, 0.0f, 1.0f);
+}
+
+float UTGEconomicWarfareSubsystem::GetSupplyNetworkThroughput(int32 FactionID) const
+{
+    const FFactionSupplyNetwork* Supply = FindSupplyNetwork(FactionID);
+    const UTGConvoyEconomySubsystem* ConvoyEconomy = GetWorld()->GetSubsystem<UTGConvoyEconomySubsystem>();
+    if (!Supply || !ConvoyEconomy)
+    {
+        return 0.0f;
+    }
     
-    return VulnerableRoutes;
+    // Integrity scales every capacity alike, so it scales the flow without moving the cut
+    return Supply->Network.GetMaxFlow() * ConvoyEconomy->GetIntegrityIndex();
 }
 
 float UTGEconomicWarfareSubsystem::CalculateEconomicDamageDealt(int32 FactionID) const
@@ -728,54 +855,339 @@ float UTGEconomicWarfareSubsystem::GetAllianceBenefit(int32 FactionA, int32 Fact
     return 1.0f; // No benefit
 }
 
-void UTGEconomicWarfareSubsystem::ProcessRouteDisruptions(float DeltaTime)
+void UTGEconomicWarfareSubsystem::ProcessExpiredDisruptions(float CurrentTime)
 {
-    float CurrentTime = GetWorld()->GetTimeSeconds();
-    TArray<FName> RoutesToCleanup;
+    while (DisruptionExpiryHeap.Num() > 0 && DisruptionExpiryHeap.HeapTop().ExpiryTime <= CurrentTime)
+    {
+        FDisruptionExpiry Expiry;
+        DisruptionExpiryHeap.HeapPop(Expiry, FDisruptionExpiryOrder(), EAllowShrinking::No);
+
+        // The route may have been repaired since; then there is nothing left to expire
+        FTGRouteDisruptionArray* RouteEntry = RouteDisruptions.Find(Expiry.RouteId);
+        if (!RouteEntry)
+        {
+            continue;
+        }
+
+        const int32 NumExpired = RouteEntry->Disruptions.RemoveAll([CurrentTime](const FRouteDisruption& Disruption)
+        {
+            return !IsDisruptionActive(Disruption, CurrentTime);
+        });
+        if (NumExpired == 0)
+        {
+            continue;
+        }
+        NumTimedDisruptions -= NumExpired;
+
+        if (RouteEntry->Disruptions.Num() == 0)
+        {
+            RouteDisruptions.Remove(Expiry.RouteId);
+        }
+        RefreshSupplyRoute(Expiry.RouteId);
+    }
+}
+
+void UTGEconomicWarfareSubsystem::RebuildDisruptionExpiryHeap()
+{
+    DisruptionExpiryHeap.Reset();
+    for (const auto& RoutePair : RouteDisruptions)
+    {
+        for (const FRouteDisruption& Disruption : RoutePair.Value.Disruptions)
+        {
+            if (!Disruption.bPermanent)
+            {
+                DisruptionExpiryHeap.Add({GetDisruptionExpiryTime(Disruption), RoutePair.Key});
+            }
+        }
+    }
+    DisruptionExpiryHeap.Heapify(FDisruptionExpiryOrder());
+}
+
+const UTGEconomicWarfareSubsystem::FFactionSupplyNetwork* UTGEconomicWarfareSubsystem::FindSupplyNetwork(int32 FactionID) const
+{
+    if (!AreSupplyNetworksCurrent())
+    {
+        RebuildSupplyNetworks();
+    }
+    return SupplyNetworks.Find(FactionID);
+}
+
+bool UTGEconomicWarfareSubsystem::AreSupplyNetworksCurrent() const
+{
+    const UWorld* World = GetWorld();
+    const UTGConvoyEconomySubsystem* ConvoyEconomy = World ? World->GetSubsystem<UTGConvoyEconomySubsystem>() : nullptr;
+    return bSupplyNetworksBuilt && ConvoyEconomy
+        && ConvoyEconomy->GetRouteSetVersion() == SupplyRouteSetVersion
+        && ConvoyEconomy->GetConnectionSetVersion() == SupplyConnectionSetVersion;
+}
+
+void UTGEconomicWarfareSubsystem::RebuildSupplyNetworks() const
+{
+    SupplyNetworks.Reset();
+    SupplyRoutes.Reset();
+    bSupplyNetworksBuilt = false;
+    
+    const UWorld* World = GetWorld();
+    const UTGConvoyEconomySubsystem* ConvoyEconomy = World ? World->GetSubsystem<UTGConvoyEconomySubsystem>() : nullptr;
+    if (!ConvoyEconomy)
+    {
+        return;
+    }
+    SupplyRouteSetVersion = ConvoyEconomy->GetRouteSetVersion();
+    SupplyConnectionSetVersion = ConvoyEconomy->GetConnectionSetVersion();
+    bSupplyNetworksBuilt = true;
     
-    for (auto& RoutePair : RouteDisruptions)
+    // Each leg is a connection shared by every route that runs along it
+    struct FRouteTerminals
     {
-        TArray<FRouteDisruption>& Disruptions = RoutePair.Value;
+        TSet<int32> Origins;
+        TSet<int32> Destinations;
+    };
+    TMap<int32, FRouteTerminals> FactionTerminals;
+    const FTGConvoyRouteGraph& Graph = ConvoyEconomy->GetRouteGraph();
+    ConvoyEconomy->ForEachRoute([this, &Graph, &FactionTerminals](const FConvoyRoute& Route)
+    {
+        const TArray<int32>& Path = Route.TerritorialPath;
+        if (Path.Num() < 2)
+        {
+            return;
+        }
+        
+        FFactionSupplyNetwork& Supply = SupplyNetworks.FindOrAdd(Route.ControllingFactionId);
+        FSupplyRouteEdges& RouteEdges = SupplyRoutes.Add(Route.RouteId);
+        RouteEdges.FactionID = Route.ControllingFactionId;
         
-        // Remove expired non-permanent disruptions
-        Disruptions.RemoveAll([CurrentTime](const FRouteDisruption& Disruption)
+        for (int32 Index = 1; Index < Path.Num(); ++Index)
         {
-            if (Disruption.bPermanent)
+            if (Path[Index] == Path[Index - 1])
             {
-                return false; // Keep permanent disruptions
+                continue;
             }
             
-            float ElapsedMinutes = (CurrentTime - Disruption.StartTime) / 60.0f;
-            return ElapsedMinutes >= Disruption.DurationMinutes;
-        });
+            const int32 Edge = Supply.Network.FindOrAddEdge(Supply.Network.FindOrAddNode(Path[Index - 1]), Supply.Network.FindOrAddNode(Path[Index]));
+            if (Edge == Supply.EdgeBaseCapacity.Num())
+            {
+                Supply.EdgeBaseCapacity.Add(GetConnectionCapacity(Graph, Path[Index - 1], Path[Index]));
+                Supply.EdgeRoutes.AddDefaulted();
+            }
+            RouteEdges.Edges.AddUnique(Edge);
+            Supply.EdgeRoutes[Edge].AddUnique(Route.RouteId);
+        }
+        
+        FRouteTerminals& Terminals = FactionTerminals.FindOrAdd(Route.ControllingFactionId);
+        Terminals.Origins.Add(Path[0]);
+        Terminals.Destinations.Add(Path.Last());
+    });
+    
+    for (auto& Pair : SupplyNetworks)
+    {
+        FFactionSupplyNetwork& Supply = Pair.Value;
+        const FRouteTerminals& Terminals = FactionTerminals[Pair.Key];
+        
+        // Source and sink edges outweigh all legs together, so the minimum cut always falls on legs;
+        // security never exceeds one, so this holds however control changes rescore the legs
+        const float TerminalCapacity = 1.0f + Supply.EdgeBaseCapacity.Num();
+        
+        // An origin that is also a destination is supplied at the source; a sink edge there would bypass every leg
+        for (const int32 TerritoryID : Terminals.Origins)
+        {
+            Supply.Network.FindOrAddEdge(FTGSupplyNetwork::SourceNode, Supply.Network.FindNode(TerritoryID));
+        }
+        for (const int32 TerritoryID : Terminals.Destinations)
+        {
+            if (!Terminals.Origins.Contains(TerritoryID))
+            {
+                Supply.Network.FindOrAddEdge(Supply.Network.FindNode(TerritoryID), FTGSupplyNetwork::SinkNode);
+            }
+        }
+        Supply.EdgeBaseCapacity.SetNum(Supply.Network.NumEdges());
+        Supply.EdgeRoutes.SetNum(Supply.Network.NumEdges());
+        
+        for (int32 Edge = 0; Edge < Supply.Network.NumEdges(); ++Edge)
+        {
+            if (Supply.EdgeRoutes[Edge].Num() == 0)
+            {
+                Supply.EdgeBaseCapacity[Edge] = TerminalCapacity;
+            }
+            Supply.Network.SetEdgeCapacity(Edge, Supply.EdgeBaseCapacity[Edge]);
+        }
+        Supply.NominalMaxFlow = Supply.Network.Solve();
+        Supply.NominalNetwork = Supply.Network;
+    }
+    
+    // Current disruptions and blockades are applied on top of the nominal flow
+    for (auto& RoutePair : SupplyRoutes)
+    {
+        if (!RouteDisruptions.Contains(RoutePair.Key))
+        {
+            continue;
+        }
         
-        // Mark routes with no remaining disruptions for cleanup
-        if (Disruptions.Num() == 0)
+        RoutePair.Value.Viability = CalculateRouteViability(RoutePair.Key);
+    }
+    
+    for (auto& Pair : SupplyNetworks)
+    {
+        FFactionSupplyNetwork& Supply = Pair.Value;
+        for (int32 Edge = 0; Edge < Supply.Network.NumEdges(); ++Edge)
         {
-            RoutesToCleanup.Add(RoutePair.Key);
+            const float Capacity = GetSupplyEdgeCapacity(Supply, Pair.Key, Edge);
+            if (!FMath::IsNearlyEqual(Capacity, Supply.Network.GetEdgeCapacity(Edge)))
+            {
+                Supply.Network.UpdateEdgeCapacity(Edge, Capacity);
+            }
         }
     }
+}
+
+float UTGEconomicWarfareSubsystem::GetSupplyEdgeCapacity(const FFactionSupplyNetwork& Supply, int32 FactionID, int32 Edge) const
+{
+    float Capacity = Supply.EdgeBaseCapacity[Edge];
+    if (Supply.EdgeRoutes[Edge].Num() == 0)
+    {
+        return Capacity; // Source and sink edges stay heavier than any cut through the legs
+    }
     
-    // Clean up routes with no active disruptions
-    for (FName RouteId : RoutesToCleanup)
+    // Each route on the leg holds an equal share of it; a disrupted route only holds up its own convoys
+    float ViabilitySum = 0.0f;
+    for (const FName RouteId : Supply.EdgeRoutes[Edge])
     {
-        RouteDisruptions.Remove(RouteId);
+        const FSupplyRouteEdges* RouteEdges = SupplyRoutes.Find(RouteId);
+        ViabilitySum += RouteEdges ? RouteEdges->Viability : 1.0f;
     }
+    Capacity *= ViabilitySum / Supply.EdgeRoutes[Edge].Num();
+    
+    // Hostile blockades tax every convoy entering their territory
+    const int32 TerritoryID = Supply.Network.GetTerritoryId(Supply.Network.GetEdgeTo(Edge));
+    if (const FTerritorialBlockade* Blockade = TerritorialBlockades.Find(TerritoryID))
+    {
+        if (Blockade->BlockadingFactionID != FactionID)
+        {
+            Capacity *= 1.0f - Blockade->TaxRate;
+        }
+    }
+    
+    return Capacity;
 }
 
-void UTGEconomicWarfareSubsystem::UpdateTerritorialBlockades(float DeltaTime)
+void UTGEconomicWarfareSubsystem::RefreshSupplyRoute(FName RouteId)
 {
-    // Update blockade revenue and statistics
-    for (auto& BlockadePair : TerritorialBlockades)
+    // Stale networks pick up the route's disruptions when they are rebuilt
+    if (!AreSupplyNetworksCurrent())
     {
-        FTerritorialBlockade& Blockade = BlockadePair.Value;
+        return;
+    }
+    
+    FSupplyRouteEdges* RouteEdges = SupplyRoutes.Find(RouteId);
+    FFactionSupplyNetwork* Supply = RouteEdges ? SupplyNetworks.Find(RouteEdges->FactionID) : nullptr;
+    if (!Supply)
+    {
+        return;
+    }
+    
+    const float Viability = CalculateRouteViability(RouteId);
+    if (FMath::IsNearlyEqual(Viability, RouteEdges->Viability))
+    {
+        return;
+    }
+    RouteEdges->Viability = Viability;
+    
+    for (const int32 Edge : RouteEdges->Edges)
+    {
+        Supply->Network.UpdateEdgeCapacity(Edge, GetSupplyEdgeCapacity(*Supply, RouteEdges->FactionID, Edge));
+    }
+}
+
+void UTGEconomicWarfareSubsystem::RefreshSupplyBlockade(int32 TerritoryID)
+{
+    if (!AreSupplyNetworksCurrent())
+    {
+        return;
+    }
+    
+    TArray<int32> IncomingEdges;
+    for (auto& Pair : SupplyNetworks)
+    {
+        FFactionSupplyNetwork& Supply = Pair.Value;
+        const int32 Node = Supply.Network.FindNode(TerritoryID);
+        if (Node == INDEX_NONE)
+        {
+            continue;
+        }
         
-        // Simulate revenue generation (this would integrate with actual convoy traffic)
-        float RevenueThisUpdate = Blockade.TaxRate * 10.0f * DeltaTime; // Placeholder calculation
-        Blockade.TotalRevenue += RevenueThisUpdate;
+        Supply.Network.GetIncomingEdges(Node, IncomingEdges);
+        for (const int32 Edge : IncomingEdges)
+        {
+            Supply.Network.UpdateEdgeCapacity(Edge, GetSupplyEdgeCapacity(Supply, Pair.Key, Edge));
+        }
     }
 }
 
+void UTGEconomicWarfareSubsystem::RefreshSupplyConnections(int32 TerritoryID)
+{
+    if (!AreSupplyNetworksCurrent())
+    {
+        return;
+    }
+    
+    const UTGConvoyEconomySubsystem* ConvoyEconomy = GetWorld()->GetSubsystem<UTGConvoyEconomySubsystem>();
+    const FTGConvoyRouteGraph& Graph = ConvoyEconomy->GetRouteGraph();
+    
+    // Only connections to and from the territory were rescored
+    TArray<int32> IncidentEdges;
+    TArray<int32> OutgoingEdges;
+    for (auto& Pair : SupplyNetworks)
+    {
+        FFactionSupplyNetwork& Supply = Pair.Value;
+        const int32 Node = Supply.Network.FindNode(TerritoryID);
+        if (Node == INDEX_NONE)
+        {
+            continue;
+        }
+        
+        Supply.Network.GetIncomingEdges(Node, IncidentEdges);
+        Supply.Network.GetOutgoingEdges(Node, OutgoingEdges);
+        IncidentEdges.Append(OutgoingEdges);
+        
+        for (const int32 Edge : IncidentEdges)
+        {
+            if (Supply.EdgeRoutes[Edge].Num() == 0)
+            {
+                continue;
+            }
+            
+            const int32 FromTerritoryID = Supply.Network.GetTerritoryId(Supply.Network.GetEdgeFrom(Edge));
+            const int32 ToTerritoryID = Supply.Network.GetTerritoryId(Supply.Network.GetEdgeTo(Edge));
+            const float BaseCapacity = GetConnectionCapacity(Graph, FromTerritoryID, ToTerritoryID);
+            if (FMath::IsNearlyEqual(BaseCapacity, Supply.EdgeBaseCapacity[Edge]))
+            {
+                continue;
+            }
+            
+            Supply.EdgeBaseCapacity[Edge] = BaseCapacity;
+            Supply.Network.UpdateEdgeCapacity(Edge, GetSupplyEdgeCapacity(Supply, Pair.Key, Edge));
+            
+            // Efficiency measures disruptions and blockades, so the undisrupted flow follows the new security
+            Supply.NominalNetwork.UpdateEdgeCapacity(Edge, BaseCapacity);
+        }
+        Supply.NominalMaxFlow = Supply.NominalNetwork.GetMaxFlow();
+    }
+}
+
+void UTGEconomicWarfareSubsystem::SettleBlockadeRevenue(FBlockadeRevenueAccount& Account, float CurrentTime)
+{
+    Account.SettledRevenue += Account.TaxRateSum * BlockadeRevenuePerTaxSecond * FMath::Max(0.0f, CurrentTime - Account.SettledTime);
+    Account.SettledTime = CurrentTime;
+}
+
+FTerritorialBlockade UTGEconomicWarfareSubsystem::WithAccruedRevenue(const FTerritorialBlockade& Blockade, float CurrentTime)
+{
+    // Tax rate is fixed for the blockade's lifetime, so its revenue is a function of age
+    FTerritorialBlockade Accrued = Blockade;
+    Accrued.TotalRevenue += Blockade.TaxRate * BlockadeRevenuePerTaxSecond * FMath::Max(0.0f, CurrentTime - Blockade.EstablishedTime);
+    return Accrued;
+}
+
 void UTGEconomicWarfareSubsystem::UpdateFactionEconomicPower()
 {
     // Calculate economic power based on damage dealt/received and territorial control
@@ -0,0 +1,106 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Economy/TGEconomicWarfareSubsystem.h"
+#include "Economy/TGConvoyEconomySubsystem.h"
+#include "TGTerritorialManager.h"
+#include "TGTestWorld.h"
+#include "Engine/World.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTGSupplyChokeControlTest, "TerminalGrounds.World.EconomicWarfare.SupplyChokeFollowsTerritoryControl", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTGSupplyChokeTest, "TerminalGrounds.World.EconomicWarfare.SupplyChokeOnSharedLeg", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTGSupplyChokeTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 FactionID = 2;
+
+    FTGScopedTestWorld TestWorld(TEXT("TGSupplyChokeTest"));
+    UWorld* World = TestWorld.Get();
+
+    UTGConvoyEconomySubsystem* ConvoyEconomy = World->GetSubsystem<UTGConvoyEconomySubsystem>();
+    UTGEconomicWarfareSubsystem* EconomicWarfare = World->GetSubsystem<UTGEconomicWarfareSubsystem>();
+    TestNotNull(TEXT("Convoy economy subsystem exists in game worlds"), ConvoyEconomy);
+    TestNotNull(TEXT("Economic warfare subsystem exists in game worlds"), EconomicWarfare);
+    if (!ConvoyEconomy || !EconomicWarfare)
+    {
+        return false;
+    }
+
+    // Two origins merge onto the 12 -> 13 leg; a third route runs on its own
+    auto RegisterRoute = [ConvoyEconomy](FName RouteId, TArray<int32> Path)
+    {
+        FConvoyRoute Route;
+        Route.RouteId = RouteId;
+        Route.TerritorialPath = MoveTemp(Path);
+        Route.ControllingFactionId = FactionID;
+        Route.bIsActive = true;
+        ConvoyEconomy->RegisterConvoyRoute(Route);
+    };
+    RegisterRoute(TEXT("North"), {10, 12, 13});
+    RegisterRoute(TEXT("South"), {11, 12, 13});
+    RegisterRoute(TEXT("East"), {14, 15});
+
+    TArray<int32> Chokes = EconomicWarfare->GetVulnerableSupplyRoutes(FactionID);
+    Chokes.Sort();
+    TestTrue(TEXT("Chokes are the shared leg and the lone leg, not the route origins"), Chokes == TArray<int32>({13, 15}));
+
+    TArray<FName> ChokeRoutes = EconomicWarfare->GetSupplyChokeRoutes(FactionID);
+    TestEqual(TEXT("Every route crosses the cut"), ChokeRoutes.Num(), 3);
+
+    TestTrue(TEXT("An undisrupted network runs at full efficiency"), FMath::IsNearlyEqual(EconomicWarfare->GetSupplyNetworkEfficiency(FactionID), 1.0f));
+
+    return true;
+}
+
+bool FTGSupplyChokeControlTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 FactionID = 2;
+    constexpr int32 RivalFactionID = 3;
+
+    FTGScopedTestWorld TestWorld(TEXT("TGSupplyChokeControlTest"));
+    UWorld* World = TestWorld.Get();
+
+    UTGTerritorialManager* TerritorialManager = World->GetSubsystem<UTGTerritorialManager>();
+    UTGConvoyEconomySubsystem* ConvoyEconomy = World->GetSubsystem<UTGConvoyEconomySubsystem>();
+    UTGEconomicWarfareSubsystem* EconomicWarfare = World->GetSubsystem<UTGEconomicWarfareSubsystem>();
+    TestNotNull(TEXT("Territorial manager exists in game worlds"), TerritorialManager);
+    TestNotNull(TEXT("Convoy economy subsystem exists in game worlds"), ConvoyEconomy);
+    TestNotNull(TEXT("Economic warfare subsystem exists in game worlds"), EconomicWarfare);
+    if (!TerritorialManager || !ConvoyEconomy || !EconomicWarfare)
+    {
+        return false;
+    }
+
+    // A line of friendly territories, well away from the sample territory at the origin
+    auto MakeTerritory = [](int32 TerritoryId, float X, int32 ControllerFactionId)
+    {
+        FTGTerritoryData Territory;
+        Territory.TerritoryId = TerritoryId;
+        Territory.Bounds.CenterPoint = FVector2D(X, 0.0f);
+        Territory.Bounds.InfluenceRadius = 1000.0f;
+        Territory.CurrentControllerFactionId = ControllerFactionId;
+        return Territory;
+    };
+    TerritorialManager->SetTerritoryData(MakeTerritory(10, 10000.0f, FactionID));
+    TerritorialManager->SetTerritoryData(MakeTerritory(11, 11000.0f, FactionID));
+    TerritorialManager->SetTerritoryData(MakeTerritory(12, 12000.0f, FactionID));
+    ConvoyEconomy->InitializeTerritorialConnections();
+
+    FConvoyRoute Route;
+    Route.RouteId = TEXT("Line");
+    Route.TerritorialPath = {10, 11, 12};
+    Route.ControllingFactionId = FactionID;
+    Route.bIsActive = true;
+    ConvoyEconomy->RegisterConvoyRoute(Route);
+
+    // Equally secure legs saturate together, so the cut falls on the first one
+    TestTrue(TEXT("The first leg is the choke while both legs are friendly"), EconomicWarfare->GetVulnerableSupplyRoutes(FactionID) == TArray<int32>({11}));
+
+    // Losing the last territory makes the leg into it cross-faction and far weaker
+    TerritorialManager->SetTerritoryData(MakeTerritory(12, 12000.0f, RivalFactionID));
+    TestTrue(TEXT("The choke moves to the leg into the lost territory"), EconomicWarfare->GetVulnerableSupplyRoutes(FactionID) == TArray<int32>({12}));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
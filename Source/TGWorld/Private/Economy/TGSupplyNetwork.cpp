@@ -0,0 +1,212 @@
+#include "Economy/TGSupplyNetwork.h"
+
+// Residual capacity below this is treated as saturated
+static constexpr float FlowEpsilon = 1e-4f;
+
+void FTGSupplyNetwork::Reset()
+{
+    Targets.Reset();
+    Capacities.Reset();
+    Flows.Reset();
+    NodeArcs.Reset();
+    NodeIndices.Reset();
+    NodeTerritoryIds.Reset();
+    EdgeIndices.Reset();
+    MaxFlow = 0.0f;
+    LastAugmentCount = 0;
+
+    // Super source and sink
+    NodeTerritoryIds.Add(INDEX_NONE);
+    NodeTerritoryIds.Add(INDEX_NONE);
+    NodeArcs.AddDefaulted(2);
+}
+
+int32 FTGSupplyNetwork::FindOrAddNode(int32 TerritoryId)
+{
+    if (const int32* Existing = NodeIndices.Find(TerritoryId))
+    {
+        return *Existing;
+    }
+
+    const int32 Node = NodeTerritoryIds.Add(TerritoryId);
+    NodeArcs.AddDefaulted();
+    NodeIndices.Add(TerritoryId, Node);
+    return Node;
+}
+
+int32 FTGSupplyNetwork::FindOrAddEdge(int32 FromNode, int32 ToNode)
+{
+    const uint64 Key = (uint64(uint32(FromNode)) << 32) | uint32(ToNode);
+    if (const int32* Existing = EdgeIndices.Find(Key))
+    {
+        return *Existing;
+    }
+
+    const int32 Edge = NumEdges();
+    Targets.Add(ToNode);
+    Targets.Add(FromNode);
+    Capacities.Add(0.0f);
+    Capacities.Add(0.0f);
+    Flows.Add(0.0f);
+    Flows.Add(0.0f);
+    NodeArcs[FromNode].Add(Edge * 2);
+    NodeArcs[ToNode].Add(Edge * 2 + 1);
+    EdgeIndices.Add(Key, Edge);
+    return Edge;
+}
+
+void FTGSupplyNetwork::SetEdgeCapacity(int32 Edge, float Capacity)
+{
+    Capacities[Edge * 2] = FMath::Max(0.0f, Capacity);
+}
+
+float FTGSupplyNetwork::Solve()
+{
+    FMemory::Memzero(Flows.GetData(), Flows.Num() * sizeof(float));
+    LastAugmentCount = 0;
+    MaxFlow = Augment(SourceNode, SinkNode, MAX_flt);
+    return MaxFlow;
+}
+
+void FTGSupplyNetwork::UpdateEdgeCapacity(int32 Edge, float Capacity)
+{
+    const int32 Arc = Edge * 2;
+    Capacity = FMath::Max(0.0f, Capacity);
+    Capacities[Arc] = Capacity;
+    LastAugmentCount = 0;
+
+    const float Excess = Flows[Arc] - Capacity;
+    if (Excess > FlowEpsilon)
+    {
+        // Saturate the edge at its new capacity, leaving Excess stranded at its tail
+        PushFlow(Arc, -Excess);
+        const int32 FromNode = GetEdgeFrom(Edge);
+        const int32 ToNode = GetEdgeTo(Edge);
+
+        // Send what we can around the edge; the rest is cancelled back to the source and from the sink
+        const float Cancelled = Excess - Augment(FromNode, ToNode, Excess);
+        if (Cancelled > FlowEpsilon)
+        {
+            Augment(FromNode, SourceNode, Cancelled);
+            Augment(SinkNode, ToNode, Cancelled);
+            MaxFlow -= Cancelled;
+        }
+    }
+
+    // A raise, or capacity freed by the repair, may open new source to sink paths
+    MaxFlow += Augment(SourceNode, SinkNode, MAX_flt);
+}
+
+void FTGSupplyNetwork::GetIncomingEdges(int32 Node, TArray<int32>& OutEdges) const
+{
+    OutEdges.Reset();
+    for (const int32 Arc : NodeArcs[Node])
+    {
+        // Reverse arcs leaving a node belong to the edges entering it
+        if (Arc & 1)
+        {
+            OutEdges.Add(Arc / 2);
+        }
+    }
+}
+
+void FTGSupplyNetwork::GetOutgoingEdges(int32 Node, TArray<int32>& OutEdges) const
+{
+    OutEdges.Reset();
+    for (const int32 Arc : NodeArcs[Node])
+    {
+        if (!(Arc & 1))
+        {
+            OutEdges.Add(Arc / 2);
+        }
+    }
+}
+
+void FTGSupplyNetwork::GetMinCutEdges(TArray<int32>& OutEdges) const
+{
+    OutEdges.Reset();
+
+    TBitArray<> SourceSide(false, NumNodes());
+    TArray<int32> Pending;
+    Pending.Add(SourceNode);
+    SourceSide[SourceNode] = true;
+    while (Pending.Num() > 0)
+    {
+        const int32 Node = Pending.Pop(EAllowShrinking::No);
+        for (const int32 Arc : NodeArcs[Node])
+        {
+            const int32 Target = Targets[Arc];
+            if (!SourceSide[Target] && GetResidual(Arc) > FlowEpsilon)
+            {
+                SourceSide[Target] = true;
+                Pending.Add(Target);
+            }
+        }
+    }
+
+    for (int32 Edge = 0; Edge < NumEdges(); ++Edge)
+    {
+        if (SourceSide[GetEdgeFrom(Edge)] && !SourceSide[GetEdgeTo(Edge)] && GetEdgeCapacity(Edge) > FlowEpsilon)
+        {
+            OutEdges.Add(Edge);
+        }
+    }
+}
+
+void FTGSupplyNetwork::PushFlow(int32 Arc, float Amount)
+{
+    Flows[Arc] += Amount;
+    Flows[Arc ^ 1] -= Amount;
+}
+
+float FTGSupplyNetwork::Augment(int32 FromNode, int32 ToNode, float Limit)
+{
+    if (FromNode == ToNode)
+    {
+        return Limit;
+    }
+
+    ParentArcs.SetNumUninitialized(NumNodes());
+
+    float Pushed = 0.0f;
+    while (Limit - Pushed > FlowEpsilon)
+    {
+        // Breadth-first search keeps augmenting paths short (Edmonds-Karp)
+        FMemory::Memset(ParentArcs.GetData(), 0xFF, ParentArcs.Num() * sizeof(int32));
+        Queue.Reset();
+        Queue.Add(FromNode);
+        for (int32 Head = 0; Head < Queue.Num() && ParentArcs[ToNode] == INDEX_NONE; ++Head)
+        {
+            const int32 Node = Queue[Head];
+            for (const int32 Arc : NodeArcs[Node])
+            {
+                const int32 Target = Targets[Arc];
+                if (Target != FromNode && ParentArcs[Target] == INDEX_NONE && GetResidual(Arc) > FlowEpsilon)
+                {
+                    ParentArcs[Target] = Arc;
+                    Queue.Add(Target);
+                }
+            }
+        }
+
+        if (ParentArcs[ToNode] == INDEX_NONE)
+        {
+            break;
+        }
+
+        float Bottleneck = Limit - Pushed;
+        for (int32 Node = ToNode; Node != FromNode; Node = Targets[ParentArcs[Node] ^ 1])
+        {
+            Bottleneck = FMath::Min(Bottleneck, GetResidual(ParentArcs[Node]));
+        }
+        for (int32 Node = ToNode; Node != FromNode; Node = Targets[ParentArcs[Node] ^ 1])
+        {
+            PushFlow(ParentArcs[Node], Bottleneck);
+        }
+
+        Pushed += Bottleneck;
+        ++LastAugmentCount;
+    }
+
+    return Pushed;
+}
@@ -0,0 +1,83 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Economy/TGSupplyNetwork.h"
+#include "Math/RandomStream.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTGSupplyNetworkIncrementalTest, "TerminalGrounds.World.SupplyNetwork.IncrementalMaxFlow", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTGSupplyNetworkIncrementalTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 GridWidth = 20;
+    constexpr int32 GridHeight = 15;
+    constexpr int32 NumUpdates = 500;
+
+    FRandomStream Random(4242);
+
+    // Grid of territories flowing left to right, fed from the left column and drained from the right
+    FTGSupplyNetwork Network;
+    TArray<int32> Nodes;
+    for (int32 Index = 0; Index < GridWidth * GridHeight; Index++)
+    {
+        Nodes.Add(Network.FindOrAddNode(100 + Index));
+    }
+
+    for (int32 Row = 0; Row < GridHeight; Row++)
+    {
+        Network.SetEdgeCapacity(Network.FindOrAddEdge(FTGSupplyNetwork::SourceNode, Nodes[Row * GridWidth]), 4.0f);
+        Network.SetEdgeCapacity(Network.FindOrAddEdge(Nodes[Row * GridWidth + GridWidth - 1], FTGSupplyNetwork::SinkNode), 4.0f);
+
+        for (int32 Column = 0; Column < GridWidth; Column++)
+        {
+            const int32 Node = Nodes[Row * GridWidth + Column];
+            if (Column + 1 < GridWidth)
+            {
+                Network.SetEdgeCapacity(Network.FindOrAddEdge(Node, Nodes[Row * GridWidth + Column + 1]), Random.RandRange(1, 4));
+            }
+            if (Row + 1 < GridHeight)
+            {
+                Network.SetEdgeCapacity(Network.FindOrAddEdge(Node, Nodes[(Row + 1) * GridWidth + Column]), Random.RandRange(0, 2));
+                Network.SetEdgeCapacity(Network.FindOrAddEdge(Nodes[(Row + 1) * GridWidth + Column], Node), Random.RandRange(0, 2));
+            }
+        }
+    }
+    Network.Solve();
+
+    int32 Mismatches = 0;
+    int64 IncrementalAugments = 0;
+    int64 FullAugments = 0;
+    for (int32 Update = 0; Update < NumUpdates; Update++)
+    {
+        // Mostly disruptions, some repairs
+        const int32 Edge = Random.RandRange(0, Network.NumEdges() - 1);
+        const float Capacity = Random.FRand() < 0.6f ? Network.GetEdgeCapacity(Edge) * Random.FRandRange(0.0f, 0.9f) : Random.FRandRange(0.0f, 4.0f);
+        Network.UpdateEdgeCapacity(Edge, Capacity);
+        IncrementalAugments += Network.GetLastAugmentCount();
+
+        FTGSupplyNetwork Reference = Network;
+        Reference.Solve();
+        FullAugments += Reference.GetLastAugmentCount();
+        if (!FMath::IsNearlyEqual(Network.GetMaxFlow(), Reference.GetMaxFlow(), 1e-2f))
+        {
+            Mismatches++;
+        }
+    }
+    TestEqual(TEXT("Incrementally repaired flow matches a full solve after every capacity change"), Mismatches, 0);
+
+    // Cut capacity equals the flow (max-flow min-cut)
+    TArray<int32> CutEdges;
+    Network.GetMinCutEdges(CutEdges);
+    float CutCapacity = 0.0f;
+    for (const int32 Edge : CutEdges)
+    {
+        CutCapacity += Network.GetEdgeCapacity(Edge);
+    }
+    TestTrue(TEXT("Minimum cut capacity equals the maximum flow"), FMath::IsNearlyEqual(CutCapacity, Network.GetMaxFlow(), 1e-2f));
+
+    AddInfo(FString::Printf(TEXT("%d nodes, %d edges, %d updates: %.1f augmenting paths/update incremental, %.1f for a full solve"),
+        Network.NumNodes(), Network.NumEdges(), NumUpdates, double(IncrementalAugments) / NumUpdates, double(FullAugments) / NumUpdates));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
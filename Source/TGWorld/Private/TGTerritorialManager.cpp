@@ -1,4 +1,5 @@
 #include "TGTerritorialManager.h"
+#include "TGTerritorialReplicationActor.h"
 #include "TGWorld.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
@@ -89,6 +90,32 @@ bool UTGTerritorialManager::DoesSupportWorldType(EWorldType::Type WorldType) con
     return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
 }
 
+void UTGTerritorialManager::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Server owns the replicated territory table; clients receive it through replication
+    if (InWorld.GetNetMode() != NM_Client && !ReplicationActor.IsValid())
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        InWorld.SpawnActor<ATGTerritorialReplicationActor>(ATGTerritorialReplicationActor::StaticClass(), FTransform::Identity, SpawnParams);
+    }
+}
+
+void UTGTerritorialManager::RegisterReplicationActor(ATGTerritorialReplicationActor* Actor)
+{
+    ReplicationActor = Actor;
+}
+
+void UTGTerritorialManager::UnregisterReplicationActor(ATGTerritorialReplicationActor* Actor)
+{
+    if (ReplicationActor.Get() == Actor)
+    {
+        ReplicationActor.Reset();
+    }
+}
+
 bool UTGTerritorialManager::InitializeTerritorialSystem()
 {
     UE_LOG(LogTGWorld, Log, TEXT("Initializing territorial system components"));
@@ -133,6 +160,35 @@ TArray<FTGTerritoryData> UTGTerritorialManager::GetAllTerritories()
     return AllTerritories;
 }
 
+void UTGTerritorialManager::SetTerritoryData(const FTGTerritoryData& TerritoryData)
+{
+    int32 OldController = TerritoryData.CurrentControllerFactionId;
+    bool bWasContested = TerritoryData.bContested;
+    {
+        FScopeLock Lock(&TerritorialDataMutex);
+        
+        if (const FTGTerritoryData* Existing = TerritoryCache.Find(TerritoryData.TerritoryId))
+        {
+            OldController = Existing->CurrentControllerFactionId;
+            bWasContested = Existing->bContested;
+        }
+        TerritoryCache.Add(TerritoryData.TerritoryId, TerritoryData);
+        
+        // Bounds may have moved, so cached point lookups are no longer trustworthy
+        LocationToTerritoryCache.Empty();
+    }
+    
+    // Listeners read the new state back, so broadcast outside the lock
+    if (OldController != TerritoryData.CurrentControllerFactionId)
+    {
+        OnTerritoryControlChanged.Broadcast(TerritoryData.TerritoryId, OldController, TerritoryData.CurrentControllerFactionId);
+    }
+    if (bWasContested != TerritoryData.bContested)
+    {
+        OnTerritoryContested.Broadcast(TerritoryData.TerritoryId, TerritoryData.bContested);
+    }
+}
+
 TArray<FTGTerritoryData> UTGTerritorialManager::GetTerritoriesInRadius(FVector2D CenterPoint, float Radius)
 {
     FScopeLock Lock(&TerritorialDataMutex);
@@ -368,28 +424,42 @@ void UTGTerritorialManager::RefreshTerritorialCache()
     // TODO: Load territorial data from database
     // For now, create sample data for testing
     
-    FScopeLock Lock(&TerritorialDataMutex);
-    
-    // Sample Metro Territory (from existing lore)
-    FTGTerritoryData MetroTerritory;
-    MetroTerritory.TerritoryId = 1;
-    MetroTerritory.TerritoryName = TEXT("Metro Region");
-    MetroTerritory.TerritoryType = TEXT("region");
-    MetroTerritory.Bounds.CenterPoint = FVector2D(0.0f, 0.0f);
-    MetroTerritory.Bounds.InfluenceRadius = 2000.0f;
-    MetroTerritory.Bounds.BoundaryPoints = {
-        FVector2D(-2000.0f, -2000.0f),
-        FVector2D(2000.0f, -2000.0f),
-        FVector2D(2000.0f, 2000.0f),
-        FVector2D(-2000.0f, 2000.0f)
-    };
-    MetroTerritory.CurrentControllerFactionId = 7; // Civic Wardens
-    MetroTerritory.StrategicValue = 8;
-    MetroTerritory.ResourceMultiplier = 1.2f;
-    
-    TerritoryCache.Add(1, MetroTerritory);
-    
-    UE_LOG(LogTGWorld, Log, TEXT("Territorial cache refreshed - %d territories loaded"), TerritoryCache.Num());
+    TArray<int32> RefreshedTerritoryIds;
+    {
+        FScopeLock Lock(&TerritorialDataMutex);
+        
+        // Sample Metro Territory (from existing lore)
+        FTGTerritoryData MetroTerritory;
+        MetroTerritory.TerritoryId = 1;
+        MetroTerritory.TerritoryName = TEXT("Metro Region");
+        MetroTerritory.TerritoryType = TEXT("region");
+        MetroTerritory.Bounds.CenterPoint = FVector2D(0.0f, 0.0f);
+        MetroTerritory.Bounds.InfluenceRadius = 2000.0f;
+        MetroTerritory.Bounds.BoundaryPoints = {
+            FVector2D(-2000.0f, -2000.0f),
+            FVector2D(2000.0f, -2000.0f),
+            FVector2D(2000.0f, 2000.0f),
+            FVector2D(-2000.0f, 2000.0f)
+        };
+        MetroTerritory.CurrentControllerFactionId = 7; // Civic Wardens
+        MetroTerritory.StrategicValue = 8;
+        MetroTerritory.ResourceMultiplier = 1.2f;
+        
+        TerritoryCache.Add(1, MetroTerritory);
+        RefreshedTerritoryIds.Add(MetroTerritory.TerritoryId);
+        
+        UE_LOG(LogTGWorld, Log, TEXT("Territorial cache refreshed - %d territories loaded"), TerritoryCache.Num());
+    }
+
+    // Outside the lock: the replicator reads back each reloaded territory and marks it dirty only
+    // if its compact state changed. Its full rebuild runs once, at begin play
+    if (ATGTerritorialReplicationActor* Replicator = ReplicationActor.Get())
+    {
+        for (const int32 TerritoryId : RefreshedTerritoryIds)
+        {
+            Replicator->RefreshTerritory(TerritoryId);
+        }
+    }
 }
 
 void UTGTerritorialManager::ProcessTerritorialUpdates()
@@ -0,0 +1,282 @@
+#include "TGTerritorialReplicationActor.h"
+#include "TGTerritorialManager.h"
+#include "TGWorld.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+// FTGReplicatedTerritoryItem
+
+bool FTGReplicatedTerritoryItem::ApplyTerritoryData(const FTGTerritoryData& Data)
+{
+    uint8 NewInfluence[TG_REPLICATED_FACTION_SLOTS] = {};
+    for (const FTGFactionInfluence& Influence : Data.FactionInfluences)
+    {
+        if (Influence.FactionId >= 1 && Influence.FactionId <= TG_REPLICATED_FACTION_SLOTS)
+        {
+            NewInfluence[Influence.FactionId - 1] = static_cast<uint8>(FMath::Clamp(Influence.InfluenceLevel, 0, 100));
+        }
+    }
+
+    const uint8 NewController = static_cast<uint8>(FMath::Clamp(Data.CurrentControllerFactionId, 0, 255));
+
+    const bool bChanged = TerritoryId != Data.TerritoryId
+        || ControllerFactionId != NewController
+        || bContested != Data.bContested
+        || FMemory::Memcmp(FactionInfluence, NewInfluence, sizeof(FactionInfluence)) != 0;
+
+    if (bChanged)
+    {
+        TerritoryId = Data.TerritoryId;
+        ControllerFactionId = NewController;
+        bContested = Data.bContested;
+        FMemory::Memcpy(FactionInfluence, NewInfluence, sizeof(FactionInfluence));
+    }
+
+    return bChanged;
+}
+
+void FTGReplicatedTerritoryItem::PreReplicatedRemove(const FTGReplicatedTerritoryArray& InArraySerializer)
+{
+    if (InArraySerializer.Owner)
+    {
+        InArraySerializer.Owner->HandleItemRemoved(*this);
+    }
+}
+
+void FTGReplicatedTerritoryItem::PostReplicatedAdd(const FTGReplicatedTerritoryArray& InArraySerializer)
+{
+    if (InArraySerializer.Owner)
+    {
+        InArraySerializer.Owner->HandleItemAdded(*this);
+    }
+}
+
+void FTGReplicatedTerritoryItem::PostReplicatedChange(const FTGReplicatedTerritoryArray& InArraySerializer)
+{
+    if (InArraySerializer.Owner)
+    {
+        InArraySerializer.Owner->HandleItemChanged(*this);
+    }
+}
+
+// ATGTerritorialReplicationActor
+
+ATGTerritorialReplicationActor::ATGTerritorialReplicationActor()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    bReplicates = true;
+    bAlwaysRelevant = true;
+    SetNetUpdateFrequency(10.0f);
+    SetMinNetUpdateFrequency(1.0f);
+
+    Territories.Owner = this;
+    TerritorialManager = nullptr;
+}
+
+void ATGTerritorialReplicationActor::BeginPlay()
+{
+    Super::BeginPlay();
+
+    Territories.Owner = this;
+
+    UWorld* World = GetWorld();
+    TerritorialManager = World ? World->GetSubsystem<UTGTerritorialManager>() : nullptr;
+    if (TerritorialManager)
+    {
+        TerritorialManager->RegisterReplicationActor(this);
+    }
+
+    if (!HasAuthority() || !TerritorialManager)
+    {
+        return;
+    }
+
+    TerritorialManager->OnTerritoryControlChanged.AddDynamic(this, &ATGTerritorialReplicationActor::HandleControlChanged);
+    TerritorialManager->OnTerritoryContested.AddDynamic(this, &ATGTerritorialReplicationActor::HandleContestedChanged);
+    TerritorialManager->OnInfluenceChanged.AddDynamic(this, &ATGTerritorialReplicationActor::HandleInfluenceChanged);
+
+    RebuildFromManager();
+}
+
+void ATGTerritorialReplicationActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (TerritorialManager)
+    {
+        TerritorialManager->OnTerritoryControlChanged.RemoveDynamic(this, &ATGTerritorialReplicationActor::HandleControlChanged);
+        TerritorialManager->OnTerritoryContested.RemoveDynamic(this, &ATGTerritorialReplicationActor::HandleContestedChanged);
+        TerritorialManager->OnInfluenceChanged.RemoveDynamic(this, &ATGTerritorialReplicationActor::HandleInfluenceChanged);
+        TerritorialManager->UnregisterReplicationActor(this);
+        TerritorialManager = nullptr;
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ATGTerritorialReplicationActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ATGTerritorialReplicationActor, Territories);
+}
+
+bool ATGTerritorialReplicationActor::GetReplicatedTerritory(int32 TerritoryId, FTGReplicatedTerritoryItem& OutTerritory) const
+{
+    if (bIndexDirty)
+    {
+        RebuildIndex();
+    }
+
+    if (const int32* Index = TerritoryIndex.Find(TerritoryId))
+    {
+        OutTerritory = Territories.Items[*Index];
+        return true;
+    }
+
+    return false;
+}
+
+void ATGTerritorialReplicationActor::RebuildFromManager()
+{
+    if (!HasAuthority() || !TerritorialManager)
+    {
+        return;
+    }
+
+    const TArray<FTGTerritoryData> AllTerritories = TerritorialManager->GetAllTerritories();
+
+    TSet<int32> LiveTerritories;
+    LiveTerritories.Reserve(AllTerritories.Num());
+
+    int32 DirtyCount = 0;
+    for (const FTGTerritoryData& Data : AllTerritories)
+    {
+        LiveTerritories.Add(Data.TerritoryId);
+
+        if (const int32* Index = TerritoryIndex.Find(Data.TerritoryId))
+        {
+            FTGReplicatedTerritoryItem& Item = Territories.Items[*Index];
+            if (Item.ApplyTerritoryData(Data))
+            {
+                Territories.MarkItemDirty(Item);
+                DirtyCount++;
+            }
+        }
+        else
+        {
+            FTGReplicatedTerritoryItem& Item = Territories.Items.AddDefaulted_GetRef();
+            Item.ApplyTerritoryData(Data);
+            TerritoryIndex.Add(Data.TerritoryId, Territories.Items.Num() - 1);
+            Territories.MarkItemDirty(Item);
+            DirtyCount++;
+        }
+    }
+
+    // Drop territories the manager no longer knows about
+    const int32 RemovedCount = Territories.Items.RemoveAll([&LiveTerritories](const FTGReplicatedTerritoryItem& Item)
+    {
+        return !LiveTerritories.Contains(Item.TerritoryId);
+    });
+
+    if (RemovedCount > 0)
+    {
+        Territories.MarkArrayDirty();
+        RebuildIndex();
+    }
+
+    UE_LOG(LogTGWorld, Verbose, TEXT("Territorial replication rebuilt: %d territories, %d dirty, %d removed"),
+           Territories.Items.Num(), DirtyCount, RemovedCount);
+}
+
+void ATGTerritorialReplicationActor::RefreshTerritory(int32 TerritoryId)
+{
+    if (!HasAuthority() || !TerritorialManager)
+    {
+        return;
+    }
+
+    const FTGTerritoryData Data = TerritorialManager->GetTerritoryData(TerritoryId);
+    if (Data.TerritoryId != TerritoryId)
+    {
+        return;
+    }
+
+    if (const int32* Index = TerritoryIndex.Find(TerritoryId))
+    {
+        FTGReplicatedTerritoryItem& Item = Territories.Items[*Index];
+        if (Item.ApplyTerritoryData(Data))
+        {
+            Territories.MarkItemDirty(Item);
+        }
+        return;
+    }
+
+    FTGReplicatedTerritoryItem& Item = Territories.Items.AddDefaulted_GetRef();
+    Item.ApplyTerritoryData(Data);
+    TerritoryIndex.Add(TerritoryId, Territories.Items.Num() - 1);
+    Territories.MarkItemDirty(Item);
+}
+
+void ATGTerritorialReplicationActor::RemoveTerritory(int32 TerritoryId)
+{
+    if (!HasAuthority())
+    {
+        return;
+    }
+
+    const int32* Index = TerritoryIndex.Find(TerritoryId);
+    if (!Index)
+    {
+        return;
+    }
+
+    Territories.Items.RemoveAtSwap(*Index);
+    Territories.MarkArrayDirty();
+    RebuildIndex();
+}
+
+void ATGTerritorialReplicationActor::RebuildIndex() const
+{
+    TerritoryIndex.Reset();
+    TerritoryIndex.Reserve(Territories.Items.Num());
+
+    for (int32 i = 0; i < Territories.Items.Num(); i++)
+    {
+        TerritoryIndex.Add(Territories.Items[i].TerritoryId, i);
+    }
+
+    bIndexDirty = false;
+}
+
+void ATGTerritorialReplicationActor::HandleItemAdded(const FTGReplicatedTerritoryItem& Item)
+{
+    // Adds and removes reorder the client array, so the index is rebuilt lazily on the next lookup
+    bIndexDirty = true;
+    OnTerritoryAdded.Broadcast(Item);
+}
+
+void ATGTerritorialReplicationActor::HandleItemChanged(const FTGReplicatedTerritoryItem& Item)
+{
+    OnTerritoryChanged.Broadcast(Item);
+}
+
+void ATGTerritorialReplicationActor::HandleItemRemoved(const FTGReplicatedTerritoryItem& Item)
+{
+    bIndexDirty = true;
+    OnTerritoryRemoved.Broadcast(Item.TerritoryId);
+}
+
+void ATGTerritorialReplicationActor::HandleControlChanged(int32 TerritoryId, int32 OldControllerFactionId, int32 NewControllerFactionId)
+{
+    RefreshTerritory(TerritoryId);
+}
+
+void ATGTerritorialReplicationActor::HandleContestedChanged(int32 TerritoryId, bool bContested)
+{
+    RefreshTerritory(TerritoryId);
+}
+
+void ATGTerritorialReplicationActor::HandleInfluenceChanged(int32 TerritoryId, int32 FactionId, int32 NewInfluenceLevel)
+{
+    RefreshTerritory(TerritoryId);
+}
@@ -2,10 +2,14 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
 #include "Engine/DataTable.h"
 #include "GameplayTagContainer.h"
 #include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Async/AsyncWork.h"
+#include "Economy/TGConvoyRouteGraph.h"
+#include "Economy/TGConvoyPathCache.h"
 #include "TGConvoyEconomySubsystem.generated.h"
 
 // Forward declarations
@@ -150,6 +154,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnIntegrityThresholdReached, float,
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRouteGenerated, FName, RouteId, bool, bSuccess);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRouteInvalidated, FName, RouteId, FString, Reason);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnRoutesUpdated, int32, FactionId, int32, ActiveRoutesCount, float, TotalProfitability);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnConnectionSecurityChanged, int32 /*TerritoryId*/);
 
 /**
  * Convoy Economy Subsystem
@@ -157,7 +162,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnRoutesUpdated, int32, FactionI
  * Tracks convoy operations, supply chain disruptions, and economic warfare
  */
 UCLASS()
-class TGWORLD_API UTGConvoyEconomySubsystem : public UWorldSubsystem
+class TGWORLD_API UTGConvoyEconomySubsystem : public UWorldSubsystem, public FTickableGameObject
 {
     GENERATED_BODY()
 
@@ -167,6 +172,12 @@ public:
     virtual void Deinitialize() override;
     virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
 
+    // FTickableGameObject interface; ticks only while route work is queued
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGConvoyEconomySubsystem, STATGROUP_Tickables); }
+    virtual bool IsTickable() const override { return !IsTemplate() && HasPendingRouteWork(); }
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
     // Convoy Operations
     UFUNCTION(BlueprintCallable, Category = "Convoy Economy")
     void ApplyConvoyOutcome(float Delta, FName RouteId, EJobType JobType, bool bSuccess);
@@ -187,6 +198,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Convoy Economy")
     void ModifyIntegrityIndex(float Delta);
 
+    // Relaxes the integrity index towards IntegrityEquilibrium over DeltaSeconds
+    UFUNCTION(BlueprintCallable, Category = "Convoy Economy")
+    void AdvanceDecay(float DeltaSeconds);
+
+    // Integrity math shared with offline simulations; half-life and elapsed time in the same units
+    static float ApplyConvoyOutcomeToIntegrity(float Integrity, float Delta, bool bSuccess);
+    static float DecayIntegrity(float Integrity, float EquilibriumValue, float HalfLife, float Elapsed);
+
     // Dynamic Route Generation - Performance Critical
     UFUNCTION(BlueprintCallable, Category = "Convoy Economy")
     void GenerateRoutesBetweenTerritories(const FRouteGenerationParameters& Parameters);
@@ -210,6 +229,24 @@ public:
     UFUNCTION(BlueprintPure, Category = "Convoy Economy")
     TArray<FConvoyRoute> GetActiveRoutes() const;
 
+    /** Visits every registered route under the route lock without copying; the visitor must not register or remove routes */
+    void ForEachRoute(TFunctionRef<void(const FConvoyRoute&)> Visitor) const;
+
+    /** Changes whenever a route is registered or removed, so derived route models know when to rebuild */
+    uint32 GetRouteSetVersion() const { return RouteSetVersion; }
+
+    /** Territory connections routes are generated over; game thread only */
+    const FTGConvoyRouteGraph& GetRouteGraph() const { return *RouteGraph; }
+
+    /** Changes whenever the connections are rebuilt from scratch; security changes in place are reported by OnConnectionSecurityChanged */
+    uint32 GetConnectionSetVersion() const { return ConnectionSetVersion; }
+
+    /** Rebuilds every connection from the territorial manager's current territories */
+    void InitializeTerritorialConnections();
+
+    /** Fires after the connections to and from a territory are rescored for a control or contest change */
+    FOnConnectionSecurityChanged OnConnectionSecurityChanged;
+
     UFUNCTION(BlueprintPure, Category = "Convoy Economy")
     float GetFactionTotalProfitability(int32 FactionId) const;
 
@@ -264,6 +301,12 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Economy Config")
     bool bEnableIntegrityDecay = true;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Economy Config", meta = (ClampMin = "0", ClampMax = "1"))
+    float IntegrityEquilibrium = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Economy Config", meta = (ClampMin = "0"))
+    float IntegrityDecayHalfLifeSeconds = 21600.0f; // 6 hours
+
     // Route Generation Configuration
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Route Config")
     float RouteUpdateFrequency = 5.0f; // Seconds between route recalculation
@@ -274,16 +317,30 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Route Config")
     float MinRouteSecurityThreshold = 0.2f;
 
+    /** Run pathfinding and scoring for generated routes on the task graph, committing results on the game thread */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Route Config")
     bool bEnableAsyncRouteGeneration = true;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Route Config")
     int32 RouteGenerationBatchSize = 5; // Routes generated per batch
 
-protected:
-    virtual void Tick(float DeltaTime) override;
-    virtual bool IsTickable() const override { return true; }
-    virtual TStatId GetStatID() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGConvoyEconomySubsystem, STATGROUP_Tickables); }
+    /** Times a generation job overtaken by graph changes is rerun before its paths are rescored on the current graph and committed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Route Config", meta = (ClampMin = "0"))
+    int32 MaxRouteGenerationRetries = 3;
+
+    /** Game thread time per frame for path recomputes and route regeneration queued by control changes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Route Config", meta = (ClampMin = "0.0"))
+    float RouteWorkBudgetMs = 1.0f;
+
+    // Stats
+    int32 GetPendingRouteWorkCount() const { return PendingPathRecomputes.Num() + PendingFactionRegenerations.Num(); }
+    int32 GetCachedPathCount() const { return PathCache.Num(); }
+    int32 GetInFlightRouteJobCount() const { return InFlightRouteJobs; }
+    int32 GetLastConnectionUpdateEdgeCount() const { return LastConnectionUpdateEdgeCount; }
+    int32 GetLastInvalidatedRouteCount() const { return LastInvalidatedRouteCount; }
+    int32 GetLastRescoredRouteCount() const { return LastRescoredRouteCount; }
+    int64 GetTotalInvalidatedRouteCount() const { return TotalInvalidatedRouteCount; }
+    int64 GetTotalRescoredRouteCount() const { return TotalRescoredRouteCount; }
 
 private:
     // Core state
@@ -296,7 +353,39 @@ private:
     // Dynamic route management
     TMap<int32, TArray<FName>> FactionRouteCache; // FactionId -> RouteIds
     TMap<uint32, FName> RouteHashToIdCache; // RouteHash -> RouteId for deduplication
-    TMap<int32, TMap<int32, FTerritorialConnection>> TerritorialConnections; // Cached connections
+    TMap<int32, TArray<FName>> TerritoryRouteIndex; // TerritoryId -> registered routes whose path crosses it
+    uint32 RouteSetVersion = 0; // Bumped with every territory index change
+    uint32 ConnectionSetVersion = 0; // Bumped when InitializeTerritorialConnections replaces the graph
+    
+    // Route scores against the current graph, dropped when a territory on the path changes
+    struct FRouteScores
+    {
+        float SecurityRating = 0.0f;
+        float ProfitabilityScore = 0.0f;
+    };
+    TMap<FName, FRouteScores> RouteScoreCache;
+    TSharedRef<FTGConvoyRouteGraph, ESPMode::ThreadSafe> RouteGraph = MakeShared<FTGConvoyRouteGraph, ESPMode::ThreadSafe>(); // Cached connections, compiled to CSR; shared read-only with generation jobs
+    TSharedRef<FThreadSafeCounter, ESPMode::ThreadSafe> RouteGraphVersion = MakeShared<FThreadSafeCounter, ESPMode::ThreadSafe>(); // Bumped on every graph change
+    mutable FTGConvoyPathfinder Pathfinder; // Game thread search scratch
+    mutable FTGConvoyPathCache PathCache; // Filled by FindOptimalPath
+    
+    // Incremental work after control changes, drained in Tick within RouteWorkBudgetMs
+    TArray<FTGConvoyPathKey> PendingPathRecomputes;
+    TArray<int32> PendingFactionRegenerations;
+    
+    // Async route generation; a faction's newest job supersedes any still running
+    struct FRouteGenerationJob;
+    TMap<int32, uint32> FactionJobSerials;
+    TMap<int32, int32> FactionJobRetries; // Consecutive stale commits per faction
+    uint32 NextJobSerial = 0;
+    int32 InFlightRouteJobs = 0;
+    int32 LastConnectionUpdateEdgeCount = 0;
+    
+    // Routes touched by territory events
+    int32 LastInvalidatedRouteCount = 0;
+    int32 LastRescoredRouteCount = 0;
+    int64 TotalInvalidatedRouteCount = 0;
+    int64 TotalRescoredRouteCount = 0;
     
     // Performance optimization
     mutable FCriticalSection RouteDataMutex;
@@ -318,9 +407,13 @@ private:
     void BroadcastIntegrityChange(float OldValue, float NewValue);
     
     // Route generation internals
-    void InitializeTerritorialConnections();
     void UpdateTerritorialConnections();
+    int32 RefreshTerritoryConnections(int32 TerritoryId, bool bRefreshAttributes = false); // Returns connections rescored
     void ProcessRouteUpdates();
+    FTGConvoyRouteGraph& GetMutableRouteGraph();
+    bool RegisterGeneratedRoute(FConvoyRoute& Route);
+    void DispatchRouteGenerationJob(int32 FactionId, TArray<FRouteGenerationParameters>&& Requests, int32 Retry = 0);
+    void CommitRouteGenerationJob(const TSharedRef<FRouteGenerationJob, ESPMode::ThreadSafe>& Job);
     TArray<int32> FindOptimalPath(int32 SourceTerritoryId, int32 DestinationTerritoryId, int32 FactionId, int32 MaxHops) const;
     float CalculateRouteProfitability(const FConvoyRoute& Route) const;
     float CalculateRouteSecurityRating(const TArray<int32>& TerritorialPath) const;
@@ -335,6 +428,14 @@ private:
     void OnTerritoryContested(int32 TerritoryId, bool bContested);
     
     // Cache management
+    bool HasPendingRouteWork() const { return PendingPathRecomputes.Num() > 0 || PendingFactionRegenerations.Num() > 0; }
+    void MarkTerritoryPathsStale(int32 TerritoryId, int32 PreviousController, bool bSecurityRose);
+    void ProcessPendingRouteWork(double BudgetSeconds);
     void InvalidateRouteCache(int32 FactionId);
+    void RemoveRouteLocked(FName RouteId); // Caller holds RouteDataMutex
+    void IndexRouteTerritories(const FConvoyRoute& Route);
+    void UnindexRouteTerritories(const FConvoyRoute& Route);
+    const FRouteScores& GetRouteScoresLocked(const FConvoyRoute& Route); // Caller holds RouteDataMutex
+    void InvalidateRouteScores(int32 TerritoryId);
     void CleanupInactiveRoutes();
 };
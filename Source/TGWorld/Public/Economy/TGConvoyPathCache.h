@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FTGConvoyRouteGraph;
+
+/** One directed faction route query */
+struct FTGConvoyPathKey
+{
+    int32 FactionId = 0;
+    int32 SourceTerritoryId = 0;
+    int32 DestinationTerritoryId = 0;
+
+    bool operator==(const FTGConvoyPathKey& Other) const
+    {
+        return FactionId == Other.FactionId && SourceTerritoryId == Other.SourceTerritoryId && DestinationTerritoryId == Other.DestinationTerritoryId;
+    }
+
+    friend uint32 GetTypeHash(const FTGConvoyPathKey& Key)
+    {
+        return HashCombine(HashCombine(GetTypeHash(Key.FactionId), GetTypeHash(Key.SourceTerritoryId)), GetTypeHash(Key.DestinationTerritoryId));
+    }
+};
+
+struct FTGConvoyCachedPath
+{
+    TArray<int32> Path;
+    float Cost = 0.0f;
+    int32 MaxHops = 0;
+    bool bStale = false;
+};
+
+/**
+ * Convoy Path Cache
+ * Shortest paths between faction hubs, keyed by faction and endpoints. Each cached path records
+ * the territories it passes through, so a control or security change in one territory only
+ * marks the paths through it stale instead of discarding every faction's routes. A territory
+ * that becomes cheaper for a faction can also attract that faction's paths that avoid it today;
+ * those are found by bounding the detour through it with straight-line distance. Unreachable
+ * results are not cached since they depend on the whole graph.
+ */
+class TGWORLD_API FTGConvoyPathCache
+{
+public:
+    /** Fresh path for the query, or null if missing, stale or computed under another hop limit */
+    const FTGConvoyCachedPath* Find(const FTGConvoyPathKey& Key, int32 MaxHops) const;
+
+    /** Entry regardless of freshness */
+    const FTGConvoyCachedPath* FindEntry(const FTGConvoyPathKey& Key) const { return Entries.Find(Key); }
+
+    void Store(const FTGConvoyPathKey& Key, int32 MaxHops, const TArray<int32>& Path, float Cost);
+    void Remove(const FTGConvoyPathKey& Key);
+
+    /** Marks every fresh path through the territory stale and appends it to OutNewlyStale */
+    void MarkTerritoryStale(int32 TerritoryId, TArray<FTGConvoyPathKey>& OutNewlyStale);
+
+    /**
+     * Marks fresh paths stale whose straight-line detour through the territory is shorter than their
+     * cost. Only paths of factions the territory became cheaper for are considered.
+     */
+    void MarkDetoursStale(const FTGConvoyRouteGraph& Graph, int32 TerritoryId, TFunctionRef<bool(int32 FactionId)> BecameCheaperFor, TArray<FTGConvoyPathKey>& OutNewlyStale);
+
+    void Reset();
+
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    TMap<FTGConvoyPathKey, FTGConvoyCachedPath> Entries;
+    TMap<int32, TArray<FTGConvoyPathKey>> Dependents; // TerritoryId -> paths through it
+    TMap<int32, TArray<FTGConvoyPathKey>> FactionPaths; // FactionId -> cached paths
+
+    void RemoveDependencies(const FTGConvoyPathKey& Key, const TArray<int32>& Path);
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Convoy Route Graph
+ * Territory connections compiled into compressed sparse rows. Territories get dense indices,
+ * each row's edges are sorted by target index, and distance, security, controller, centre and
+ * strategic weight data live in flat arrays. The topology is rebuilt when the territory set
+ * changes; security levels, controllers and contested flags are updated in place. A finalized
+ * graph is self-contained, so a copy can be searched and scored off the game thread.
+ */
+class TGWORLD_API FTGConvoyRouteGraph
+{
+public:
+    // Building: AddNode/AddEdge in any order, then Finalize before querying
+    void Reset();
+    int32 AddNode(int32 TerritoryId, const FVector2D& Center, int32 ControllerFactionId, float StrategicWeight = 0.0f);
+    void AddEdge(int32 FromNode, int32 ToNode, float Distance, bool bDirectConnection, float SecurityLevel = 0.5f);
+    void Finalize();
+
+    int32 NumNodes() const { return TerritoryIds.Num(); }
+    int32 NumEdges() const { return EdgeTargets.Num(); }
+
+    /** Dense index for a territory, INDEX_NONE if it is not in the graph */
+    int32 FindNode(int32 TerritoryId) const
+    {
+        const int32* Node = NodeIndices.Find(TerritoryId);
+        return Node ? *Node : INDEX_NONE;
+    }
+
+    int32 GetTerritoryId(int32 Node) const { return TerritoryIds[Node]; }
+    const FVector2D& GetCenter(int32 Node) const { return Centers[Node]; }
+    int32 GetController(int32 Node) const { return Controllers[Node]; }
+    void SetController(int32 Node, int32 ControllerFactionId) { Controllers[Node] = ControllerFactionId; }
+
+    bool IsContested(int32 Node) const { return ContestedFlags[Node]; }
+    void SetContested(int32 Node, bool bContested) { ContestedFlags[Node] = bContested; }
+
+    /** Strategic value scaled by resource multiplier, used for route profitability */
+    float GetStrategicWeight(int32 Node) const { return StrategicWeights[Node]; }
+    void SetStrategicWeight(int32 Node, float StrategicWeight) { StrategicWeights[Node] = StrategicWeight; }
+
+    // Outgoing edges of Node are [GetEdgeBegin, GetEdgeEnd)
+    int32 GetEdgeBegin(int32 Node) const { return RowOffsets[Node]; }
+    int32 GetEdgeEnd(int32 Node) const { return RowOffsets[Node + 1]; }
+    int32 GetEdgeTarget(int32 Edge) const { return EdgeTargets[Edge]; }
+    float GetEdgeDistance(int32 Edge) const { return EdgeDistances[Edge]; }
+    float GetEdgeSecurity(int32 Edge) const { return EdgeSecurity[Edge]; }
+    void SetEdgeSecurity(int32 Edge, float SecurityLevel) { EdgeSecurity[Edge] = SecurityLevel; }
+    bool IsDirectConnection(int32 Edge) const { return bEdgeDirect[Edge]; }
+
+    /** Edge index from one node to another, INDEX_NONE if they are not connected */
+    int32 FindEdge(int32 FromNode, int32 ToNode) const;
+
+private:
+    struct FPendingEdge
+    {
+        int32 From = 0;
+        int32 To = 0;
+        float Distance = 0.0f;
+        float SecurityLevel = 0.5f;
+        bool bDirectConnection = false;
+    };
+
+    TMap<int32, int32> NodeIndices; // TerritoryId -> dense index
+    TArray<int32> TerritoryIds;
+    TArray<FVector2D> Centers;
+    TArray<int32> Controllers;
+    TArray<float> StrategicWeights;
+    TArray<bool> ContestedFlags;
+
+    TArray<int32> RowOffsets; // NumNodes + 1
+    TArray<int32> EdgeTargets;
+    TArray<float> EdgeDistances;
+    TArray<float> EdgeSecurity;
+    TArray<bool> bEdgeDirect;
+
+    TArray<FPendingEdge> PendingEdges;
+};
+
+/**
+ * A* over an FTGConvoyRouteGraph with a binary heap open list and generation-stamped open and
+ * closed markers. Scratch buffers are kept between searches, so a search on a graph of
+ * unchanged size does not allocate. Not thread safe; use one pathfinder per thread.
+ */
+class TGWORLD_API FTGConvoyPathfinder
+{
+public:
+    /**
+     * Cheapest convoy path as territory IDs from source to destination inclusive. Edge cost is
+     * distance, tripled into territory held by another faction, scaled by (2 - security).
+     * Paths longer than MaxHops are not explored. Returns false and empties OutPath if unreachable.
+     */
+    bool FindPath(const FTGConvoyRouteGraph& Graph, int32 SourceTerritoryId, int32 DestinationTerritoryId, int32 FactionId, int32 MaxHops, TArray<int32>& OutPath);
+
+    /** Cost of the last path found */
+    float GetLastPathCost() const { return LastPathCost; }
+
+    /** Nodes expanded by the last search */
+    int32 GetLastExpandedCount() const { return LastExpandedCount; }
+
+private:
+    struct FOpenEntry
+    {
+        float FScore = 0.0f;
+        int32 Node = 0;
+    };
+
+    struct FOpenOrder
+    {
+        bool operator()(const FOpenEntry& A, const FOpenEntry& B) const { return A.FScore < B.FScore; }
+    };
+
+    TArray<float> GScores;
+    TArray<int32> Parents;
+    TArray<int32> Depths;
+    TArray<uint32> OpenStamps;   // == SearchGeneration while the node has a tentative score this search
+    TArray<uint32> ClosedStamps; // == SearchGeneration once the node is expanded this search
+    TArray<FOpenEntry> OpenHeap;
+    uint32 SearchGeneration = 0;
+
+    float LastPathCost = 0.0f;
+    int32 LastExpandedCount = 0;
+
+    void PrepareScratch(int32 NumNodes);
+};
@@ -2,8 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
 #include "Engine/DataTable.h"
 #include "GameplayTagContainer.h"
+#include "Economy/TGSupplyNetwork.h"
 #include "TGEconomicWarfareSubsystem.generated.h"
 
 UENUM(BlueprintType)
@@ -232,7 +234,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnEconomicRetaliation, int32, Ret
  * Integrates with territorial control system and convoy economy for comprehensive economic gameplay
  */
 UCLASS()
-class TGWORLD_API UTGEconomicWarfareSubsystem : public UWorldSubsystem
+class TGWORLD_API UTGEconomicWarfareSubsystem : public UWorldSubsystem, public FTickableGameObject
 {
     GENERATED_BODY()
 
@@ -242,6 +244,12 @@ public:
     virtual void Deinitialize() override;
     virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
 
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGEconomicWarfareSubsystem, STATGROUP_Tickables); }
+    virtual bool IsTickable() const override { return !IsTemplate(); }
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
     // Route Disruption Management
     UFUNCTION(BlueprintCallable, Category = "Economic Warfare")
     void DisruptRoute(FName RouteId, ERouteDisruptionType DisruptionType, float DurationMinutes, int32 ResponsibleFactionID = -1, float InvestmentCost = 0.0f);
@@ -274,6 +282,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Economic Warfare")
     TArray<FTerritorialBlockade> GetActiveTerritorialBlockades() const;
 
+    /** Tax revenue collected by all of a faction's blockades, past and present */
+    UFUNCTION(BlueprintPure, Category = "Economic Warfare")
+    float GetFactionBlockadeRevenue(int32 FactionID) const;
+
     // Economic Warfare Actions
     UFUNCTION(BlueprintCallable, Category = "Economic Warfare")
     float ExecuteEconomicWarfareAction(const FEconomicWarfareAction& Action);
@@ -307,9 +319,22 @@ public:
     UFUNCTION(BlueprintPure, Category = "Economic Warfare")
     float CalculateSupplyChainEfficiency(int32 FactionID) const;
 
+    /** Territories at the faction's supply choke points: the heads of the minimum cut between its route origins and destinations */
     UFUNCTION(BlueprintPure, Category = "Economic Warfare")
     TArray<int32> GetVulnerableSupplyRoutes(int32 FactionID) const;
 
+    /** Convoy routes crossing the faction's minimum supply cut */
+    UFUNCTION(BlueprintPure, Category = "Economic Warfare")
+    TArray<FName> GetSupplyChokeRoutes(int32 FactionID) const;
+
+    /** Maximum supply flow through the faction's convoy network as a fraction of its undisrupted flow */
+    UFUNCTION(BlueprintPure, Category = "Economic Warfare")
+    float GetSupplyNetworkEfficiency(int32 FactionID) const;
+
+    /** Maximum supply flow through the faction's convoy network, scaled by convoy integrity */
+    UFUNCTION(BlueprintPure, Category = "Economic Warfare")
+    float GetSupplyNetworkThroughput(int32 FactionID) const;
+
     UFUNCTION(BlueprintPure, Category = "Economic Warfare")
     float CalculateEconomicDamageDealt(int32 FactionID) const;
 
@@ -383,19 +408,75 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Economic Warfare Config")
     float AllianceBreakPenaltyMultiplier = 0.7f; // Penalty multiplier when breaking alliances
 
-protected:
-    virtual void Tick(float DeltaTime) override;
-    virtual bool IsTickable() const override { return true; }
-    virtual TStatId GetStatID() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTGEconomicWarfareSubsystem, STATGROUP_Tickables); }
-
 private:
+    /** Pending expiry of a timed disruption; entries for repaired disruptions are skipped when popped */
+    struct FDisruptionExpiry
+    {
+        float ExpiryTime = 0.0f;
+        FName RouteId;
+    };
+
+    struct FDisruptionExpiryOrder
+    {
+        bool operator()(const FDisruptionExpiry& A, const FDisruptionExpiry& B) const { return A.ExpiryTime < B.ExpiryTime; }
+    };
+
+    /**
+     * Blockade revenue accrues linearly at the summed tax rate, so a faction's total is settled
+     * only when one of its blockades is established or removed and extrapolated on query
+     */
+    struct FBlockadeRevenueAccount
+    {
+        float TaxRateSum = 0.0f;
+        float SettledRevenue = 0.0f;
+        float SettledTime = 0.0f;
+    };
+
     // Core state management
     UPROPERTY()
     TMap<FName, FTGRouteDisruptionArray> RouteDisruptions;
 
+    TArray<FDisruptionExpiry> DisruptionExpiryHeap; // Min-heap on ExpiryTime
+    int32 NumTimedDisruptions = 0;                  // Live non-permanent disruptions, bounds stale heap entries
+
     UPROPERTY()
     TMap<int32, FTerritorialBlockade> TerritorialBlockades; // TerritoryID -> Blockade
 
+    TMap<int32, FBlockadeRevenueAccount> BlockadeRevenueAccounts; // FactionID -> revenue across its blockades
+
+    /**
+     * Per-faction flow network over convoy route legs. Each leg is a territorial connection
+     * whose capacity is its security in the convoy route graph, shared by every route along
+     * it; route origins and destinations hang off source and sink edges heavier than all legs
+     * together. Every route on a leg holds an equal share of its capacity, scaled by that
+     * route's viability, and a hostile blockade taxes the legs entering its territory. Rebuilt
+     * when the convoy route set or its connections are rebuilt, otherwise patched one edge at a
+     * time, including legs whose security changes with territory control or contest state. The
+     * nominal network mirrors the live one at base capacities, so security changes patch the
+     * undisrupted flow the same way.
+     */
+    struct FFactionSupplyNetwork
+    {
+        FTGSupplyNetwork Network;
+        FTGSupplyNetwork NominalNetwork; // Same edges at EdgeBaseCapacity; its max flow is NominalMaxFlow
+        TArray<float> EdgeBaseCapacity; // Connection capacity per edge, before disruptions and blockade tax
+        TArray<TArray<FName>> EdgeRoutes; // Routes along each leg; empty for source and sink edges
+        float NominalMaxFlow = 0.0f;
+    };
+
+    struct FSupplyRouteEdges
+    {
+        int32 FactionID = 0;
+        float Viability = 1.0f;
+        TArray<int32> Edges; // Legs only
+    };
+
+    mutable TMap<int32, FFactionSupplyNetwork> SupplyNetworks;
+    mutable TMap<FName, FSupplyRouteEdges> SupplyRoutes;
+    mutable uint32 SupplyRouteSetVersion = 0;
+    mutable uint32 SupplyConnectionSetVersion = 0;
+    mutable bool bSupplyNetworksBuilt = false;
+
     UPROPERTY()
     TMap<int32, FFactionEconomicSpecialization> FactionSpecializations; // FactionID -> Specialization
 
@@ -416,8 +497,17 @@ private:
     float LastRecoveryTime = 0.0f;
 
     // Internal systems
-    void ProcessRouteDisruptions(float DeltaTime);
-    void UpdateTerritorialBlockades(float DeltaTime);
+    void ProcessExpiredDisruptions(float CurrentTime);
+    const FFactionSupplyNetwork* FindSupplyNetwork(int32 FactionID) const;
+    bool AreSupplyNetworksCurrent() const;
+    void RebuildSupplyNetworks() const;
+    float GetSupplyEdgeCapacity(const FFactionSupplyNetwork& Supply, int32 FactionID, int32 Edge) const;
+    void RefreshSupplyRoute(FName RouteId);
+    void RefreshSupplyBlockade(int32 TerritoryID);
+    void RefreshSupplyConnections(int32 TerritoryID);
+    void RebuildDisruptionExpiryHeap();
+    static void SettleBlockadeRevenue(FBlockadeRevenueAccount& Account, float CurrentTime);
+    static FTerritorialBlockade WithAccruedRevenue(const FTerritorialBlockade& Blockade, float CurrentTime);
     void UpdateFactionEconomicPower();
     void InitializeFactionSpecializations();
     float CalculateSpecializationBonus(int32 FactionID, EEconomicWarfareAction ActionType) const;
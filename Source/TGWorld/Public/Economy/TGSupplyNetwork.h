@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Supply Network
+ * Directed flow network between territories. A super source feeds route origins and a super
+ * sink drains route destinations, so the maximum flow is the supply a faction can still move
+ * and the minimum cut is the smallest set of edges whose loss severs it. The flow is kept up
+ * to date as capacities change: a raised edge augments from the current flow, and a cut below
+ * an edge's flow reroutes the excess around it, cancelling only what cannot be rerouted. Each
+ * update costs a few residual searches rather than a full solve.
+ */
+class TGWORLD_API FTGSupplyNetwork
+{
+public:
+    static constexpr int32 SourceNode = 0;
+    static constexpr int32 SinkNode = 1;
+
+    FTGSupplyNetwork() { Reset(); }
+
+    // Building: add nodes, edges and capacities, then Solve for the initial maximum flow
+    void Reset();
+    int32 FindOrAddNode(int32 TerritoryId);
+    int32 FindOrAddEdge(int32 FromNode, int32 ToNode);
+    void SetEdgeCapacity(int32 Edge, float Capacity);
+    float Solve();
+
+    /** Changes one edge's capacity and repairs the maximum flow around it */
+    void UpdateEdgeCapacity(int32 Edge, float Capacity);
+
+    float GetMaxFlow() const { return MaxFlow; }
+
+    int32 NumNodes() const { return NodeTerritoryIds.Num(); }
+    int32 NumEdges() const { return Capacities.Num() / 2; }
+
+    /** Dense index for a territory, INDEX_NONE if it is not in the network */
+    int32 FindNode(int32 TerritoryId) const
+    {
+        const int32* Node = NodeIndices.Find(TerritoryId);
+        return Node ? *Node : INDEX_NONE;
+    }
+
+    /** Territory at a node, INDEX_NONE for the super source and sink */
+    int32 GetTerritoryId(int32 Node) const { return NodeTerritoryIds[Node]; }
+
+    int32 GetEdgeFrom(int32 Edge) const { return Targets[Edge * 2 + 1]; }
+    int32 GetEdgeTo(int32 Edge) const { return Targets[Edge * 2]; }
+    float GetEdgeCapacity(int32 Edge) const { return Capacities[Edge * 2]; }
+    float GetEdgeFlow(int32 Edge) const { return Flows[Edge * 2]; }
+
+    /** Edges ending at Node */
+    void GetIncomingEdges(int32 Node, TArray<int32>& OutEdges) const;
+
+    /** Edges starting at Node */
+    void GetOutgoingEdges(int32 Node, TArray<int32>& OutEdges) const;
+
+    /** Edges with capacity crossing from the source side of the residual graph to the sink side */
+    void GetMinCutEdges(TArray<int32>& OutEdges) const;
+
+    /** Augmenting paths pushed by the last Solve or UpdateEdgeCapacity */
+    int32 GetLastAugmentCount() const { return LastAugmentCount; }
+
+private:
+    // Residual arcs in pairs: 2 * Edge is the edge itself, 2 * Edge + 1 its reverse
+    TArray<int32> Targets;
+    TArray<float> Capacities;
+    TArray<float> Flows;
+    TArray<TArray<int32>> NodeArcs; // Outgoing residual arcs per node
+
+    TMap<int32, int32> NodeIndices; // TerritoryId -> node
+    TArray<int32> NodeTerritoryIds;
+    TMap<uint64, int32> EdgeIndices; // (From, To) -> edge
+
+    float MaxFlow = 0.0f;
+    int32 LastAugmentCount = 0;
+
+    // Search scratch
+    TArray<int32> ParentArcs;
+    TArray<int32> Queue;
+
+    float GetResidual(int32 Arc) const { return Capacities[Arc] - Flows[Arc]; }
+    void PushFlow(int32 Arc, float Amount);
+
+    /** Pushes up to Limit from one node to another along shortest residual paths; returns the amount pushed */
+    float Augment(int32 FromNode, int32 ToNode, float Limit);
+};
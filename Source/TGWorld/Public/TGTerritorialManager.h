@@ -11,6 +11,7 @@
 // Forward declarations
 class ATGTerritoryZone;
 class ATGControlStructure;
+class ATGTerritorialReplicationActor;
 struct FTGFactionData;
 
 USTRUCT(BlueprintType)
@@ -138,6 +139,7 @@ public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
     virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 
     // Territory Management - C++ Performance Critical
     UFUNCTION(BlueprintCallable, Category = "Territory")
@@ -149,6 +151,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Territory")
     TArray<FTGTerritoryData> GetAllTerritories();
 
+    // Adds or replaces a territory; control and contest changes to a known territory are broadcast
+    UFUNCTION(BlueprintCallable, Category = "Territory")
+    void SetTerritoryData(const FTGTerritoryData& TerritoryData);
+
     UFUNCTION(BlueprintCallable, Category = "Territory")
     TArray<FTGTerritoryData> GetTerritoriesInRadius(FVector2D CenterPoint, float Radius);
 
@@ -188,6 +194,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Network")
     void BroadcastTerritorialChange(int32 TerritoryId, const FString& ChangeType);
 
+    // Replicated territory table (server spawns it, clients receive it)
+    UFUNCTION(BlueprintPure, Category = "Network")
+    ATGTerritorialReplicationActor* GetReplicationActor() const { return ReplicationActor.Get(); }
+
+    void RegisterReplicationActor(ATGTerritorialReplicationActor* Actor);
+    void UnregisterReplicationActor(ATGTerritorialReplicationActor* Actor);
+
     // Events
     UPROPERTY(BlueprintAssignable, Category = "Territory Events")
     FOnTerritoryControlChanged OnTerritoryControlChanged;
@@ -235,6 +248,9 @@ private:
     // Database connection
     class UTGDatabaseClient* TerritorialDatabase;
 
+    // Delta-replicated view of TerritoryCache for clients
+    TWeakObjectPtr<ATGTerritorialReplicationActor> ReplicationActor;
+
     // Update tracking (timer handles already declared above)
     float LastUpdateTime;
     float LastCacheRefresh;
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "TGTerritorialReplicationActor.generated.h"
+
+class ATGTerritorialReplicationActor;
+class UTGTerritorialManager;
+struct FTGTerritoryData;
+
+/** Faction slots carried per replicated territory (faction IDs 1..7 map to slots 0..6) */
+static constexpr int32 TG_REPLICATED_FACTION_SLOTS = 7;
+
+/**
+ * Compact, delta-replicated view of a single territory
+ * Influence is quantized to one byte per faction (0-100, matching FTGFactionInfluence::InfluenceLevel)
+ */
+USTRUCT(BlueprintType)
+struct TGWORLD_API FTGReplicatedTerritoryItem : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Territory")
+    int32 TerritoryId = 0;
+
+    UPROPERTY()
+    uint8 FactionInfluence[TG_REPLICATED_FACTION_SLOTS] = {};
+
+    UPROPERTY(BlueprintReadOnly, Category = "Territory")
+    uint8 ControllerFactionId = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Territory")
+    bool bContested = false;
+
+    int32 GetInfluence(int32 FactionId) const
+    {
+        return (FactionId >= 1 && FactionId <= TG_REPLICATED_FACTION_SLOTS) ? FactionInfluence[FactionId - 1] : 0;
+    }
+
+    /** Copies authoritative territory data into this item, returns true if any replicated field changed */
+    bool ApplyTerritoryData(const FTGTerritoryData& Data);
+
+    // FFastArraySerializerItem callbacks (client only)
+    void PreReplicatedRemove(const struct FTGReplicatedTerritoryArray& InArraySerializer);
+    void PostReplicatedAdd(const struct FTGReplicatedTerritoryArray& InArraySerializer);
+    void PostReplicatedChange(const struct FTGReplicatedTerritoryArray& InArraySerializer);
+};
+
+/**
+ * Fast array of all territories - only items marked dirty are sent to clients
+ */
+USTRUCT()
+struct TGWORLD_API FTGReplicatedTerritoryArray : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FTGReplicatedTerritoryItem> Items;
+
+    /** Owning actor, used to route client-side callbacks (not replicated) */
+    ATGTerritorialReplicationActor* Owner = nullptr;
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FTGReplicatedTerritoryItem, FTGReplicatedTerritoryArray>(Items, DeltaParms, *this);
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FTGReplicatedTerritoryArray> : public TStructOpsTypeTraitsBase2<FTGReplicatedTerritoryArray>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnReplicatedTerritoryChanged, const FTGReplicatedTerritoryItem&, Territory);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnReplicatedTerritoryRemoved, int32, TerritoryId);
+
+/**
+ * Server-authoritative replicated territory table
+ * Mirrors UTGTerritorialManager's cache into a fast array so clients receive per-territory deltas
+ * instead of polling managers or receiving full resends
+ */
+UCLASS(BlueprintType, NotPlaceable)
+class TGWORLD_API ATGTerritorialReplicationActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ATGTerritorialReplicationActor();
+
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    // Queries (valid on server and clients)
+    UFUNCTION(BlueprintCallable, Category = "Territory|Replication")
+    bool GetReplicatedTerritory(int32 TerritoryId, FTGReplicatedTerritoryItem& OutTerritory) const;
+
+    UFUNCTION(BlueprintPure, Category = "Territory|Replication")
+    int32 GetNumReplicatedTerritories() const { return Territories.Items.Num(); }
+
+    const TArray<FTGReplicatedTerritoryItem>& GetReplicatedTerritories() const { return Territories.Items; }
+
+    // Server updates
+    UFUNCTION(BlueprintCallable, Category = "Territory|Replication", BlueprintAuthorityOnly)
+    void RebuildFromManager();
+
+    UFUNCTION(BlueprintCallable, Category = "Territory|Replication", BlueprintAuthorityOnly)
+    void RefreshTerritory(int32 TerritoryId);
+
+    UFUNCTION(BlueprintCallable, Category = "Territory|Replication", BlueprintAuthorityOnly)
+    void RemoveTerritory(int32 TerritoryId);
+
+    // Client-side per-item callbacks
+    UPROPERTY(BlueprintAssignable, Category = "Territory|Replication")
+    FOnReplicatedTerritoryChanged OnTerritoryAdded;
+
+    UPROPERTY(BlueprintAssignable, Category = "Territory|Replication")
+    FOnReplicatedTerritoryChanged OnTerritoryChanged;
+
+    UPROPERTY(BlueprintAssignable, Category = "Territory|Replication")
+    FOnReplicatedTerritoryRemoved OnTerritoryRemoved;
+
+    // Called from fast array item callbacks
+    void HandleItemAdded(const FTGReplicatedTerritoryItem& Item);
+    void HandleItemChanged(const FTGReplicatedTerritoryItem& Item);
+    void HandleItemRemoved(const FTGReplicatedTerritoryItem& Item);
+
+protected:
+    UPROPERTY(Replicated)
+    FTGReplicatedTerritoryArray Territories;
+
+private:
+    UPROPERTY()
+    UTGTerritorialManager* TerritorialManager;
+
+    /** TerritoryId -> index into Territories.Items (server and client) */
+    mutable TMap<int32, int32> TerritoryIndex;
+    mutable bool bIndexDirty = false;
+
+    void RebuildIndex() const;
+
+    // UTGTerritorialManager event handlers (server only)
+    UFUNCTION()
+    void HandleControlChanged(int32 TerritoryId, int32 OldControllerFactionId, int32 NewControllerFactionId);
+
+    UFUNCTION()
+    void HandleContestedChanged(int32 TerritoryId, bool bContested);
+
+    UFUNCTION()
+    void HandleInfluenceChanged(int32 TerritoryId, int32 FactionId, int32 NewInfluenceLevel);
+};
@@ -5,7 +5,7 @@ public class TGWorld : ModuleRules
     public TGWorld(ReadOnlyTargetRules Target) : base(Target)
     {
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
-        PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine" });
+        PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "NetCore" });
         
         PublicDependencyModuleNames.AddRange(new string[] { "TGCore" });
 